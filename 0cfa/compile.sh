@@ -1,6 +1,16 @@
 
 clang++ -O3 naive0cfa.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa
 
-clang++ -O3 naive0cfa.cpp -DCONCURRENT -DNTHREADS=4 -DPRINT_STATS `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-c
+clang++ -O3 naive0cfa.cpp -DCONCURRENT -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-c
+
+clang++ -O3 naive0cfa.cpp -DCONCURRENT -DNTHREADS=4 -DSNAPSHOT `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-snapshot-c
 
 clang++ -O3 naive0cfa.cpp -DCSV -DRUN_COUNT=3 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-csv
+
+clang++ -O3 naive0cfa.cpp -DWHOLE_PROGRAM -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-wp
+
+clang++ -O3 naive0cfa.cpp -DKCFA=2 -DCTX_BUDGET=64 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-2cfa
+
+clang++ -O3 naive0cfa.cpp -DKOBJ=2 -DCTX_BUDGET=64 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-2obj
+
+clang++ -O3 naive0cfa.cpp -DCONTEXT_COMPARE `llvm-config --cxxflags --ldflags --system-libs --libs core` -o naive0cfa-ctx
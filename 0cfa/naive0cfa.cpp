@@ -1,263 +1,1647 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/SparseBitVector.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/IR/Argument.h"
 #include "llvm/IR/CFG.h"
 #include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/User.h"
 #include "llvm/IR/Value.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
+#include <shared_mutex>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
-using namespace llvm;
+#include "../common/arena.h"
+#include "../common/cost.h"
+#include "../common/emit.h"
+#include "../common/instrument.h"
+#include "../common/snapshot.h"
 
-std::mutex outsmtx;
+using namespace llvm;
 
 struct TaskInfo {
   Function *func;
   size_t size;
+  // Predicted time (cost.h); the queue pops the most expensive task first.
+  double cost;
   int index;
 
-  bool operator<(const TaskInfo &rhs) const { return size < rhs.size; }
+  bool operator<(const TaskInfo &rhs) const { return cost < rhs.cost; }
 };
 
-struct LocalData {
-  std::unordered_map<Instruction *, DenseSet<Value *>> callMap;
-  std::unordered_map<Value *, DenseSet<Value *>> points2;
-  std::unordered_set<Value *> visited;
+// -DSNAPSHOT runs the per-function modes on a snapshot.h copy of the
+// module: nodes of the per-function solver are snapshot value IDs instead
+// of llvm::Value pointers. Virtual call targets are resolved while
+// lowering, and the concurrent build drops the module afterwards.
+#ifdef SNAPSHOT
+using Node = uint32_t;
+const snapshot::Module *ir = nullptr;
+DenseMap<uint32_t, std::vector<uint32_t>> virtualTargets;
+#else
+using Node = Value *;
+#endif
+
+// Final points-to sets of module-level values (globals, functions and other
+// constants), shared by all functions and workers so they are solved once.
+// Entries are never changed after insertion, so a looked-up set stays valid.
+class SharedFacts {
+public:
+  const DenseSet<Node> *lookup(Node val) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = facts.find(val);
+    return it == facts.end() ? nullptr : &it->second;
+  }
+
+  const DenseSet<Node> *publish(Node val, const DenseSet<Node> &pts) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    return &facts.try_emplace(val, pts).first->second;
+  }
+
+  size_t size() {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return facts.size();
+  }
+
+  // Forgets every fact, e.g. before analyzing another module.
+  void clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    facts.clear();
+  }
+
+private:
+  std::shared_mutex mutex;
+  std::unordered_map<Node, DenseSet<Node>> facts;
 };
 
-void analyzePtr(Value *val, LocalData &localdata) {
-  auto &callMap = localdata.callMap;
-  auto &points2 = localdata.points2;
-  auto &visited = localdata.visited;
-  if (visited.find(val) != visited.end()) {
-    return;
+SharedFacts sharedFacts;
+
+bool isModuleLevel(Value *val) {
+  return !isa<Instruction>(val) && !isa<Argument>(val);
+}
+
+#ifdef SNAPSHOT
+bool isModuleLevel(uint32_t val) { return !ir->isLocal(val); }
+#endif
+
+// Per-function state, reset between functions. Facts about module-level
+// values live in sharedFacts instead.
+struct LocalData {
+  // The maps below come from the thread's arena, which reset() rewinds once
+  // they are emptied; the DenseSets they hold still use malloc.
+  arena::Scope scope;
+  arena::UnorderedMap<Node, DenseSet<Node>> callMap;
+  arena::UnorderedMap<Node, DenseSet<Node>> points2;
+  // Values whose points2 entry is final.
+  arena::UnorderedSet<Node> visited;
+  // Shared facts already looked up by this function.
+  DenseMap<Node, const DenseSet<Node> *> shared;
+  // Scratch for the SCC walk in analyzePtr.
+  DenseMap<Node, unsigned> sccIndex;
+  std::vector<Node> sccStack;
+
+  void reset() {
+    // Swapping with empty maps also gives back their bucket arrays.
+    decltype(callMap)().swap(callMap);
+    decltype(points2)().swap(points2);
+    decltype(visited)().swap(visited);
+    shared.clear();
+    scope.reset();
   }
-  visited.insert(val);
-  // if (points2.find(val) != points2.end()) {
-  //   return;
-  // }
+};
 
-  if (isa<Function>(val) || isa<Argument>(val)) {
-    points2[val] = {val};
+// Returns the final points-to set of val, or nullptr if it is not solved yet.
+const DenseSet<Node> *finalPts(Node val, LocalData &localdata) {
+  if (localdata.visited.find(val) != localdata.visited.end()) {
+    return &localdata.points2[val];
+  }
+  if (!isModuleLevel(val))
+    return nullptr;
+  auto it = localdata.shared.find(val);
+  if (it != localdata.shared.end())
+    return it->second;
+  auto *pts = sharedFacts.lookup(val);
+  if (pts)
+    localdata.shared[val] = pts;
+  return pts;
+}
 
-  } else if (auto *cast = dyn_cast<CastInst>(val)) {
-    auto *src = cast->getOperand(0);
-    analyzePtr(src, localdata);
-    points2[cast] = points2[src];
+// Calls visit() on every value whose targets flow into val.
+template <typename Visit> void forEachPtrDep(Value *val, Visit &&visit) {
+  if (auto *cast = dyn_cast<CastInst>(val)) {
+    visit(cast->getOperand(0));
 
   } else if (auto *phi = dyn_cast<PHINode>(val)) {
-    for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
-      Value *inval = phi->getIncomingValue(i);
-      // if (isa<Instruction>(inval) || isa<Argument>(inval)) {
-      analyzePtr(inval, localdata);
-      points2[phi].insert(points2[inval].begin(), points2[inval].end());
-      // }
+    for (unsigned i = 0; i < phi->getNumIncomingValues(); ++i) {
+      visit(phi->getIncomingValue(i));
     }
 
   } else if (auto *select = dyn_cast<SelectInst>(val)) {
-    Value *tval = select->getTrueValue();
-    Value *fval = select->getFalseValue();
-    // if (isa<Instruction>(tval) || isa<Argument>(tval)) {
-    analyzePtr(tval, localdata);
-    points2[select].insert(points2[tval].begin(), points2[tval].end());
-    // }
-    // if (isa<Instruction>(fval) || isa<Argument>(fval)) {
-    analyzePtr(fval, localdata);
-    points2[select].insert(points2[fval].begin(), points2[fval].end());
-    // }
+    visit(select->getTrueValue());
+    visit(select->getFalseValue());
 
   } else if (auto *load = dyn_cast<LoadInst>(val)) {
     auto *loadptr = load->getPointerOperand();
-    analyzePtr(loadptr, localdata);
-    points2[load] = points2[loadptr];
+    visit(loadptr);
     for (auto *user : loadptr->users()) {
       if (auto *store = dyn_cast<StoreInst>(user)) {
         if (store->getPointerOperand() == loadptr) {
-          auto *stval = store->getValueOperand();
-          analyzePtr(stval, localdata);
-          points2[load].insert(points2[stval].begin(), points2[stval].end());
+          visit(store->getValueOperand());
         }
       }
     }
 
   } else if (auto *global = dyn_cast<GlobalVariable>(val)) {
-    points2[val] = {val};
     if (global->hasInitializer()) {
-      Value *initval = global->getInitializer();
-      analyzePtr(initval, localdata);
-      points2[val].insert(points2[initval].begin(), points2[initval].end());
+      visit(global->getInitializer());
     }
     for (auto *user : global->users()) {
       if (auto *store = dyn_cast<StoreInst>(user)) {
         if (store->getPointerOperand() == global) {
-          Value *storedVal = store->getValueOperand();
-          analyzePtr(storedVal, localdata);
-          points2[val].insert(points2[storedVal].begin(),
-                              points2[storedVal].end());
+          visit(store->getValueOperand());
         }
       }
     }
 
   } else if (auto *gep = dyn_cast<GetElementPtrInst>(val)) {
-    Value *baseptr = gep->getPointerOperand();
-    analyzePtr(baseptr, localdata);
-    points2[gep] = points2[baseptr];
+    visit(gep->getPointerOperand());
 
-  // } else if (auto *cexpr = dyn_cast<ConstantExpr>(val)) {
-  //   auto *ceinst = cexpr->getAsInstruction();
-  //   analyzePtr(ceinst, localdata);
-  //   points2[cexpr] = points2[ceinst];
-  //   points2.erase(ceinst);
-  //   ceinst->deleteValue();
+  } else if (auto *cexpr = dyn_cast<ConstantExpr>(val)) {
+    if (cexpr->isCast() || cexpr->getOpcode() == Instruction::GetElementPtr) {
+      visit(cexpr->getOperand(0));
+    }
+  }
+}
 
-  } else {
-    points2[val] = {val};
+// Copies (cast, phi, select, load, GEP and their constant expressions) only
+// forward what they depend on; every other value is also its own target.
+bool pointsToSelf(Value *val) {
+  if (auto *cexpr = dyn_cast<ConstantExpr>(val)) {
+    return !cexpr->isCast() &&
+           cexpr->getOpcode() != Instruction::GetElementPtr;
   }
+  return !isa<CastInst>(val) && !isa<PHINode>(val) && !isa<SelectInst>(val) &&
+         !isa<LoadInst>(val) && !isa<GetElementPtrInst>(val);
 }
 
-void analyzeIntra(Function &func, LocalData &localdata) {
-  auto &callMap = localdata.callMap;
+#ifdef SNAPSHOT
+// The same rules on snapshot IDs.
+template <typename Visit> void forEachPtrDep(uint32_t val, Visit &&visit) {
+  auto storesTo = [&](uint32_t ptr) {
+    for (uint32_t user : ir->users(ptr)) {
+      if (ir->isInst(user, Instruction::Store) && ir->operand(user, 1) == ptr)
+        visit(ir->operand(user, 0));
+    }
+  };
+  unsigned op = ir->opcode[val];
+  switch (ir->kind[val]) {
+  case snapshot::Instruction:
+    if (Instruction::isCast(op) || op == Instruction::GetElementPtr) {
+      visit(ir->operand(val, 0));
+    } else if (op == Instruction::PHI) {
+      for (unsigned i = 0; i < ir->numIncoming(val); ++i) {
+        visit(ir->incomingValue(val, i));
+      }
+    } else if (op == Instruction::Select) {
+      visit(ir->operand(val, 1));
+      visit(ir->operand(val, 2));
+    } else if (op == Instruction::Load) {
+      uint32_t loadptr = ir->operand(val, 0);
+      visit(loadptr);
+      storesTo(loadptr);
+    }
+    break;
+  case snapshot::Global:
+    if (ir->is(val, snapshot::Initializer))
+      visit(ir->operand(val, 0));
+    storesTo(val);
+    break;
+  case snapshot::ConstantExpr:
+    if (Instruction::isCast(op) || op == Instruction::GetElementPtr)
+      visit(ir->operand(val, 0));
+    break;
+  default:
+    break;
+  }
+}
+
+bool pointsToSelf(uint32_t val) {
+  unsigned op = ir->opcode[val];
+  bool copy = Instruction::isCast(op) || op == Instruction::GetElementPtr;
+  if (ir->kind[val] == snapshot::ConstantExpr)
+    return !copy;
+  if (ir->kind[val] == snapshot::Instruction)
+    return !copy && op != Instruction::PHI && op != Instruction::Select &&
+           op != Instruction::Load;
+  return true;
+}
+#endif
+
+// Solves points2 for val and everything it depends on. Tarjan's algorithm on
+// an explicit stack finds the dependence SCCs in topological order, so every
+// SCC is evaluated once, after all of its dependences. Each rule only unions
+// its dependences into the value, so the fixpoint inside an SCC is the same
+// set for all members.
+void analyzePtr(Node val, LocalData &localdata) {
   auto &points2 = localdata.points2;
   auto &visited = localdata.visited;
+  auto &sccIndex = localdata.sccIndex;
+  auto &sccStack = localdata.sccStack;
+  if (finalPts(val, localdata)) {
+    return;
+  }
+
+  struct Frame {
+    Node val;
+    unsigned low;
+    SmallVector<Node, 4> deps;
+    unsigned next = 0;
+  };
+  arena::Vector<Frame> frames;
+  unsigned counter = 0;
+
+  auto enter = [&](Node v) {
+    sccIndex[v] = counter;
+    sccStack.push_back(v);
+    frames.push_back({v, counter, {}});
+    forEachPtrDep(v, [&](Node dep) { frames.back().deps.push_back(dep); });
+    ++counter;
+  };
+
+  enter(val);
+  while (!frames.empty()) {
+    auto &frame = frames.back();
+    if (frame.next < frame.deps.size()) {
+      Node dep = frame.deps[frame.next++];
+      if (finalPts(dep, localdata))
+        continue;
+      auto it = sccIndex.find(dep);
+      if (it == sccIndex.end()) {
+        enter(dep);
+      } else {
+        frame.low = std::min(frame.low, it->second);
+      }
+      continue;
+    }
+
+    Node v = frame.val;
+    unsigned low = frame.low;
+    frames.pop_back();
+    instrument::worklistPops();
+    if (!frames.empty()) {
+      frames.back().low = std::min(frames.back().low, low);
+    }
+    if (low != sccIndex[v])
+      continue;
+
+    // v is the root of an SCC: its members are on top of sccStack, and every
+    // dependence outside the SCC is already final.
+    auto first = std::find(sccStack.rbegin(), sccStack.rend(), v).base() - 1;
+    DenseSet<Node> pts;
+    for (auto member = first; member != sccStack.end(); ++member) {
+      if (pointsToSelf(*member)) {
+        pts.insert(*member);
+      }
+      forEachPtrDep(*member, [&](Node dep) {
+        if (auto *depPts = finalPts(dep, localdata)) {
+          pts.insert(depPts->begin(), depPts->end());
+        }
+      });
+    }
+    instrument::setUnion(pts.size());
+    // Members are only marked final once the union is complete, so deps
+    // inside the SCC are skipped above.
+    for (auto member = first; member != sccStack.end(); ++member) {
+      if (isModuleLevel(*member)) {
+        localdata.shared[*member] = sharedFacts.publish(*member, pts);
+      } else {
+        points2[*member] = pts;
+        visited.insert(*member);
+      }
+      sccIndex.erase(*member);
+    }
+    sccStack.erase(first, sccStack.end());
+  }
+}
+
+// Class-hierarchy index over C++ vtables, for modules built with
+// -fwhole-program-vtables (or CFI): every vtable carries !type metadata
+// naming its address points, and every virtual call is guarded by an
+// llvm.type.test on the loaded vtable pointer. A virtual call loading the
+// slot k bytes past an address point of type T may reach any function in
+// slot k of a vtable compatible with T. Vtables nothing in the code or in
+// another global refers to belong to classes that are never constructed
+// and are skipped (RTA).
+class VTableIndex {
+public:
+  explicit VTableIndex(Module &module) : DL(module.getDataLayout()) {
+    for (auto &GV : module.globals()) {
+      SmallVector<MDNode *, 2> types;
+      GV.getMetadata(LLVMContext::MD_type, types);
+      if (types.empty() || !GV.hasInitializer())
+        continue;
+      if (!usedByCode(&GV)) {
+        skippedVTables++;
+        continue;
+      }
+      vtables++;
+      std::vector<std::pair<int64_t, Function *>> slotFns;
+      flatten(GV.getInitializer(), 0, slotFns);
+      for (auto *type : types) {
+        auto *offset = mdconst::dyn_extract<ConstantInt>(type->getOperand(0));
+        if (!offset)
+          continue;
+        addressPoints++;
+        int64_t point = offset->getSExtValue();
+        Metadata *typeId = type->getOperand(1).get();
+        for (auto &[slot, fn] : slotFns) {
+          if (slot < point)
+            continue;
+          auto &fns = targets[{typeId, slot - point}];
+          if (!is_contained(fns, fn))
+            fns.push_back(fn);
+        }
+      }
+    }
+  }
+
+  // Possible targets of call if it is a type-tested virtual call, nullptr
+  // otherwise. An empty list means no constructed class implements the slot.
+  const SmallVectorImpl<Function *> *resolve(CallBase *call) const {
+    auto *fnLoad =
+        dyn_cast<LoadInst>(call->getCalledOperand()->stripPointerCasts());
+    if (!fnLoad)
+      return nullptr;
+    Value *slotPtr = fnLoad->getPointerOperand();
+    APInt slot(DL.getIndexTypeSizeInBits(slotPtr->getType()), 0);
+    Value *vtable = slotPtr->stripAndAccumulateConstantOffsets(DL, slot, true);
+    if (!isa<LoadInst>(vtable))
+      return nullptr;
+    Metadata *typeId = typeTested(vtable);
+    if (!typeId)
+      return nullptr;
+    virtualCalls++;
+    auto it = targets.find({typeId, slot.getSExtValue()});
+    return it == targets.end() ? &noTargets : &it->second;
+  }
+
+  size_t vtables = 0;
+  size_t skippedVTables = 0;
+  size_t addressPoints = 0;
+  mutable std::atomic<size_t> virtualCalls{0};
+
+private:
+  const DataLayout &DL;
+  DenseMap<std::pair<Metadata *, int64_t>, SmallVector<Function *, 4>> targets;
+  SmallVector<Function *, 4> noTargets;
+
+  // Whether a chain of constant users (expressions, initializer arrays and
+  // structs) leads from GV to an instruction or to another global or
+  // function: a VTT, llvm.used or any other initializer keeps it, since
+  // code may reach it through them.
+  static bool usedByCode(GlobalVariable *GV) {
+    SmallVector<User *, 8> worklist(GV->users());
+    SmallPtrSet<User *, 8> seen;
+    while (!worklist.empty()) {
+      User *user = worklist.pop_back_val();
+      if (isa<Instruction>(user) || (isa<GlobalValue>(user) && user != GV))
+        return true;
+      if (isa<Constant>(user) && !isa<GlobalValue>(user) &&
+          seen.insert(user).second)
+        worklist.append(user->user_begin(), user->user_end());
+    }
+    return false;
+  }
+
+  // Byte offset of every function pointer in a vtable initializer.
+  void flatten(Constant *C, int64_t base,
+               std::vector<std::pair<int64_t, Function *>> &out) const {
+    if (auto *CS = dyn_cast<ConstantStruct>(C)) {
+      auto *layout = DL.getStructLayout(CS->getType());
+      for (unsigned i = 0; i < CS->getNumOperands(); ++i) {
+        flatten(CS->getOperand(i), base + layout->getElementOffset(i), out);
+      }
+    } else if (auto *CA = dyn_cast<ConstantArray>(C)) {
+      int64_t size = DL.getTypeAllocSize(CA->getType()->getElementType());
+      for (unsigned i = 0; i < CA->getNumOperands(); ++i) {
+        flatten(CA->getOperand(i), base + i * size, out);
+      }
+    } else if (auto *fn = dyn_cast<Function>(C->stripPointerCasts())) {
+      out.push_back({base, fn});
+    }
+  }
+
+  static Metadata *typeTested(Value *vtable) {
+    SmallVector<Value *, 4> ptrs{vtable};
+    for (auto *user : vtable->users()) {
+      if (isa<BitCastInst>(user))
+        ptrs.push_back(user);
+    }
+    for (auto *ptr : ptrs) {
+      for (auto *user : ptr->users()) {
+        auto *test = dyn_cast<IntrinsicInst>(user);
+        if (test && test->getIntrinsicID() == Intrinsic::type_test)
+          return cast<MetadataAsValue>(test->getArgOperand(1))->getMetadata();
+      }
+    }
+    return nullptr;
+  }
+};
+
+const VTableIndex *vtableIndex = nullptr;
+
+#ifndef SNAPSHOT
+void analyzeIntra(Function &func, LocalData &localdata) {
+  instrument::PhaseTimer timer(instrument::Solve);
+  auto &callMap = localdata.callMap;
 
   for (auto &BB : func) {
     for (auto &inst : BB) {
-      if (auto *call = dyn_cast<CallInst>(&inst)) {
+      if (auto *call = dyn_cast<CallBase>(&inst)) {
         // auto *called = call->getCalledFunction();
         // if (called != nullptr) {
         //   // direct call
         //   callMap[call] = {called};
         // } else {
         // indirect
+        if (auto *virtualTargets = vtableIndex->resolve(call)) {
+          callMap[call] = DenseSet<Value *>(virtualTargets->begin(),
+                                            virtualTargets->end());
+          continue;
+        }
         auto *callptr = call->getCalledOperand();
         analyzePtr(callptr, localdata);
-        callMap[call] = points2[callptr];
+        callMap[call] = *finalPts(callptr, localdata);
         // }
       }
     }
   }
 }
 
-void print(LocalData &localdata) {
+#else
+void analyzeIntra(uint32_t func, LocalData &localdata) {
+  instrument::PhaseTimer timer(instrument::Solve);
   auto &callMap = localdata.callMap;
-  auto &points2 = localdata.points2;
-  auto &visited = localdata.visited;
+  for (uint32_t inst : ir->insts(func)) {
+    if (!ir->isCall(inst))
+      continue;
+    auto it = virtualTargets.find(inst);
+    if (it != virtualTargets.end()) {
+      callMap[inst] = DenseSet<Node>(it->second.begin(), it->second.end());
+      continue;
+    }
+    uint32_t callptr = ir->calledOperand(inst);
+    analyzePtr(callptr, localdata);
+    callMap[inst] = *finalPts(callptr, localdata);
+  }
+}
+
+// Resolves every type-tested virtual call up front, so that analyzeIntra
+// does not need the IR.
+void resolveVirtualCalls(Module &module) {
+  DenseMap<const Function *, uint32_t> index;
+  for (auto [f, func] : enumerate(module)) {
+    index[&func] = f;
+  }
+  for (uint32_t f = 0; f < ir->numFunctions(); ++f) {
+    for (uint32_t inst : ir->insts(f)) {
+      if (!ir->isCall(inst))
+        continue;
+      auto *call = cast<CallBase>(ir->source(inst));
+      if (auto *targets = vtableIndex->resolve(call)) {
+        auto &ids = virtualTargets[inst];
+        for (Function *target : *targets) {
+          ids.push_back(ir->functionValue(index[target]));
+        }
+      }
+    }
+  }
+}
+#endif
+
+void print(Function &func, LocalData &localdata, emit::Writer &writer) {
+  auto &callMap = localdata.callMap;
+#ifdef SNAPSHOT
+  auto value = [](Node node) { return ir->source(node); };
+#else
+  auto value = [](Node node) { return node; };
+#endif
+  std::vector<Value *> values;
+  if (emit::format != emit::Full) {
+    writer.beginFunction(func);
+    for (auto &[key, targets] : callMap) {
+      values.clear();
+      for (Node target : targets) {
+        values.push_back(value(target));
+      }
+      writer.record("calls", value(key), values);
+    }
+    return;
+  }
 
+  auto &os = writer.os();
+  os << "\nFunction: " << func.getName() << "\n";
   for (auto &[key, targets] : callMap) {
-    outs() << *key << "\n->";
-    for (auto *target : targets) {
+    os << writer.full(*value(key)) << "\n->";
+    for (Node node : targets) {
+      Value *target = value(node);
       if (dyn_cast<Function>(target)) {
-        outs() << "\t<" << target->getName() << ">\n";
+        os << "\t<" << target->getName() << ">\n";
       } else {
-        outs() << "\t" << *target << "\n";
+        os << "\t" << writer.full(*target) << "\n";
       }
     }
     if (targets.empty()) {
-      outs() << "\tempty\n";
+      os << "\tempty\n";
     }
-    outs() << "\n";
+    os << "\n";
     // outs().flush();
   }
+  os << "******************************** " << func.getName() << "\n";
 }
 
-void threadedSlice(std::mutex &Qmutex, std::priority_queue<TaskInfo> &taskQ,
+void threaded0CFA(std::mutex &Qmutex, std::priority_queue<TaskInfo> &taskQ,
                   int tid) {
-  auto start = std::chrono::high_resolution_clock::now();
-  int max_time = 0;
-  int max_size = 0;
-  int task_count = 0;
-  int total_size = 0;
-  int total_size_sq = 0;
-  int total_time = 0;
-  int total_time_sq = 0;
-
+  instrument::ThreadScope scope("worker " + std::to_string(tid));
   LocalData localdata;
   while (true) {
+#ifdef SNAPSHOT
     int index;
+#else
     Function *func;
+#endif
     int size;
     {
       std::lock_guard<std::mutex> lock(Qmutex);
       if (taskQ.empty())
         break;
+#ifdef SNAPSHOT
       index = taskQ.top().index;
+#else
       func = taskQ.top().func;
+#endif
       size = taskQ.top().size;
       taskQ.pop();
     }
-#ifdef PRINT_STATS
-    auto sub_start = std::chrono::high_resolution_clock::now();
-#endif
+#ifdef SNAPSHOT
+    instrument::TaskTimer task(size, ir->name(index), size,
+                               ir->numInsts(index));
+    localdata.reset();
+    analyzeIntra(index, localdata);
+#else
+    instrument::TaskTimer task(size, func);
 
+    localdata.reset();
     analyzeIntra(*func, localdata);
+#endif
+  }
+}
 
-#ifdef PRINT_STATS
-    auto sub_end = std::chrono::high_resolution_clock::now();
-    auto sub_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-        sub_end - sub_start);
-    int time = sub_duration.count();
-    if (time > max_time) {
-      max_time = time;
-      max_size = size;
-    }
-    task_count++;
-    total_size += size;
-    total_size_sq += size * size;
-    total_time += time;
-    total_time_sq += time * time;
+#ifdef WHOLE_PROGRAM
+#ifndef NTHREADS
+#define NTHREADS 4
 #endif
+
+// Whole-program 0-CFA. Every argument, instruction, global and constant
+// operand is a node of one value-flow graph with the same rules as analyzePtr.
+// Each function also gets a return node. Calls add argument and return edges
+// as their targets are resolved, so indirect calls through globals, arguments
+// and returns are followed across functions.
+//
+// Each node is owned by its function, or by the module for globals and
+// constants. Only the owner writes pts; other owners read snap, which is
+// published between rounds. One round solves every call-graph SCC that has
+// changed inputs, callees first, on a work-stealing pool. A return node is
+// published as soon as its SCC finishes, because only callers read it and
+// they wait for their callees. Rounds repeat until no snapshot or call target
+// changes.
+
+struct WPNode {
+  SparseBitVector<> pts;
+  SparseBitVector<> snap;
+  std::vector<unsigned> preds, succs;
+  int owner;
+  bool unpublished = false;
+};
+
+struct CallSite {
+  CallBase *inst;
+  unsigned call;
+  unsigned callee;
+  int caller;
+  SmallVector<unsigned, 4> args;
+  DenseSet<Function *> targets;
+  // Set for type-tested virtual calls, which take their targets from the
+  // vtable index instead of the points-to set of the loaded slot.
+  const SmallVectorImpl<Function *> *virtualTargets = nullptr;
+};
+
+struct CallGraphStats {
+  size_t directSites = 0;
+  size_t indirectSites = 0;
+  size_t directEdges = 0;
+  size_t indirectEdges = 0;
+  size_t uniqueEdges = 0;
+  size_t unresolvedSites = 0;
+  size_t sccs = 0;
+  size_t largestSCC = 0;
+};
+
+// Per-worker task deques: a worker pops its newest task and, when it runs
+// dry, steals the oldest task of another worker.
+class WorkStealingPool {
+public:
+  explicit WorkStealingPool(int nthreads) : queues(nthreads) {}
+
+  void push(int tid, unsigned task) {
+    std::lock_guard<std::mutex> lock(queues[tid].mutex);
+    queues[tid].tasks.push_back(task);
   }
 
-#ifdef PRINT_STATS
-  auto end = std::chrono::high_resolution_clock::now();
-  auto duration =
-      std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+  // Runs taskCount tasks, starting from ready. runTask(tid, task) may push
+  // newly ready tasks. Returns the number of steals.
+  template <typename Run>
+  size_t run(const std::vector<unsigned> &ready, size_t taskCount,
+             Run &&runTask) {
+    for (auto [i, task] : enumerate(ready)) {
+      queues[i % queues.size()].tasks.push_back(task);
+    }
+    std::atomic<size_t> remaining(taskCount);
+    std::atomic<size_t> steals(0);
+    auto worker = [&](int tid) {
+      instrument::ThreadScope scope("worker " + std::to_string(tid));
+      while (remaining.load() > 0) {
+        unsigned task;
+        if (pop(tid, task)) {
+          runTask(tid, task);
+          remaining--;
+        } else if (steal(tid, task)) {
+          steals++;
+          runTask(tid, task);
+          remaining--;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(queues.size());
+    for (unsigned i = 0; i < queues.size(); ++i) {
+      threads.emplace_back(worker, i);
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+    return steals;
+  }
 
-  int mean_size = (task_count > 0) ? total_size / task_count : 0;
-  int var_size = (task_count > 0)
-                     ? (total_size_sq / task_count) - (mean_size * mean_size)
-                     : -(mean_size * mean_size);
-  int mean_time = (task_count > 0) ? total_time / task_count : 0;
-  int var_time = (task_count > 0)
-                     ? (total_time_sq / task_count) - (mean_time * mean_time)
-                     : -(mean_time * mean_time);
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<unsigned> tasks;
+  };
+  std::vector<Queue> queues;
 
-  {
-    std::lock_guard<std::mutex> lock(outsmtx);
-    outs() << "\nThread " << tid << "\ttime:\t" << duration.count() << " ms\n";
-    outs() << "Max task time :\t " << max_time << " ms with\t " << max_size
-           << " BBs\n";
-    outs() << "Tasks processed:\t" << task_count << "\n";
-    outs() << "Task size mean:\t" << mean_size << ", var:\t" << var_size
-           << ", std dev:\t" << (int)std::sqrt(var_size) << "\n";
-    outs() << "Task time mean:\t" << mean_time << ", var:\t" << var_time
-           << ", std dev:\t" << (int)std::sqrt(var_time) << "\n";
+  bool pop(int tid, unsigned &task) {
+    std::lock_guard<std::mutex> lock(queues[tid].mutex);
+    if (queues[tid].tasks.empty())
+      return false;
+    task = queues[tid].tasks.back();
+    queues[tid].tasks.pop_back();
+    return true;
+  }
+
+  bool steal(int tid, unsigned &task) {
+    for (unsigned i = 1; i < queues.size(); ++i) {
+      auto &victim = queues[(tid + i) % queues.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = victim.tasks.front();
+        victim.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+class WholeProgram0CFA {
+public:
+  std::vector<Function *> funcs;
+  std::vector<Value *> values;
+  std::vector<WPNode> nodes;
+  std::vector<CallSite> calls;
+  CallGraphStats cgStats;
+  size_t rounds = 0;
+  size_t tasksRun = 0;
+  size_t steals = 0;
+
+  explicit WholeProgram0CFA(Module &module) {
+    for (auto &func : module) {
+      if (func.isDeclaration())
+        continue;
+      funcIndex[&func] = funcs.size();
+      funcs.push_back(&func);
+    }
+    ownedNodes.resize(funcs.size());
+    callees.resize(funcs.size());
+    for (unsigned i = 0; i < funcs.size(); ++i) {
+      retNodes.push_back(newNode(nullptr, i));
+    }
+    dirty = std::make_unique<std::atomic<bool>[]>(funcs.size());
+
+    for (auto &global : module.globals()) {
+      getNode(&global);
+    }
+    for (auto [i, func] : enumerate(funcs)) {
+      for (auto &arg : func->args()) {
+        getNode(&arg);
+      }
+      for (auto &BB : *func) {
+        for (auto &inst : BB) {
+          unsigned id = getNode(&inst);
+          if (auto *call = dyn_cast<CallBase>(&inst)) {
+            CallSite site{call, id, getNode(call->getCalledOperand()), (int)i,
+                          {}, {}};
+            site.virtualTargets = vtableIndex->resolve(call);
+            for (auto &arg : call->args()) {
+              site.args.push_back(getNode(arg));
+            }
+            if (call->getCalledFunction()) {
+              cgStats.directSites++;
+            } else {
+              cgStats.indirectSites++;
+            }
+            calls.push_back(std::move(site));
+          } else if (auto *ret = dyn_cast<ReturnInst>(&inst)) {
+            if (Value *retVal = ret->getReturnValue()) {
+              addEdge(getNode(retVal), retNodes[i]);
+            }
+          }
+        }
+      }
+    }
+    linkPending();
+  }
+
+  void solve() {
+    for (size_t f = 0; f < funcs.size(); ++f) {
+      dirty[f] = true;
+    }
+    moduleDirty = true;
+    while (true) {
+      if (moduleDirty) {
+        moduleDirty = false;
+        solveLocal(moduleNodes, -1);
+        publish(moduleNodes);
+      }
+      resolveCalls();
+      bool any = false;
+      for (size_t f = 0; f < funcs.size(); ++f) {
+        any |= dirty[f].load();
+      }
+      if (!any)
+        break;
+      solveRound();
+      for (auto &owned : ownedNodes) {
+        publish(owned);
+      }
+    }
+    cgStats.uniqueEdges = 0;
+    for (auto &cs : callees) {
+      cgStats.uniqueEdges += cs.size();
+    }
+    for (auto &site : calls) {
+      if (site.targets.empty())
+        cgStats.unresolvedSites++;
+    }
+  }
+
+private:
+  DenseMap<Value *, unsigned> ids;
+  DenseMap<Function *, int> funcIndex;
+  std::vector<unsigned> retNodes;
+  std::vector<std::vector<unsigned>> ownedNodes;
+  std::vector<unsigned> moduleNodes;
+  std::vector<unsigned> pending;
+  DenseSet<std::pair<unsigned, unsigned>> edges;
+  std::vector<std::set<int>> callees;
+  std::vector<int> sccOf;
+  std::unique_ptr<std::atomic<bool>[]> dirty;
+  bool moduleDirty = false;
+
+  unsigned newNode(Value *val, int owner) {
+    unsigned id = nodes.size();
+    nodes.emplace_back();
+    nodes.back().owner = owner;
+    values.push_back(val);
+    if (owner < 0) {
+      moduleNodes.push_back(id);
+    } else {
+      ownedNodes[owner].push_back(id);
+    }
+    return id;
+  }
+
+  int ownerOf(Value *val) {
+    Function *func = nullptr;
+    if (auto *inst = dyn_cast<Instruction>(val)) {
+      func = inst->getFunction();
+    } else if (auto *arg = dyn_cast<Argument>(val)) {
+      func = arg->getParent();
+    }
+    auto it = funcIndex.find(func);
+    return it == funcIndex.end() ? -1 : it->second;
+  }
+
+  unsigned getNode(Value *val) {
+    auto it = ids.find(val);
+    if (it != ids.end())
+      return it->second;
+    unsigned id = newNode(val, ownerOf(val));
+    ids[val] = id;
+    if (pointsToSelf(val)) {
+      nodes[id].pts.set(id);
+      nodes[id].unpublished = true;
+    }
+    pending.push_back(id);
+    return id;
+  }
+
+  // Adds the dependence edges of new nodes. Deferred so that long dependence
+  // chains do not recurse.
+  void linkPending() {
+    for (size_t i = 0; i < pending.size(); ++i) {
+      unsigned id = pending[i];
+      forEachPtrDep(values[id],
+                    [&](Value *dep) { addEdge(getNode(dep), id); });
+    }
+    pending.clear();
+  }
+
+  bool addEdge(unsigned src, unsigned dst) {
+    if (!edges.insert({src, dst}).second)
+      return false;
+    nodes[src].succs.push_back(dst);
+    nodes[dst].preds.push_back(src);
+    return true;
+  }
+
+  void markDirty(int owner) {
+    if (owner < 0) {
+      moduleDirty = true;
+    } else {
+      dirty[owner] = true;
+    }
+  }
+
+  // Adds argument and return edges for newly resolved call targets.
+  void resolveCalls() {
+    for (auto &site : calls) {
+      if (site.virtualTargets) {
+        for (auto *callee : *site.virtualTargets) {
+          addCallEdge(site, callee);
+        }
+        continue;
+      }
+      for (unsigned target : nodes[site.callee].snap) {
+        addCallEdge(site, dyn_cast_or_null<Function>(values[target]));
+      }
+    }
+    linkPending();
+  }
+
+  void addCallEdge(CallSite &site, Function *callee) {
+    if (!callee || !funcIndex.count(callee))
+      return;
+    if (!site.targets.insert(callee).second)
+      return;
+    int f = funcIndex[callee];
+    if (site.inst->getCalledFunction()) {
+      cgStats.directEdges++;
+    } else {
+      cgStats.indirectEdges++;
+    }
+    callees[site.caller].insert(f);
+    for (unsigned k = 0; k < site.args.size() && k < callee->arg_size(); ++k) {
+      if (addEdge(site.args[k], getNode(callee->getArg(k))))
+        dirty[f] = true;
+    }
+    if (addEdge(retNodes[f], site.call))
+      dirty[site.caller] = true;
+  }
+
+  const SparseBitVector<> &source(unsigned src, int scc) {
+    int owner = nodes[src].owner;
+    bool local = owner < 0 ? scc < 0 : scc >= 0 && sccOf[owner] == scc;
+    return local ? nodes[src].pts : nodes[src].snap;
+  }
+
+  // Pulls preds into the nodes owned by one SCC (or the module for scc < 0)
+  // until none of them changes.
+  void solveLocal(const std::vector<unsigned> &owned, int scc) {
+    std::queue<unsigned> worklist;
+    DenseSet<unsigned> queued;
+    for (unsigned id : owned) {
+      worklist.push(id);
+      queued.insert(id);
+    }
+    while (!worklist.empty()) {
+      unsigned id = worklist.front();
+      worklist.pop();
+      queued.erase(id);
+      instrument::worklistPops();
+      auto &node = nodes[id];
+      bool changed = false;
+      for (unsigned pred : node.preds) {
+        changed |= node.pts |= source(pred, scc);
+      }
+      if (!changed)
+        continue;
+      if (instrument::enabled)
+        instrument::setUnion(node.pts.count());
+      node.unpublished = true;
+      for (unsigned succ : node.succs) {
+        if (&source(succ, scc) == &nodes[succ].pts &&
+            queued.insert(succ).second) {
+          worklist.push(succ);
+        }
+      }
+    }
+  }
+
+  void publish(unsigned id) {
+    auto &node = nodes[id];
+    if (!node.unpublished)
+      return;
+    node.unpublished = false;
+    node.snap = node.pts;
+    for (unsigned succ : node.succs) {
+      if (nodes[succ].owner != node.owner)
+        markDirty(nodes[succ].owner);
+    }
   }
+
+  void publish(const std::vector<unsigned> &owned) {
+    for (unsigned id : owned) {
+      publish(id);
+    }
+  }
+
+  // Tarjan's algorithm on the call graph; SCCs come out callees first.
+  std::vector<std::vector<int>> findSCCs() {
+    std::vector<std::vector<int>> sccs;
+    std::vector<int> index(funcs.size(), -1), low(funcs.size(), 0);
+    std::vector<char> onStack(funcs.size(), 0);
+    std::vector<int> stack;
+    std::vector<std::pair<int, std::set<int>::iterator>> frames;
+    int counter = 0;
+    for (int root = 0; root < (int)funcs.size(); ++root) {
+      if (index[root] >= 0)
+        continue;
+      frames.push_back({root, callees[root].begin()});
+      index[root] = low[root] = counter++;
+      stack.push_back(root);
+      onStack[root] = 1;
+      while (!frames.empty()) {
+        auto &[f, it] = frames.back();
+        if (it != callees[f].end()) {
+          int g = *it++;
+          if (index[g] < 0) {
+            index[g] = low[g] = counter++;
+            stack.push_back(g);
+            onStack[g] = 1;
+            frames.push_back({g, callees[g].begin()});
+          } else if (onStack[g]) {
+            low[f] = std::min(low[f], index[g]);
+          }
+          continue;
+        }
+        int done = f;
+        frames.pop_back();
+        if (!frames.empty()) {
+          int parent = frames.back().first;
+          low[parent] = std::min(low[parent], low[done]);
+        }
+        if (low[done] != index[done])
+          continue;
+        sccs.emplace_back();
+        int member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          onStack[member] = 0;
+          sccs.back().push_back(member);
+        } while (member != done);
+      }
+    }
+    return sccs;
+  }
+
+  void solveRound() {
+    auto sccs = findSCCs();
+    rounds++;
+    cgStats.sccs = sccs.size();
+    sccOf.assign(funcs.size(), -1);
+    for (auto [s, scc] : enumerate(sccs)) {
+      cgStats.largestSCC = std::max(cgStats.largestSCC, scc.size());
+      for (int f : scc) {
+        sccOf[f] = s;
+      }
+    }
+
+    // An SCC becomes ready once all SCCs it calls have finished.
+    std::vector<std::vector<unsigned>> callerSCCs(sccs.size());
+    std::unique_ptr<std::atomic<int>[]> waiting(
+        new std::atomic<int>[sccs.size()]);
+    std::vector<std::set<unsigned>> calleeSCCs(sccs.size());
+    for (int f = 0; f < (int)funcs.size(); ++f) {
+      for (int g : callees[f]) {
+        if (sccOf[g] != sccOf[f])
+          calleeSCCs[sccOf[f]].insert(sccOf[g]);
+      }
+    }
+    std::vector<unsigned> ready;
+    for (unsigned s = 0; s < sccs.size(); ++s) {
+      waiting[s] = calleeSCCs[s].size();
+      for (unsigned c : calleeSCCs[s]) {
+        callerSCCs[c].push_back(s);
+      }
+      if (calleeSCCs[s].empty())
+        ready.push_back(s);
+    }
+
+    std::vector<std::vector<unsigned>> sccNodes(sccs.size());
+    for (auto [s, scc] : enumerate(sccs)) {
+      for (int f : scc) {
+        sccNodes[s].insert(sccNodes[s].end(), ownedNodes[f].begin(),
+                           ownedNodes[f].end());
+      }
+    }
+
+    std::atomic<size_t> ran(0);
+    WorkStealingPool pool(NTHREADS);
+    steals += pool.run(ready, sccs.size(), [&](int tid, unsigned s) {
+      bool run = false;
+      for (int f : sccs[s]) {
+        run |= dirty[f].exchange(false);
+      }
+      if (run) {
+        ran++;
+        // Traced under the name of the SCC's first function.
+        instrument::TaskTimer task(sccNodes[s].size(), funcs[sccs[s][0]]);
+        solveLocal(sccNodes[s], s);
+        for (int f : sccs[s]) {
+          publishReturn(f);
+        }
+      }
+      for (unsigned caller : callerSCCs[s]) {
+        if (--waiting[caller] == 0)
+          pool.push(tid, caller);
+      }
+    });
+    tasksRun += ran;
+  }
+
+  void publishReturn(int f) {
+    auto &node = nodes[retNodes[f]];
+    if (!node.unpublished)
+      return;
+    node.unpublished = false;
+    node.snap = node.pts;
+    // Callers in f's SCC read pts and were solved along with it.
+    for (unsigned succ : node.succs) {
+      int owner = nodes[succ].owner;
+      if (sccOf[owner] != sccOf[f])
+        dirty[owner] = true;
+    }
+  }
+};
+
+void printCallGraph(WholeProgram0CFA &wp, emit::Writer &writer) {
+  auto &os = writer.os();
+  for (auto &site : wp.calls) {
+    if (emit::format != emit::Full) {
+      writer.record("calls", site.inst, site.targets);
+      continue;
+    }
+    os << writer.full(*site.inst) << "\n->";
+    for (auto *target : site.targets) {
+      os << "\t<" << target->getName() << ">\n";
+    }
+    if (site.targets.empty()) {
+      os << "\tempty\n";
+    }
+    os << "\n";
+  }
+}
 #endif
+
+#if defined(KCFA) || defined(KOBJ) || defined(CONTEXT_COMPARE)
+#define CONTEXT_SENSITIVE
+#ifndef CTX_BUDGET
+#define CTX_BUDGET 64
+#endif
+
+// Context-sensitive whole-program CFA. A function is analyzed once per
+// calling context. With call-site sensitivity a context is the last k call
+// sites (k-CFA); with object sensitivity it is the receiver object followed
+// by the context the receiver was allocated in (k-obj), and the receiver is
+// the only object passed to the first parameter.
+//
+// Contexts are interned as (head, tail) pairs into dense IDs, and nodes and
+// abstract objects are dense IDs of (context, value) pairs, so the solver
+// keeps flat tables instead of maps of maps. Context 0 is the empty context:
+// every function is instantiated in it as an entry, and calls into a function
+// that already has the budgeted number of contexts fall back to it. With k=0
+// this is whole-program 0-CFA.
+
+enum ContextKind { CallSiteContext, ObjectContext };
+
+struct ContextStats {
+  size_t contexts = 0;
+  size_t instances = 0;
+  size_t collapsed = 0;
+  size_t nodes = 0;
+  size_t objects = 0;
+  size_t edges = 0;
+  size_t callEdges = 0;
+  size_t indirectSites = 0;
+  size_t indirectTargets = 0;
+  size_t maxTargets = 0;
+  size_t unresolvedSites = 0;
+};
+
+class ContextSensitiveCFA {
+public:
+  std::vector<CallBase *> sites;
+  std::vector<DenseSet<Function *>> siteTargets;
+  ContextStats stats;
+
+  ContextSensitiveCFA(Module &module, ContextKind kind, unsigned k,
+                      unsigned budget)
+      : kind(kind), k(k), budget(budget) {
+    for (auto &func : module) {
+      if (func.isDeclaration())
+        continue;
+      funcIndex[&func] = funcs.size();
+      funcs.push_back(&func);
+    }
+    crossValues.resize(funcs.size());
+    funcCtxs.resize(funcs.size());
+    for (auto [i, func] : enumerate(funcs)) {
+      retIds.push_back(newValue(nullptr, i));
+      for (auto &BB : *func) {
+        for (auto &inst : BB) {
+          if (auto *call = dyn_cast<CallBase>(&inst)) {
+            siteIndex[call] = sites.size();
+            sites.push_back(call);
+            siteVirtual.push_back(vtableIndex->resolve(call));
+          }
+        }
+      }
+    }
+    siteTargets.resize(sites.size());
+    ctxParts.push_back({~0u, 0});
+    ctxLen.push_back(0);
+  }
+
+  void solve() {
+    for (int f = 0; f < funcs.size(); ++f) {
+      instantiate(f, 0);
+    }
+    while (!worklist.empty() || !callQueue.empty()) {
+      while (!worklist.empty()) {
+        unsigned n = worklist.back();
+        worklist.pop_back();
+        queued[n] = false;
+        for (size_t i = 0; i < nodes[n].succs.size(); ++i) {
+          unsigned succ = nodes[n].succs[i];
+          if (nodes[succ].pts |= nodes[n].pts)
+            enqueue(succ);
+        }
+        for (unsigned c : nodes[n].watchers) {
+          if (!callInsts[c].queued) {
+            callInsts[c].queued = true;
+            callQueue.push_back(c);
+          }
+        }
+      }
+      while (!callQueue.empty()) {
+        unsigned c = callQueue.back();
+        callQueue.pop_back();
+        callInsts[c].queued = false;
+        bindCall(c);
+      }
+    }
+
+    stats.contexts = ctxParts.size();
+    stats.nodes = nodes.size();
+    stats.objects = objects.size();
+    stats.edges = edges.size();
+    for (auto [site, targets] : zip(sites, siteTargets)) {
+      stats.callEdges += targets.size();
+      if (site->getCalledFunction())
+        continue;
+      stats.indirectSites++;
+      stats.indirectTargets += targets.size();
+      stats.maxTargets = std::max(stats.maxTargets, (size_t)targets.size());
+      if (targets.empty())
+        stats.unresolvedSites++;
+    }
+  }
+
+private:
+  struct Node {
+    SparseBitVector<> pts;
+    std::vector<unsigned> succs;
+    std::vector<unsigned> watchers;
+  };
+
+  struct CallInstance {
+    unsigned site;
+    unsigned ctx;
+    unsigned callee;
+    unsigned call;
+    SmallVector<unsigned, 4> args;
+    SparseBitVector<> seenCallee;
+    SparseBitVector<> seenReceivers;
+    SmallVector<int, 4> methods;
+    DenseSet<std::pair<int, unsigned>> bound;
+    bool queued = false;
+  };
+
+  ContextKind kind;
+  unsigned k;
+  unsigned budget;
+
+  std::vector<Function *> funcs;
+  DenseMap<Function *, int> funcIndex;
+  DenseMap<CallBase *, unsigned> siteIndex;
+  std::vector<const SmallVectorImpl<Function *> *> siteVirtual;
+
+  std::vector<Value *> values;
+  std::vector<int> valueOwner;
+  DenseMap<Value *, unsigned> valueIds;
+  std::vector<unsigned> retIds;
+
+  std::vector<std::pair<unsigned, unsigned>> ctxParts;
+  std::vector<unsigned> ctxLen;
+  DenseMap<std::pair<unsigned, unsigned>, unsigned> ctxIds;
+
+  std::vector<std::pair<unsigned, unsigned>> objects;
+  DenseMap<std::pair<unsigned, unsigned>, unsigned> objectIds;
+
+  std::vector<Node> nodes;
+  std::vector<unsigned> nodeValue;
+  std::vector<char> queued;
+  DenseMap<std::pair<unsigned, unsigned>, unsigned> nodeIds;
+  DenseSet<std::pair<unsigned, unsigned>> edges;
+  std::vector<unsigned> worklist;
+  std::vector<unsigned> pendingModule;
+
+  DenseSet<std::pair<int, unsigned>> instances;
+  std::vector<std::vector<unsigned>> funcCtxs;
+  // Values that other functions depend on. Their nodes in every context feed
+  // one summary node, so a dependence across functions is a single edge.
+  std::vector<std::vector<unsigned>> crossValues;
+  DenseMap<unsigned, unsigned> summaries;
+
+  std::vector<CallInstance> callInsts;
+  std::vector<unsigned> callQueue;
+
+  unsigned newValue(Value *val, int owner) {
+    values.push_back(val);
+    valueOwner.push_back(owner);
+    return values.size() - 1;
+  }
+
+  unsigned valueId(Value *val) {
+    auto it = valueIds.find(val);
+    if (it != valueIds.end())
+      return it->second;
+    Function *func = nullptr;
+    if (auto *inst = dyn_cast<Instruction>(val)) {
+      func = inst->getFunction();
+    } else if (auto *arg = dyn_cast<Argument>(val)) {
+      func = arg->getParent();
+    }
+    auto owner = funcIndex.find(func);
+    unsigned id =
+        newValue(val, owner == funcIndex.end() ? -1 : owner->second);
+    valueIds[val] = id;
+    return id;
+  }
+
+  unsigned intern(unsigned head, unsigned tail) {
+    auto [it, inserted] = ctxIds.try_emplace({head, tail}, ctxParts.size());
+    if (inserted) {
+      ctxParts.push_back({head, tail});
+      ctxLen.push_back(ctxLen[tail] + 1);
+    }
+    return it->second;
+  }
+
+  unsigned truncate(unsigned ctx, unsigned len) {
+    if (ctxLen[ctx] <= len)
+      return ctx;
+    if (len == 0)
+      return 0;
+    return intern(ctxParts[ctx].first, truncate(ctxParts[ctx].second, len - 1));
+  }
+
+  unsigned push(unsigned ctx, unsigned head) {
+    return k == 0 ? 0 : intern(head, truncate(ctx, k - 1));
+  }
+
+  // Objects allocated in ctx. Call-site sensitivity keeps a single heap.
+  unsigned object(unsigned ctx, unsigned id) {
+    unsigned heap = kind == ObjectContext && k > 0 ? truncate(ctx, k - 1) : 0;
+    auto [it, inserted] = objectIds.try_emplace({heap, id}, objects.size());
+    if (inserted)
+      objects.push_back({heap, id});
+    return it->second;
+  }
+
+  unsigned newNode(unsigned ctx, unsigned id, bool &created) {
+    auto [it, inserted] = nodeIds.try_emplace({ctx, id}, nodes.size());
+    created = inserted;
+    if (inserted)
+      addNode(id);
+    return it->second;
+  }
+
+  unsigned addNode(unsigned id) {
+    nodes.emplace_back();
+    nodeValue.push_back(id);
+    queued.push_back(false);
+    return nodes.size() - 1;
+  }
+
+  unsigned node(unsigned ctx, unsigned id) {
+    bool created;
+    return newNode(ctx, id, created);
+  }
+
+  unsigned moduleNode(Value *val) {
+    bool created;
+    unsigned id = valueId(val);
+    unsigned n = newNode(0, id, created);
+    if (created) {
+      if (pointsToSelf(val))
+        addObject(n, object(0, id));
+      pendingModule.push_back(n);
+    }
+    return n;
+  }
+
+  unsigned valueNode(unsigned ctx, Value *val) {
+    unsigned id = valueId(val);
+    return valueOwner[id] < 0 ? moduleNode(val) : node(ctx, id);
+  }
+
+  void enqueue(unsigned n) {
+    if (!queued[n]) {
+      queued[n] = true;
+      worklist.push_back(n);
+    }
+  }
+
+  void addObject(unsigned n, unsigned obj) {
+    if (nodes[n].pts.test_and_set(obj))
+      enqueue(n);
+  }
+
+  void addEdge(unsigned src, unsigned dst) {
+    if (!edges.insert({src, dst}).second)
+      return;
+    nodes[src].succs.push_back(dst);
+    if (nodes[dst].pts |= nodes[src].pts)
+      enqueue(dst);
+  }
+
+  // Adds the edge from dep to dst, a node of function f in ctx, or of the
+  // module when f is negative.
+  void link(Value *dep, int f, unsigned ctx, unsigned dst) {
+    unsigned id = valueId(dep);
+    int owner = valueOwner[id];
+    if (owner < 0) {
+      addEdge(moduleNode(dep), dst);
+    } else if (owner == f) {
+      addEdge(node(ctx, id), dst);
+    } else {
+      auto [it, inserted] = summaries.try_emplace(id, 0);
+      if (inserted) {
+        it->second = addNode(id);
+        crossValues[owner].push_back(id);
+        for (unsigned depCtx : funcCtxs[owner]) {
+          addEdge(node(depCtx, id), it->second);
+        }
+      }
+      addEdge(summaries[id], dst);
+    }
+  }
+
+  // Module nodes are linked after the function that reached them, so that
+  // long chains of constant expressions do not recurse.
+  void linkPendingModule() {
+    for (size_t i = 0; i < pendingModule.size(); ++i) {
+      unsigned n = pendingModule[i];
+      forEachPtrDep(values[nodeValue[n]],
+                    [&](Value *dep) { link(dep, -1, 0, n); });
+    }
+    pendingModule.clear();
+  }
+
+  void instantiate(int f, unsigned ctx) {
+    if (!instances.insert({f, ctx}).second)
+      return;
+    stats.instances++;
+    funcCtxs[f].push_back(ctx);
+    Function *func = funcs[f];
+    for (auto &arg : func->args()) {
+      unsigned id = valueId(&arg);
+      unsigned n = node(ctx, id);
+      // Unknown callers can only reach the entry instance.
+      if (ctx == 0)
+        addObject(n, object(0, id));
+    }
+    for (auto &BB : *func) {
+      for (auto &inst : BB) {
+        unsigned id = valueId(&inst);
+        unsigned n = node(ctx, id);
+        if (pointsToSelf(&inst))
+          addObject(n, object(ctx, id));
+        forEachPtrDep(&inst, [&](Value *dep) { link(dep, f, ctx, n); });
+        if (auto *call = dyn_cast<CallBase>(&inst)) {
+          addCallInstance(call, ctx, n);
+        } else if (auto *ret = dyn_cast<ReturnInst>(&inst)) {
+          if (Value *retVal = ret->getReturnValue())
+            link(retVal, f, ctx, node(ctx, retIds[f]));
+        }
+      }
+    }
+    for (size_t i = 0; i < crossValues[f].size(); ++i) {
+      unsigned id = crossValues[f][i];
+      addEdge(node(ctx, id), summaries[id]);
+    }
+    linkPendingModule();
+  }
+
+  void addCallInstance(CallBase *call, unsigned ctx, unsigned n) {
+    CallInstance ci;
+    ci.site = siteIndex[call];
+    ci.ctx = ctx;
+    ci.call = n;
+    ci.callee = valueNode(ctx, call->getCalledOperand());
+    for (auto &arg : call->args()) {
+      ci.args.push_back(valueNode(ctx, arg));
+    }
+    unsigned c = callInsts.size();
+    nodes[ci.callee].watchers.push_back(c);
+    if (kind == ObjectContext && !ci.args.empty())
+      nodes[ci.args[0]].watchers.push_back(c);
+    ci.queued = true;
+    callInsts.push_back(std::move(ci));
+    callQueue.push_back(c);
+  }
+
+  // Binds the targets and, with object sensitivity, the receivers that
+  // reached call instance c since it was last bound.
+  void bindCall(unsigned c) {
+    SmallVector<Function *, 4> targets;
+    unsigned site = callInsts[c].site;
+    if (siteVirtual[site]) {
+      if (callInsts[c].seenCallee.empty()) {
+        targets.append(siteVirtual[site]->begin(), siteVirtual[site]->end());
+        callInsts[c].seenCallee.set(0);
+      }
+    } else {
+      SparseBitVector<> fresh;
+      fresh.intersectWithComplement(nodes[callInsts[c].callee].pts,
+                                    callInsts[c].seenCallee);
+      callInsts[c].seenCallee |= fresh;
+      for (unsigned obj : fresh) {
+        if (auto *fn = dyn_cast_or_null<Function>(values[objects[obj].second]))
+          targets.push_back(fn);
+      }
+    }
+    SmallVector<unsigned, 8> receivers, freshReceivers;
+    if (kind == ObjectContext && !callInsts[c].args.empty()) {
+      auto &ci = callInsts[c];
+      for (unsigned obj : nodes[ci.args[0]].pts) {
+        receivers.push_back(obj);
+        if (!ci.seenReceivers.test(obj))
+          freshReceivers.push_back(obj);
+      }
+      for (unsigned obj : freshReceivers) {
+        ci.seenReceivers.set(obj);
+      }
+      // Methods bound earlier only need the new receivers.
+      for (int f : SmallVector<int, 4>(ci.methods)) {
+        for (unsigned obj : freshReceivers) {
+          bind(c, f, push(objects[obj].first, objects[obj].second), obj);
+        }
+      }
+    }
+    for (auto *fn : targets) {
+      auto it = funcIndex.find(fn);
+      if (it == funcIndex.end())
+        continue;
+      siteTargets[site].insert(fn);
+      int f = it->second;
+      auto &ci = callInsts[c];
+      bool receiver = kind == ObjectContext && !ci.args.empty() &&
+                      fn->arg_size() > 0 &&
+                      fn->getArg(0)->getType()->isPointerTy();
+      if (!receiver) {
+        unsigned ctx = kind == ObjectContext
+                           ? ci.ctx
+                           : push(ci.ctx, valueId(sites[site]));
+        bind(c, f, ctx, ~0u);
+        continue;
+      }
+      ci.methods.push_back(f);
+      for (unsigned obj : receivers) {
+        bind(c, f, push(objects[obj].first, objects[obj].second), obj);
+      }
+    }
+  }
+
+  // Binds call instance c to function f in ctx, or in the entry context once
+  // f has used up its budget.
+  void bind(unsigned c, int f, unsigned ctx, unsigned receiver) {
+    bool collapse = ctx != 0 && !instances.count({f, ctx}) &&
+                    funcCtxs[f].size() >= budget;
+    if (collapse)
+      ctx = 0;
+    if (callInsts[c].bound.insert({f, ctx}).second) {
+      if (collapse)
+        stats.collapsed++;
+      instantiate(f, ctx);
+      auto &ci = callInsts[c];
+      Function *func = funcs[f];
+      unsigned first = receiver == ~0u ? 0 : 1;
+      for (unsigned i = first; i < ci.args.size() && i < func->arg_size();
+           ++i) {
+        addEdge(ci.args[i], node(ctx, valueId(func->getArg(i))));
+      }
+      addEdge(node(ctx, retIds[f]), ci.call);
+    }
+    if (receiver != ~0u)
+      addObject(node(ctx, valueId(funcs[f]->getArg(0))), receiver);
+  }
+};
+
+void printSiteTargets(ContextSensitiveCFA &cfa, emit::Writer &writer) {
+  auto &os = writer.os();
+  for (auto [site, targets] : zip(cfa.sites, cfa.siteTargets)) {
+    if (emit::format != emit::Full) {
+      writer.record("calls", site, targets);
+      continue;
+    }
+    os << writer.full(*site) << "\n->";
+    for (auto *target : targets) {
+      os << "\t<" << target->getName() << ">\n";
+    }
+    if (targets.empty()) {
+      os << "\tempty\n";
+    }
+    os << "\n";
+  }
 }
+#endif
 
 int main(int argc, char *argv[]) {
   InitLLVM X(argc, argv);
+  instrument::init(argc, argv);
+  emit::init(argc, argv);
   if (argc < 2) {
     outs() << "Expect IR filename\n";
     exit(1);
@@ -265,7 +1649,11 @@ int main(int argc, char *argv[]) {
   LLVMContext context;
   SMDiagnostic smd;
   char *filename = argv[1];
-  std::unique_ptr<Module> module = parseIRFile(filename, smd, context);
+  std::unique_ptr<Module> module;
+  {
+    instrument::PhaseTimer timer(instrument::Parse);
+    module = parseIRFile(filename, smd, context);
+  }
   if (!module) {
     outs() << "Cannot parse IR file\n";
     smd.print(filename, outs());
@@ -278,59 +1666,192 @@ int main(int argc, char *argv[]) {
 #ifdef CSV
   std::string csvname = std::string(argv[1]) + ".csv";
   std::ofstream csv(csvname);
-  csv << "name,size,inum,time(us)\n";
 #ifndef RUN_COUNT
 #define RUN_COUNT 1
 #endif
+  csv << "# time(us): mean of " << RUN_COUNT
+      << " run(s), each from no shared facts, so it includes solving the "
+         "module-level values the function reads\n";
+  csv << "name," << FuncFeatures::csvHeader() << ",time(us)\n";
 #endif
 
   auto start = std::chrono::high_resolution_clock::now();
+  instrument::PhaseTimer initTimer(instrument::Init);
+  VTableIndex vtables(*module);
+  vtableIndex = &vtables;
+#ifdef SNAPSHOT
+#if defined(WHOLE_PROGRAM) || defined(CONTEXT_SENSITIVE)
+#error "-DSNAPSHOT only applies to the per-function modes"
+#endif
+  snapshot::Module lowered(*module);
+  ir = &lowered;
+  resolveVirtualCalls(*module);
+  outs() << "Snapshot: " << ir->size() << " values, " << ir->bytes() / 1024
+         << " KiB\n";
+#endif
+  initTimer.stop();
+
+#if defined(WHOLE_PROGRAM)
+  outs() << "Whole-program mode, " << NTHREADS << " thread(s)\n";
+  instrument::PhaseTimer buildTimer(instrument::Init);
+  WholeProgram0CFA wp(*module);
+  buildTimer.stop();
+  auto built = std::chrono::high_resolution_clock::now();
+  {
+    instrument::PhaseTimer timer(instrument::Solve);
+    wp.solve();
+  }
+  auto solved = std::chrono::high_resolution_clock::now();
+
+  auto &cg = wp.cgStats;
+  outs() << wp.nodes.size() << " nodes, " << wp.calls.size()
+         << " call sites\n";
+  outs() << "Call sites:\t" << cg.directSites << " direct, "
+         << cg.indirectSites << " indirect, " << cg.unresolvedSites
+         << " unresolved\n";
+  outs() << "Call edges:\t" << cg.directEdges << " direct, "
+         << cg.indirectEdges << " indirect, " << cg.uniqueEdges
+         << " caller-callee pairs\n";
+  outs() << "Call graph:\t" << cg.sccs << " SCCs, largest " << cg.largestSCC
+         << " function(s)\n";
+  outs() << "Rounds:\t" << wp.rounds << ", SCC tasks run: " << wp.tasksRun
+         << ", steals: " << wp.steals << "\n";
+  outs() << "Build time: "
+         << std::chrono::duration_cast<std::chrono::microseconds>(built - start)
+                .count()
+         << " us\n";
+  outs() << "Solve time: "
+         << std::chrono::duration_cast<std::chrono::microseconds>(solved -
+                                                                  built)
+                .count()
+         << " us\n";
+#ifdef PRINT_RESULTS
+  instrument::PhaseTimer timer(instrument::Output);
+  emit::Writer writer(*module, "naive0cfa");
+  printCallGraph(wp, writer);
+  writer.finish();
+#endif
+
+#elif defined(CONTEXT_SENSITIVE)
+#ifdef CONTEXT_COMPARE
+  outs() << "Context-sensitivity comparison, budget " << CTX_BUDGET
+         << " context(s) per function\n";
+  outs() << "mode\tcontexts\tinstances\tcollapsed\tnodes\tcall "
+            "edges\tindirect targets (avg/max)\tunresolved\ttime(us)\n";
+  std::pair<ContextKind, unsigned> modes[] = {{CallSiteContext, 0},
+                                              {CallSiteContext, 1},
+                                              {CallSiteContext, 2},
+                                              {ObjectContext, 1},
+                                              {ObjectContext, 2}};
+#else
+#ifdef KOBJ
+  std::pair<ContextKind, unsigned> modes[] = {{ObjectContext, KOBJ}};
+#else
+  std::pair<ContextKind, unsigned> modes[] = {{CallSiteContext, KCFA}};
+#endif
+#endif
+#ifdef PRINT_RESULTS
+  emit::Writer writer(*module, "naive0cfa");
+#endif
+  for (auto [kind, k] : modes) {
+    auto modeStart = std::chrono::high_resolution_clock::now();
+    instrument::PhaseTimer buildTimer(instrument::Init);
+    ContextSensitiveCFA cfa(*module, kind, k, CTX_BUDGET);
+    buildTimer.stop();
+    {
+      instrument::PhaseTimer timer(instrument::Solve);
+      cfa.solve();
+    }
+    auto modeEnd = std::chrono::high_resolution_clock::now();
+    auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    modeEnd - modeStart)
+                    .count();
+    auto &st = cfa.stats;
+    double avg = st.indirectSites
+                     ? (double)st.indirectTargets / st.indirectSites
+                     : 0.0;
+    std::string mode = (k == 0 ? std::string("0-cfa")
+                        : std::to_string(k) +
+                              (kind == ObjectContext ? "-obj" : "-cfa"));
+#ifdef CONTEXT_COMPARE
+    outs() << mode << "\t" << st.contexts << "\t" << st.instances << "\t"
+           << st.collapsed << "\t" << st.nodes << "\t" << st.callEdges
+           << "\t" << format("%.2f", avg) << "/" << st.maxTargets << "\t"
+           << st.unresolvedSites << "\t" << time << "\n";
+#else
+    outs() << "Context-sensitive mode: " << mode << ", budget " << CTX_BUDGET
+           << " context(s) per function\n";
+    outs() << st.contexts << " context(s), " << st.instances
+           << " function instance(s), " << st.collapsed
+           << " call(s) collapsed to the entry context\n";
+    outs() << st.nodes << " nodes, " << st.objects << " objects, " << st.edges
+           << " edges\n";
+    outs() << "Call edges:\t" << st.callEdges << ", indirect sites: "
+           << st.indirectSites << ", targets avg " << format("%.2f", avg)
+           << ", max " << st.maxTargets << ", unresolved "
+           << st.unresolvedSites << "\n";
+    outs() << "Build and solve time: " << time << " us\n";
+#ifdef PRINT_RESULTS
+    instrument::PhaseTimer timer(instrument::Output);
+    printSiteTargets(cfa, writer);
+#endif
+#endif
+  }
+#ifdef PRINT_RESULTS
+  writer.finish();
+#endif
 
-#ifndef CONCURRENT
+#elif !defined(CONCURRENT)
   outs() << "Sequential mode\n";
   LocalData localdata;
-  auto &callMap = localdata.callMap;
-  auto &points2 = localdata.points2;
-  auto &visited = localdata.visited;
+#ifdef PRINT_RESULTS
+  emit::Writer writer(*module, "naive0cfa");
+#endif
 
-  for (auto &func : *module) {
+  for (auto [i, func] : enumerate(*module)) {
     if (func.isDeclaration())
       continue;
 #ifdef CSV
     std::string fname = func.getName().str();
-    size_t fsize = func.size();
-    int instNum = 0;
-    for (BasicBlock &BB : func) {
-      instNum += BB.size();
-    }
-    int tftime = 0;
+    FuncFeatures features(func);
+    double tftime = 0;
+    size_t virtualCalls = 0;
     for (int r = 0; r < RUN_COUNT; ++r) {
-      callMap.clear();
-      points2.clear();
-      visited.clear();
-
+      sharedFacts.clear();
       auto fstart = std::chrono::high_resolution_clock::now();
 #endif
 
+      localdata.reset();
+#ifdef SNAPSHOT
+      analyzeIntra(i, localdata);
+#else
       analyzeIntra(func, localdata);
+#endif
 
 #ifdef CSV
       auto fend = std::chrono::high_resolution_clock::now();
       auto ftime =
-          std::chrono::duration_cast<std::chrono::microseconds>(fend - fstart)
+          std::chrono::duration_cast<std::chrono::nanoseconds>(fend - fstart)
               .count();
-      tftime += ftime;
+      tftime += ftime / 1000.0;
+      // Every run resolves the same virtual calls; only the first counts.
+      if (r == 0)
+        virtualCalls = vtables.virtualCalls;
+      else
+        vtables.virtualCalls = virtualCalls;
     }
     tftime /= RUN_COUNT;
-    csv << fname << "," << fsize << "," << instNum << "," << tftime << "\n";
+    csv << fname << "," << features.csvRow() << "," << tftime << "\n";
 #endif
 
 #ifdef PRINT_RESULTS
-    outs() << "\nFunction: " << func.getName() << "\n";
-    print();
-    outs() << "******************************** " << func.getName() << "\n";
+    instrument::PhaseTimer timer(instrument::Output);
+    print(func, localdata, writer);
 #endif
   }
+#ifdef PRINT_RESULTS
+  writer.finish();
+#endif
 
 #else
 
@@ -342,8 +1863,11 @@ int main(int argc, char *argv[]) {
   for (auto [i, func] : enumerate(*module)) {
     if (func.isDeclaration())
       continue;
-    taskQ.push({&func, func.size(), (int)i});
+    taskQ.push({&func, func.size(), cfaCost.predict(func), (int)i});
   }
+#ifdef SNAPSHOT
+  module.reset();
+#endif
   std::mutex Qmutex;
   std::vector<std::thread> threads;
   threads.reserve(NTHREADS);
@@ -356,9 +1880,19 @@ int main(int argc, char *argv[]) {
 
 #endif
 
+  outs() << vtables.vtables << " constructed vtable(s) ("
+         << vtables.skippedVTables << " skipped), " << vtables.addressPoints
+         << " address point(s), " << vtables.virtualCalls
+         << " virtual call(s) resolved\n";
+#if !defined(WHOLE_PROGRAM) && !defined(CONTEXT_SENSITIVE)
+  outs() << sharedFacts.size() << " shared module-level fact(s)\n";
+#endif
   auto end = std::chrono::high_resolution_clock::now();
 
   auto duration =
       std::chrono::duration_cast<std::chrono::microseconds>(end - start);
   outs() << "Analysis time: " << duration.count() << " us\n";
-}
\ No newline at end of file
+
+  instrument::report("naive0cfa", filename);
+  return 0;
+}
@@ -0,0 +1,707 @@
+// Benchmarks every analysis over the modules of a corpus directory (default
+// corpus/). Each tool is compiled into its own namespace with its main
+// renamed, so the suite times the same code the tools run. Every benchmark
+// reports mean, median, stddev, min and p99 over REPETITIONS runs (or
+// --benchmark_repetitions), plus operator new calls and bytes per iteration.
+// Use --benchmark_out=<file> --benchmark_out_format=json for machine-readable
+// results (see run.sh). With --sweep, the modules come from irgen.h instead,
+// varying one generator parameter at a time to give scaling curves.
+
+// Every header the tools include must come first, so that their includes
+// are skipped inside the namespaces below.
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/SparseBitVector.h"
+#include "llvm/Analysis/IteratedDominanceFrontier.h"
+#include "llvm/IR/Argument.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSlotTracker.h"
+#include "llvm/IR/User.h"
+#include "llvm/IR/Value.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/Compiler.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <set>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <benchmark/benchmark.h>
+
+#include "../common/arena.h"
+#include "../common/avgpts.h"
+#include "../common/cost.h"
+#include "../common/dataflow.h"
+#include "../common/emit.h"
+#include "../common/instrument.h"
+#include "../common/ptrfilter.h"
+#include "../common/snapshot.h"
+#include "irgen.h"
+
+#ifndef REPETITIONS
+#define REPETITIONS 20
+#endif
+
+#ifndef SWEEP_REPETITIONS
+#define SWEEP_REPETITIONS 5
+#endif
+
+#define NTHREADS 4
+#define WHOLE_PROGRAM
+#define CSR_GRAPH
+#define PARTITION
+#define PARALLEL
+#define SFS
+
+#define main live_main
+namespace live {
+#include "../liveness/live.cpp"
+}
+#undef main
+
+#define main andersen_main
+namespace andersen {
+#include "../points2/p2.cpp"
+}
+#undef main
+
+#define main inter_main
+namespace inter {
+#include "../points2/p2-inter.cpp"
+}
+#undef main
+
+#define main steens_main
+namespace steens {
+#include "../points2/p2-steensgaard.cpp"
+}
+#undef main
+
+#define main onelevel_main
+namespace onelevel {
+#include "../points2/p2-onelevel.cpp"
+}
+#undef main
+
+#define main slice_main
+namespace slice {
+#include "../slice2/slice.cpp"
+}
+#undef main
+
+#define main cfa_main
+namespace cfa {
+#include "../0cfa/naive0cfa.cpp"
+}
+#undef main
+
+using namespace llvm;
+
+std::atomic<size_t> allocCount{0};
+std::atomic<size_t> allocBytes{0};
+
+// The replacements cover every global form, so that any new pairs with the
+// matching delete. All of them go through allocate() and release().
+void *allocate(size_t size, size_t align) {
+  allocCount.fetch_add(1, std::memory_order_relaxed);
+  allocBytes.fetch_add(size, std::memory_order_relaxed);
+  size = size ? size : 1;
+  if (align <= alignof(std::max_align_t))
+    return std::malloc(size);
+  return std::aligned_alloc(align, (size + align - 1) / align * align);
+}
+
+void *operator new(size_t size) {
+  if (void *ptr = allocate(size, 0))
+    return ptr;
+  // LLVM builds without exceptions.
+  std::abort();
+}
+
+void *operator new(size_t size, std::align_val_t align) {
+  if (void *ptr = allocate(size, (size_t)align))
+    return ptr;
+  std::abort();
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return allocate(size, 0);
+}
+
+void *operator new(size_t size, std::align_val_t align,
+                   const std::nothrow_t &) noexcept {
+  return allocate(size, (size_t)align);
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void *operator new[](size_t size, std::align_val_t align) {
+  return operator new(size, align);
+}
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+  return operator new(size, tag);
+}
+void *operator new[](size_t size, std::align_val_t align,
+                     const std::nothrow_t &tag) noexcept {
+  return operator new(size, align, tag);
+}
+
+// Out of line, so that GCC does not see the free() of a delete inlined
+// next to a call of operator new and report a mismatch.
+LLVM_ATTRIBUTE_NOINLINE void release(void *ptr) { std::free(ptr); }
+
+void operator delete(void *ptr) noexcept { release(ptr); }
+void operator delete(void *ptr, size_t) noexcept { release(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { release(ptr); }
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+  release(ptr);
+}
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  release(ptr);
+}
+void operator delete(void *ptr, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  release(ptr);
+}
+void operator delete[](void *ptr) noexcept { release(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { release(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { release(ptr); }
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+  release(ptr);
+}
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  release(ptr);
+}
+void operator delete[](void *ptr, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  release(ptr);
+}
+
+// Runs analyze once per iteration and records allocations per iteration.
+template <typename Analyze>
+void measure(benchmark::State &state, Analyze &&analyze) {
+  size_t count = allocCount.load();
+  size_t bytes = allocBytes.load();
+  for (auto _ : state) {
+    analyze();
+  }
+  state.counters["allocs"] = benchmark::Counter(
+      allocCount.load() - count, benchmark::Counter::kAvgIterations);
+  state.counters["alloc_bytes"] = benchmark::Counter(
+      allocBytes.load() - bytes, benchmark::Counter::kAvgIterations);
+}
+
+void benchLiveness(benchmark::State &state, Module *module) {
+  measure(state, [&] {
+    for (auto &func : *module) {
+      std::unordered_map<BasicBlock *, std::set<Value *>> INs, OUTs;
+      live::findLiveVars(func, INs, OUTs);
+      benchmark::DoNotOptimize(INs);
+    }
+  });
+}
+
+// The other problems of the dataflow framework, through the same driver.
+template <typename Problem>
+void benchDataflow(benchmark::State &state, Module *module) {
+  measure(state, [&] {
+    for (auto &func : *module) {
+      std::unordered_map<BasicBlock *, std::set<Value *>> INs, OUTs;
+      live::findFacts<Problem>(func, INs, OUTs);
+      benchmark::DoNotOptimize(INs);
+    }
+  });
+}
+
+// Lowering the module into a snapshot, which the -DSNAPSHOT builds pay once.
+void benchSnapshot(benchmark::State &state, Module *module) {
+  measure(state, [&] {
+    snapshot::Module ir(*module);
+    benchmark::DoNotOptimize(ir.size());
+  });
+}
+
+// Liveness on a snapshot lowered once outside the timed loop; the facts
+// stay bitsets, as in live.cpp's -DSNAPSHOT build.
+void benchLivenessSnapshot(benchmark::State &state, Module *module) {
+  snapshot::Module ir(*module);
+  measure(state, [&] {
+    for (uint32_t f = 0; f < ir.numFunctions(); ++f) {
+      if (ir.isDeclaration(f))
+        continue;
+      arena::Scope scope;
+      dataflow::SnapshotLiveness problem(ir, f);
+      dataflow::Solver<dataflow::SnapshotLiveness> solver(problem);
+      solver.solve(problem.universe());
+      benchmark::DoNotOptimize(solver.entry(0));
+    }
+  });
+}
+
+void benchAndersen(benchmark::State &state, Module *module) {
+  measure(state, [&] {
+    for (auto &func : *module) {
+      if (func.isDeclaration())
+        continue;
+      andersen::LocalData localdata;
+      andersen::initialize(func, localdata);
+      andersen::solve(localdata);
+      benchmark::DoNotOptimize(localdata);
+    }
+  });
+}
+
+// The defined functions main reaches over direct calls, the ones the
+// inter-procedural engines analyze.
+std::vector<Function *> reachableFunctions(Function *mainFunc) {
+  std::vector<Function *> funcs{mainFunc};
+  DenseSet<Function *> seen{mainFunc};
+  for (unsigned i = 0; i < funcs.size(); ++i) {
+    for (auto &inst : instructions(*funcs[i])) {
+      auto *call = dyn_cast<CallInst>(&inst);
+      Function *cf = call ? call->getCalledFunction() : nullptr;
+      if (cf && !cf->isDeclaration() && seen.insert(cf).second)
+        funcs.push_back(cf);
+    }
+  }
+  return funcs;
+}
+
+// andersen-inter, onelevel and steensgaard are run and their avg_pts
+// (avgpts.h) taken over the functions main reaches, so that the three
+// compare: steensgaard >= onelevel >= andersen-inter, checked by
+// benchPointsToOrder.
+void runAndersenInter(Function *mainFunc) {
+  inter::pt.clear();
+  inter::WLMap.clear();
+  inter::PFG.clear();
+  inter::RM.clear();
+  inter::addReachable(mainFunc);
+  inter::solve();
+}
+
+double andersenInterPointsTo(const std::vector<Function *> &funcs) {
+  avgpts::Mean mean;
+  for (Function *func : funcs) {
+    mean.add(*func, [](Value *val) {
+      auto it = inter::pt.find(val);
+      return it == inter::pt.end() ? 0 : it->second.size();
+    });
+  }
+  return mean.get();
+}
+
+void runOneLevel(Function *mainFunc) {
+  onelevel::ids.clear();
+  onelevel::values.clear();
+  onelevel::copies.clear();
+  onelevel::loads.clear();
+  onelevel::stores.clear();
+  onelevel::storedAt.clear();
+  onelevel::pts.clear();
+  onelevel::added.clear();
+  onelevel::queued.clear();
+  onelevel::classes = onelevel::Classes();
+  onelevel::RM.clear();
+  onelevel::addReachable(mainFunc);
+  onelevel::solve();
+}
+
+double oneLevelPointsTo(const std::vector<Function *> &funcs) {
+  auto objects = onelevel::members();
+  avgpts::Mean mean;
+  for (Function *func : funcs) {
+    mean.add(*func, [&](Value *val) {
+      auto it = onelevel::ids.find(val);
+      return it == onelevel::ids.end()
+                 ? 0
+                 : onelevel::pointsTo(it->second, objects).size();
+    });
+  }
+  return mean.get();
+}
+
+// Over funcs only, as the other two.
+void runSteensgaard(const std::vector<Function *> &funcs) {
+  steens::ds_parent.clear();
+  steens::ds_rank.clear();
+  steens::points2.clear();
+  for (Function *func : funcs) {
+    for (auto &inst : instructions(*func)) {
+      steens::steensgaard(&inst);
+    }
+  }
+}
+
+double steensgaardPointsTo(const std::vector<Function *> &funcs) {
+  auto sizes = steens::pointsToSizes();
+  avgpts::Mean mean;
+  for (Function *func : funcs) {
+    mean.add(*func, [&](Value *val) {
+      auto it = sizes.find(val);
+      return it == sizes.end() ? 0 : it->second;
+    });
+  }
+  return mean.get();
+}
+
+void benchAndersenInter(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  measure(state, [&] { runAndersenInter(mainFunc); });
+  state.counters["avg_pts"] =
+      andersenInterPointsTo(reachableFunctions(mainFunc));
+}
+
+void benchAndersenInterCSR(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  measure(state, [&] {
+    std::vector<Function *> funcs;
+    auto summaries = inter::extractConstraints(*module, funcs);
+    auto graph =
+        inter::assemble(summaries, find(funcs, mainFunc) - funcs.begin());
+    inter::CSRSolver solver(graph);
+    solver.solve();
+    benchmark::DoNotOptimize(solver);
+  });
+}
+
+void benchAndersenInterPartition(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  measure(state, [&] {
+    std::vector<Function *> funcs;
+    auto summaries = inter::extractConstraints(*module, funcs);
+    auto graph =
+        inter::assemble(summaries, find(funcs, mainFunc) - funcs.begin());
+    inter::PartitionedSolver solver(graph);
+    solver.solve();
+    benchmark::DoNotOptimize(solver);
+  });
+}
+
+// Over the functions reachable from main, as andersen-inter and onelevel.
+void benchSteensgaard(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  auto funcs = reachableFunctions(mainFunc);
+  measure(state, [&] { runSteensgaard(funcs); });
+  state.counters["avg_pts"] = steensgaardPointsTo(funcs);
+}
+
+// One-level flow, next to andersen-inter and steensgaard, with the same
+// avg_pts.
+void benchOneLevel(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  measure(state, [&] { runOneLevel(mainFunc); });
+  state.counters["avg_pts"] = oneLevelPointsTo(reachableFunctions(mainFunc));
+}
+
+// Times the three engines back to back and fails unless each coarser one
+// reports at least the avg_pts of the finer one, as it must to cover it.
+void benchPointsToOrder(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  auto funcs = reachableFunctions(mainFunc);
+  measure(state, [&] {
+    runAndersenInter(mainFunc);
+    runOneLevel(mainFunc);
+    runSteensgaard(funcs);
+  });
+  double andersen = andersenInterPointsTo(funcs);
+  double oneLevel = oneLevelPointsTo(funcs);
+  double steensgaard = steensgaardPointsTo(funcs);
+  state.counters["andersen_pts"] = andersen;
+  state.counters["onelevel_pts"] = oneLevel;
+  state.counters["steensgaard_pts"] = steensgaard;
+  if (oneLevel < andersen || steensgaard < oneLevel)
+    state.SkipWithError("avg_pts is not steensgaard >= onelevel >= "
+                        "andersen-inter");
+}
+
+// The whole staged analysis is timed: the unification run as the auxiliary
+// analysis, then the memory SSA and the sparse flow-sensitive solve.
+// avg_pts is over the last run; baseline_pts is the same mean for one
+// flow-insensitive solve that also keeps contents apart, and baseline_us its
+// time, outside the timed loop.
+void benchSparseFlowSensitive(benchmark::State &state, Module *module) {
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    state.SkipWithError("no main function");
+    return;
+  }
+  std::unique_ptr<inter::ConstraintGraph> graph;
+  std::unique_ptr<inter::UnificationSolver> aux;
+  std::unique_ptr<inter::FlowSensitiveSolver<inter::UnificationSolver>> sfs;
+  measure(state, [&] {
+    sfs.reset();
+    aux.reset();
+    std::vector<Function *> funcs;
+    auto summaries = inter::extractConstraints(*module, funcs);
+    graph = std::make_unique<inter::ConstraintGraph>(
+        inter::assemble(summaries, find(funcs, mainFunc) - funcs.begin()));
+    aux = std::make_unique<inter::UnificationSolver>(*graph);
+    aux->solve();
+    sfs = std::make_unique<inter::FlowSensitiveSolver<inter::UnificationSolver>>(
+        *graph, *aux);
+    sfs->build();
+    sfs->solve();
+  });
+  state.counters["avg_pts"] = inter::averagePointsTo(*graph, *sfs);
+  auto start = std::chrono::steady_clock::now();
+  inter::CSRSolver baseline(*graph, true);
+  baseline.solve();
+  state.counters["baseline_us"] =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+  state.counters["baseline_pts"] = inter::averagePointsTo(*graph, baseline);
+  state.counters["versions"] = sfs->numVersions();
+  state.counters["strong"] = sfs->strongUpdates();
+}
+
+// Lowered once outside the timed loop, as for liveness-snapshot.
+void benchSteensgaardParallel(benchmark::State &state, Module *module) {
+  snapshot::Module ir(*module);
+  measure(state, [&] {
+    steens::ConcurrentUnionFind uf(ir.size());
+    steens::parallelSteensgaard(ir, uf);
+    benchmark::DoNotOptimize(uf);
+  });
+}
+
+void benchSlice(benchmark::State &state, Module *module) {
+  measure(state, [&] {
+    slice::SliceScratch scratch;
+    for (auto &func : *module) {
+      if (func.isDeclaration())
+        continue;
+      benchmark::DoNotOptimize(
+          slice::sliceFunc(func, slice::FullSlice, scratch));
+    }
+  });
+}
+
+void bench0CFA(benchmark::State &state, Module *module) {
+  cfa::VTableIndex vtables(*module);
+  cfa::vtableIndex = &vtables;
+  measure(state, [&] {
+    cfa::sharedFacts.clear();
+    cfa::LocalData localdata;
+    for (auto &func : *module) {
+      if (func.isDeclaration())
+        continue;
+      localdata.reset();
+      cfa::analyzeIntra(func, localdata);
+    }
+  });
+}
+
+void benchWholeProgram0CFA(benchmark::State &state, Module *module) {
+  cfa::VTableIndex vtables(*module);
+  cfa::vtableIndex = &vtables;
+  measure(state, [&] {
+    cfa::WholeProgram0CFA wp(*module);
+    wp.solve();
+    benchmark::DoNotOptimize(wp.calls.data());
+  });
+}
+
+double minOf(const std::vector<double> &runs) {
+  return *std::min_element(runs.begin(), runs.end());
+}
+
+// Nearest-rank 99th percentile.
+double p99Of(const std::vector<double> &runs) {
+  std::vector<double> sorted(runs);
+  std::sort(sorted.begin(), sorted.end());
+  size_t rank = (size_t)std::ceil(0.99 * sorted.size());
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+using Analysis = void (*)(benchmark::State &, Module *);
+
+std::pair<const char *, Analysis> analyses[] = {
+    {"liveness", benchLiveness},
+    {"reaching-defs", benchDataflow<dataflow::ReachingDefs>},
+    {"available-exprs", benchDataflow<dataflow::AvailableExprs>},
+    {"very-busy-exprs", benchDataflow<dataflow::VeryBusyExprs>},
+    {"snapshot", benchSnapshot},
+    {"liveness-snapshot", benchLivenessSnapshot},
+    {"andersen", benchAndersen},
+    {"andersen-inter", benchAndersenInter},
+    {"andersen-inter-csr", benchAndersenInterCSR},
+    {"andersen-inter-partition", benchAndersenInterPartition},
+    {"onelevel", benchOneLevel},
+    {"sfs", benchSparseFlowSensitive},
+    {"steensgaard", benchSteensgaard},
+    {"steensgaard-parallel", benchSteensgaardParallel},
+    {"pts-order", benchPointsToOrder},
+    {"slice", benchSlice},
+    {"0cfa", bench0CFA},
+    {"0cfa-wp", benchWholeProgram0CFA},
+};
+
+// Each sweep varies one generator parameter from its default.
+std::pair<const char *, std::vector<double>> sweeps[] = {
+    {"functions", {50, 100, 200, 400, 800}},
+    {"blocks", {10, 20, 40, 80, 160}},
+    {"depth", {0, 1, 2, 3, 4}},
+    {"phi", {0, 0.25, 0.5, 0.75, 1}},
+    {"chain", {1, 2, 4, 8, 16}},
+    {"fanout", {1, 2, 4, 8, 16}},
+    {"indirect", {0, 0.25, 0.5, 0.75, 1}},
+};
+
+size_t instCount(Module *module) {
+  size_t count = 0;
+  for (auto &func : *module) {
+    count += func.getInstructionCount();
+  }
+  return count;
+}
+
+// Registers every analysis on module as <analysis>/<label>.
+void registerModule(const std::string &label, Module *module, int repetitions,
+                    bool sweep) {
+  size_t insts = instCount(module);
+  for (auto [name, run] : analyses) {
+    // The set-based inter-procedural solver already needs seconds for the
+    // smallest generated module, so it and pts-order only run on the corpus.
+    if (sweep && (run == benchAndersenInter || run == benchPointsToOrder))
+      continue;
+    std::string benchName = std::string(name) + "/" + label;
+    auto *bench = benchmark::RegisterBenchmark(
+        benchName.c_str(), [run = run, module, insts](benchmark::State &state) {
+          run(state, module);
+          state.counters["insts"] = insts;
+        });
+    bench->Unit(benchmark::kMicrosecond)
+        ->ReportAggregatesOnly(true)
+        ->ComputeStatistics("min", minOf)
+        ->ComputeStatistics("p99", p99Of);
+    if (repetitions > 0)
+      bench->Repetitions(repetitions);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  bool repetitionsGiven = false;
+  for (int i = 1; i < argc; ++i) {
+    repetitionsGiven |= StringRef(argv[i]).startswith("--benchmark_repetitions");
+  }
+  benchmark::Initialize(&argc, argv);
+  std::string corpus = "corpus";
+  bool sweep = false;
+  for (int i = 1; i < argc; ++i) {
+    if (StringRef(argv[i]) == "--sweep") {
+      sweep = true;
+    } else {
+      corpus = argv[i];
+    }
+  }
+
+  LLVMContext context;
+  std::vector<std::unique_ptr<Module>> modules;
+  if (sweep) {
+    for (auto &[param, values] : sweeps) {
+      for (double value : values) {
+        GenParams params;
+        params.set(param, std::to_string(value));
+        modules.push_back(generateModule(context, params));
+        std::ostringstream label;
+        label << "sweep/" << param << "=" << value;
+        registerModule(label.str(), modules.back().get(),
+                       repetitionsGiven ? 0 : SWEEP_REPETITIONS, true);
+      }
+    }
+  } else {
+    std::vector<std::filesystem::path> files;
+    for (auto &entry : std::filesystem::directory_iterator(corpus)) {
+      auto ext = entry.path().extension();
+      if (ext == ".ll" || ext == ".bc")
+        files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+    if (files.empty()) {
+      errs() << "No .ll or .bc files in " << corpus << "\n";
+      return 1;
+    }
+    for (auto &file : files) {
+      SMDiagnostic smd;
+      auto module = parseIRFile(file.string(), smd, context);
+      if (!module) {
+        smd.print(file.string().c_str(), errs());
+        return 1;
+      }
+      modules.push_back(std::move(module));
+      registerModule(file.stem().string(), modules.back().get(),
+                     repetitionsGiven ? 0 : REPETITIONS, false);
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
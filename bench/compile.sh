@@ -0,0 +1,3 @@
+clang++ -O3 bench.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core irreader` -std=c++17 -lbenchmark -lpthread -o bench
+
+clang++ -O3 irgen.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o irgen
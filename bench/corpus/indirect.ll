@@ -0,0 +1,2141 @@
+@tab0 = global i8* (i8*)* bitcast (i8* (i8*)* @f115 to i8* (i8*)*)
+
+@tab1 = global i8* (i8*)* bitcast (i8* (i8*)* @f143 to i8* (i8*)*)
+
+@tab2 = global i8* (i8*)* bitcast (i8* (i8*)* @f199 to i8* (i8*)*)
+
+@tab3 = global i8* (i8*)* bitcast (i8* (i8*)* @f119 to i8* (i8*)*)
+
+@tab4 = global i8* (i8*)* bitcast (i8* (i8*)* @f115 to i8* (i8*)*)
+
+@tab5 = global i8* (i8*)* bitcast (i8* (i8*)* @f130 to i8* (i8*)*)
+
+@tab6 = global i8* (i8*)* bitcast (i8* (i8*)* @f150 to i8* (i8*)*)
+
+@tab7 = global i8* (i8*)* bitcast (i8* (i8*)* @f48 to i8* (i8*)*)
+
+define i8* @f0(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f131(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f1(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f23(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f2(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f115(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f3(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f15(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f4(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f199(i8* bitcast (i8* (i8*)* @f118 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f5(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f132(i8* bitcast (i8* (i8*)* @f59 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f6(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f117(i8* bitcast (i8* (i8*)* @f167 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f7(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f181(i8* bitcast (i8* (i8*)* @f65 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f8(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f7(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f9(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f98(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f10(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f54(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f11(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f107(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f12(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f86(i8* bitcast (i8* (i8*)* @f22 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f13(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f194(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab1
+  ret i8* %r2
+}
+
+define i8* @f14(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f15(i8* bitcast (i8* (i8*)* @f119 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f15(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f130(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f16(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f29(i8* bitcast (i8* (i8*)* @f101 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f17(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f69(i8* bitcast (i8* (i8*)* @f151 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f18(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f53(i8* bitcast (i8* (i8*)* @f47 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f19(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f10(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f20(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f197(i8* bitcast (i8* (i8*)* @f156 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f21(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f18(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f22(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f153(i8* bitcast (i8* (i8*)* @f94 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f23(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f150(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f24(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f160(i8* bitcast (i8* (i8*)* @f39 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f25(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f185(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f26(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f175(i8* bitcast (i8* (i8*)* @f99 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f27(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f12(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f28(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f189(i8* bitcast (i8* (i8*)* @f180 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f29(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f133(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f30(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f71(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f31(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f68(i8* bitcast (i8* (i8*)* @f105 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f32(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f72(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab2
+  ret i8* %r2
+}
+
+define i8* @f33(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f84(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f34(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f121(i8* bitcast (i8* (i8*)* @f91 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f35(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f153(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f36(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f81(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f37(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f188(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f38(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f90(i8* bitcast (i8* (i8*)* @f21 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f39(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f7(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f40(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f97(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f41(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f23(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f42(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f186(i8* bitcast (i8* (i8*)* @f84 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f43(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f112(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f44(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f79(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f45(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f178(i8* bitcast (i8* (i8*)* @f28 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f46(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f65(i8* bitcast (i8* (i8*)* @f2 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f47(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f132(i8* bitcast (i8* (i8*)* @f43 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f48(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f127(i8* bitcast (i8* (i8*)* @f61 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f49(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f50(i8* bitcast (i8* (i8*)* @f162 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f50(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f54(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f51(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f53(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f52(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f182(i8* bitcast (i8* (i8*)* @f16 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f53(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f115(i8* bitcast (i8* (i8*)* @f120 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f54(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f97(i8* bitcast (i8* (i8*)* @f160 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f55(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f82(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f56(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f146(i8* bitcast (i8* (i8*)* @f90 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f57(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f164(i8* bitcast (i8* (i8*)* @f34 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f58(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f196(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f59(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f161(i8* bitcast (i8* (i8*)* @f29 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f60(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f175(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f61(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f45(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f62(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f45(i8* bitcast (i8* (i8*)* @f57 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f63(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f100(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f64(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f115(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f65(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f96(i8* bitcast (i8* (i8*)* @f140 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f66(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f25(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f67(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f79(i8* bitcast (i8* (i8*)* @f137 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f68(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f129(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f69(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f196(i8* bitcast (i8* (i8*)* @f70 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f70(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f16(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f71(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f120(i8* bitcast (i8* (i8*)* @f38 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f72(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f148(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f73(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f134(i8* bitcast (i8* (i8*)* @f143 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f74(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f133(i8* bitcast (i8* (i8*)* @f131 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f75(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f156(i8* bitcast (i8* (i8*)* @f53 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f76(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f146(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f77(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f128(i8* bitcast (i8* (i8*)* @f1 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f78(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f139(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f79(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f16(i8* bitcast (i8* (i8*)* @f137 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f80(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f68(i8* bitcast (i8* (i8*)* @f63 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f81(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f111(i8* bitcast (i8* (i8*)* @f121 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f82(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f66(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab2
+  ret i8* %r2
+}
+
+define i8* @f83(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f3(i8* bitcast (i8* (i8*)* @f175 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f84(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f62(i8* bitcast (i8* (i8*)* @f158 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab1
+  ret i8* %r2
+}
+
+define i8* @f85(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f183(i8* bitcast (i8* (i8*)* @f50 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f86(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f137(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f87(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f59(i8* bitcast (i8* (i8*)* @f189 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f88(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f154(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f89(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f34(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f90(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f99(i8* bitcast (i8* (i8*)* @f24 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f91(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f139(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f92(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f51(i8* bitcast (i8* (i8*)* @f145 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f93(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f29(i8* bitcast (i8* (i8*)* @f180 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f94(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f18(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f95(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f48(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab2
+  ret i8* %r2
+}
+
+define i8* @f96(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f172(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f97(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f195(i8* bitcast (i8* (i8*)* @f24 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f98(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f131(i8* bitcast (i8* (i8*)* @f90 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f99(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f162(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f100(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f104(i8* bitcast (i8* (i8*)* @f116 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f101(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f49(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f102(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f21(i8* bitcast (i8* (i8*)* @f180 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f103(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f129(i8* bitcast (i8* (i8*)* @f149 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f104(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f71(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f105(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f34(i8* bitcast (i8* (i8*)* @f84 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f106(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f103(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f107(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f120(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f108(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f59(i8* bitcast (i8* (i8*)* @f69 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f109(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f145(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f110(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f164(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f111(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f29(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f112(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f113(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f113(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f2(i8* bitcast (i8* (i8*)* @f25 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f114(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f133(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f115(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f140(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f116(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f98(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f117(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f109(i8* bitcast (i8* (i8*)* @f126 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f118(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f93(i8* bitcast (i8* (i8*)* @f135 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f119(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f143(i8* bitcast (i8* (i8*)* @f72 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f120(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f162(i8* bitcast (i8* (i8*)* @f40 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f121(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f13(i8* bitcast (i8* (i8*)* @f80 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f122(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f57(i8* bitcast (i8* (i8*)* @f109 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f123(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f133(i8* bitcast (i8* (i8*)* @f25 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f124(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f12(i8* bitcast (i8* (i8*)* @f159 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f125(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f13(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f126(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f170(i8* bitcast (i8* (i8*)* @f106 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f127(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f93(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f128(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f61(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f129(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f129(i8* bitcast (i8* (i8*)* @f159 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f130(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f192(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f131(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f174(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f132(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f6(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f133(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f193(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f134(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f123(i8* bitcast (i8* (i8*)* @f122 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f135(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f190(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f136(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f159(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f137(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f99(i8* bitcast (i8* (i8*)* @f38 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f138(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f140(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f139(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f148(i8* bitcast (i8* (i8*)* @f24 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f140(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f139(i8* bitcast (i8* (i8*)* @f21 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f141(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f175(i8* bitcast (i8* (i8*)* @f118 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f142(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f19(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f143(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f177(i8* bitcast (i8* (i8*)* @f77 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f144(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f72(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f145(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f93(i8* bitcast (i8* (i8*)* @f30 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f146(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f112(i8* bitcast (i8* (i8*)* @f135 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f147(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f102(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab5
+  ret i8* %r2
+}
+
+define i8* @f148(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f93(i8* bitcast (i8* (i8*)* @f173 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f149(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f189(i8* bitcast (i8* (i8*)* @f144 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f150(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f151(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f151(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f5(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f152(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f5(i8* bitcast (i8* (i8*)* @f166 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f153(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f85(i8* bitcast (i8* (i8*)* @f20 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f154(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f21(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f155(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f182(i8* bitcast (i8* (i8*)* @f56 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f156(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f195(i8* bitcast (i8* (i8*)* @f117 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f157(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f172(i8* bitcast (i8* (i8*)* @f34 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f158(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f181(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f159(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f0(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f160(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f134(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f161(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f107(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f162(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f175(i8* bitcast (i8* (i8*)* @f42 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f163(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f70(i8* bitcast (i8* (i8*)* @f15 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f164(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f77(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f165(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f15(i8* bitcast (i8* (i8*)* @f192 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab7
+  ret i8* %r2
+}
+
+define i8* @f166(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f80(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f167(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f153(i8* bitcast (i8* (i8*)* @f183 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f168(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f113(i8* bitcast (i8* (i8*)* @f47 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f169(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f160(i8* bitcast (i8* (i8*)* @f140 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f170(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f103(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f171(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f102(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f172(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f135(i8* bitcast (i8* (i8*)* @f132 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f173(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f168(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f174(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f115(i8* bitcast (i8* (i8*)* @f63 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f175(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f106(i8* bitcast (i8* (i8*)* @f40 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab2
+  ret i8* %r2
+}
+
+define i8* @f176(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f132(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab2
+  ret i8* %r2
+}
+
+define i8* @f177(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f52(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f178(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f122(i8* bitcast (i8* (i8*)* @f177 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab4
+  ret i8* %r2
+}
+
+define i8* @f179(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f48(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f180(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f112(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f181(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f40(i8* bitcast (i8* (i8*)* @f79 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f182(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f142(i8* bitcast (i8* (i8*)* @f78 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f183(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f92(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f184(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f191(i8* bitcast (i8* (i8*)* @f31 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f185(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab7
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f60(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f186(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f184(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f187(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab4
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f86(i8* bitcast (i8* (i8*)* @f193 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f188(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f65(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f189(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab1
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f84(i8* bitcast (i8* (i8*)* @f79 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f190(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f114(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab1
+  ret i8* %r2
+}
+
+define i8* @f191(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f173(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f192(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab0
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f118(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab0
+  ret i8* %r2
+}
+
+define i8* @f193(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f31(i8* bitcast (i8* (i8*)* @f111 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f194(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f109(i8* %r1)
+  ret i8* %r2
+}
+
+define i8* @f195(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab2
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f176(i8* bitcast (i8* (i8*)* @f98 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f196(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab6
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f159(i8* bitcast (i8* (i8*)* @f3 to i8*))
+  ret i8* %r2
+}
+
+define i8* @f197(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f62(i8* %r1)
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab3
+  ret i8* %r2
+}
+
+define i8* @f198(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab5
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f78(i8* bitcast (i8* (i8*)* @f166 to i8*))
+  %nf = bitcast i8* %r2 to i8* (i8*)*
+  store i8* (i8*)* %nf, i8* (i8*)** @tab6
+  ret i8* %r2
+}
+
+define i8* @f199(i8* %p) {
+entry:
+  %fp = bitcast i8* %p to i8* (i8*)*
+  %r0 = call i8* %fp(i8* %p)
+  %g = load i8* (i8*)*, i8* (i8*)** @tab3
+  %r1 = call i8* %g(i8* %r0)
+  %r2 = call i8* @f130(i8* bitcast (i8* (i8*)* @f85 to i8*))
+  ret i8* %r2
+}
+
+define i32 @main() {
+entry:
+  %r = call i8* @f0(i8* bitcast (i8* (i8*)* @f1 to i8*))
+  ret i32 0
+}
@@ -0,0 +1,3815 @@
+@g = global i32* null
+
+
+define i32 @f0(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32, i32* %a0
+  %v0_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_2 = load i32, i32* %a0
+  %v0_3 = add i32 %n, %n
+  %c0 = icmp slt i32 %i0n, %n
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %a0
+  %v1_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v1_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v1_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v1_4 = load i32*, i32** %pp
+  store i32 %n, i32* %v1_3
+  store i32 %n, i32* %v0_1
+  %v1_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %c1 = icmp slt i32 %i1n, %v0_2
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  store i32 %v1_0, i32* %v1_1
+  %v2_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v2_3 = load i32*, i32** %pp
+  %v2_4 = load i32, i32* %v2_2
+  %v2_5 = add i32 %v1_0, %n
+  %v2_6 = load i32*, i32** %pp
+  %v2_7 = load i32, i32* %v2_2
+  %c2 = icmp slt i32 %i2n, %v2_5
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = load i32, i32* %v2_0
+  %v3_1 = load i32, i32* %v1_2
+  %v3_2 = add i32 %v0_3, %v0_0
+  store i32 %v3_0, i32* %v2_0
+  %v3_4 = add i32 %v2_7, %v1_0
+  %v3_5 = load i32*, i32** %pp
+  %v3_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_0
+  %c3 = icmp slt i32 %i3n, %v2_5
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = add i32 %v0_2, %v2_7
+  %v4_1 = load i32, i32* %v2_6
+  %v4_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_0
+  store i32 %v4_1, i32* %v1_4
+  %c4 = icmp slt i32 %i4n, %v2_4
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  store i32 %v3_1, i32* %v3_6
+  %v5_1 = load i32, i32* %v4_2
+  %v5_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v5_3 = load i32, i32* %v2_6
+  %v5_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_1
+  %v5_5 = load i32*, i32** %pp
+  %v5_6 = add i32 %v5_1, %v3_1
+  %c5 = icmp slt i32 %i5n, %v4_0
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = load i32, i32* %v5_2
+  %v6_1 = load i32, i32* %v1_2
+  %v6_2 = load i32, i32* %v1_7
+  %v6_3 = add i32 %v1_0, %v2_7
+  %v6_4 = load i32, i32* %v5_4
+  %v6_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_1
+  %v6_6 = load i32, i32* %v2_2
+  %v6_7 = add i32 %v4_1, %v6_0
+  %v6_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %v6_9 = add i32 %v6_4, %v4_0
+  %v6_10 = add i32 %v1_0, %v0_2
+  %v6_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_7
+  %c6 = icmp slt i32 %i6n, %v6_4
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_1
+  %v7_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_1
+  %v7_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  store i32 %v6_2, i32* %v6_8
+  %v7_4 = load i32, i32* %v1_3
+  %c7 = icmp slt i32 %i7n, %v6_6
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = add i32 %v6_3, %v6_4
+  %v8_1 = add i32 %v5_1, %v8_0
+  %v8_2 = add i32 %v8_0, %v6_4
+  %v8_3 = add i32 %v4_0, %v4_0
+  %v8_4 = load i32, i32* %v1_2
+  %v8_5 = load i32, i32* %v3_6
+  %v8_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v8_7 = add i32 %v8_1, %v3_2
+  %v8_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v8_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_1
+  %c8 = icmp slt i32 %i8n, %v2_5
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = load i32*, i32** %pp
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %v9_2 = load i32*, i32** %pp
+  %v9_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_6
+  %v9_4 = add i32 %v6_7, %v8_3
+  %v9_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_4
+  %v9_6 = add i32 %v8_2, %v8_3
+  %c9 = icmp slt i32 %i9n, %v8_3
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_5
+  %v10_1 = add i32 %v5_6, %v8_3
+  %v10_2 = add i32 %v3_2, %v8_7
+  %v10_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_7
+  %v10_4 = load i32, i32* %v0_1
+  %v10_5 = add i32 %v6_2, %v2_4
+  %c10 = icmp slt i32 %i10n, %v5_6
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = load i32, i32* %v2_6
+  %v11_1 = load i32, i32* %v5_2
+  store i32 %v8_5, i32* %v7_1
+  %v11_3 = load i32*, i32** %pp
+  %v11_4 = load i32*, i32** %pp
+  %v11_5 = add i32 %v4_0, %v5_3
+  %v11_6 = add i32 %v5_1, %v4_0
+  store i32 %v6_6, i32* %v0_1
+  %v11_8 = add i32 %v6_0, %v8_3
+  %v11_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_8
+  %c11 = icmp slt i32 %i11n, %v10_4
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = load i32, i32* %v7_2
+  %v12_1 = add i32 %v6_7, %v2_4
+  %v12_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_1
+  %v12_3 = load i32, i32* %v7_1
+  %v12_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_5
+  %v12_5 = add i32 %v10_5, %n
+  %v12_6 = load i32, i32* %v7_2
+  %c12 = icmp slt i32 %i12n, %v11_1
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  ret i32 %n
+}
+
+define i32 @f1(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_1 = add i32 %n, %n
+  %v0_2 = add i32 %v0_1, %v0_1
+  %v0_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_4 = load i32, i32* %v0_0
+  %v0_5 = add i32 %n, %v0_1
+  %v0_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v0_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %v0_8 = add i32 %v0_1, %v0_5
+  %v0_9 = add i32 %v0_4, %v0_8
+  %v0_10 = add i32 %v0_1, %v0_5
+  store i32 %n, i32* %a0
+  %c0 = icmp slt i32 %i0n, %v0_1
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = add i32 %v0_2, %v0_9
+  %v1_1 = add i32 %v0_4, %v0_4
+  %v1_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v1_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v1_4 = add i32 %v0_8, %v0_5
+  store i32 %v0_2, i32* %a0
+  %v1_6 = add i32 %v0_8, %v0_10
+  %v1_7 = load i32*, i32** %pp
+  %v1_8 = add i32 %v1_0, %v0_9
+  %v1_9 = add i32 %v1_0, %v0_2
+  %c1 = icmp slt i32 %i1n, %v1_0
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  store i32 %n, i32* %v1_7
+  %v2_1 = add i32 %v1_1, %n
+  %v2_2 = add i32 %v0_2, %v0_2
+  %v2_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %c2 = icmp slt i32 %i2n, %v0_1
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = load i32*, i32** %pp
+  store i32 %v2_2, i32* %v0_0
+  %v3_2 = add i32 %v0_1, %v0_10
+  %v3_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v3_4 = add i32 %v3_2, %v2_1
+  store i32 %v0_2, i32* %v1_7
+  %v3_6 = load i32, i32* %v2_3
+  %c3 = icmp slt i32 %i3n, %v3_2
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = load i32*, i32** %pp
+  %v4_1 = load i32, i32* %v2_3
+  %v4_2 = add i32 %v3_2, %v0_10
+  %v4_3 = load i32*, i32** %pp
+  %v4_4 = add i32 %v1_0, %v3_4
+  %c4 = icmp slt i32 %i4n, %v0_9
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  ret i32 %n
+}
+
+define i32 @f2(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_1 = load i32, i32* %v0_0
+  %v0_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_3 = load i32, i32* %a0
+  %v0_4 = load i32*, i32** %pp
+  %v0_5 = add i32 %n, %v0_3
+  %v0_6 = load i32*, i32** %pp
+  %v0_7 = load i32, i32* %v0_2
+  %v0_8 = add i32 %v0_5, %v0_1
+  %c0 = icmp slt i32 %i0n, %v0_8
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_4
+  %v1_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v1_2 = add i32 %v0_1, %v0_8
+  %c1 = icmp slt i32 %i1n, %v1_0
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = load i32, i32* %v0_4
+  %v2_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v2_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v2_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  %v2_4 = load i32, i32* %a0
+  %v2_5 = load i32, i32* %v2_3
+  %v2_6 = load i32*, i32** %pp
+  store i32 %v0_1, i32* %v0_0
+  %v2_8 = add i32 %v0_5, %v0_1
+  %v2_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %c2 = icmp slt i32 %i2n, %n
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v3_1 = add i32 %v2_5, %v0_7
+  %v3_2 = load i32, i32* %v2_3
+  %v3_3 = add i32 %v2_4, %v1_2
+  %c3 = icmp slt i32 %i3n, %v2_8
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v4_1 = add i32 %v0_3, %v1_0
+  %v4_2 = add i32 %v2_0, %n
+  %v4_3 = load i32*, i32** %pp
+  %v4_4 = add i32 %v0_3, %v1_2
+  %v4_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %v4_6 = load i32, i32* %v1_1
+  %c4 = icmp slt i32 %i4n, %v4_4
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = add i32 %v2_0, %v0_7
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v5_2 = add i32 %v0_8, %v2_0
+  %v5_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v5_4 = add i32 %v5_2, %v2_4
+  store i32 %v1_0, i32* %v2_6
+  %v5_6 = load i32, i32* %v1_1
+  %v5_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %c5 = icmp slt i32 %i5n, %v2_0
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_2
+  store i32 %v1_0, i32* %v5_3
+  %c6 = icmp slt i32 %i6n, %v4_1
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = add i32 %v0_5, %v5_4
+  %v7_1 = add i32 %v3_2, %v5_4
+  %v7_2 = load i32, i32* %v4_0
+  %v7_3 = add i32 %v2_4, %v5_6
+  %v7_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %c7 = icmp slt i32 %i7n, %v2_5
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = add i32 %v5_6, %v7_0
+  %v8_1 = load i32*, i32** %pp
+  %v8_2 = load i32, i32* %v3_0
+  %v8_3 = add i32 %v7_3, %v0_7
+  %v8_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  %c8 = icmp slt i32 %i8n, %v7_0
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = load i32, i32* %v0_0
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_3
+  %v9_2 = load i32, i32* %v5_3
+  %v9_3 = load i32*, i32** %pp
+  %v9_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %v9_5 = load i32*, i32** %pp
+  %c9 = icmp slt i32 %i9n, %v0_3
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_4
+  %v10_1 = load i32, i32* %v2_3
+  %v10_2 = load i32, i32* %v2_9
+  %v10_3 = add i32 %v5_2, %v4_1
+  %v10_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_0
+  %v10_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_8
+  %v10_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v10_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_4
+  store i32 %v3_1, i32* %v2_2
+  %c10 = icmp slt i32 %i10n, %v10_1
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v11_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %c11 = icmp slt i32 %i11n, %v7_2
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v12_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %c12 = icmp slt i32 %i12n, %v2_4
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = add i32 %v7_1, %v5_2
+  %v13_1 = add i32 %v9_2, %v2_4
+  %v13_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  %v13_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_1
+  %v13_4 = load i32*, i32** %pp
+  %v13_5 = add i32 %v10_1, %v2_0
+  %v13_6 = add i32 %v10_1, %v13_1
+  %v13_7 = add i32 %v0_1, %v13_5
+  %v13_8 = add i32 %v3_3, %v0_8
+  %v13_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  %v13_10 = load i32*, i32** %pp
+  %v13_11 = add i32 %v7_1, %v8_2
+  %c13 = icmp slt i32 %i13n, %v13_0
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = load i32*, i32** %pp
+  %v14_1 = load i32*, i32** %pp
+  %c14 = icmp slt i32 %i14n, %v4_1
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  %v15_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_3
+  %v15_1 = add i32 %v10_1, %v10_3
+  %v15_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %v15_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_0
+  %v15_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v15_5 = add i32 %v4_1, %v3_2
+  %v15_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_11
+  %v15_7 = add i32 %v9_2, %v7_1
+  %v15_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v15_5
+  %c15 = icmp slt i32 %i15n, %v4_6
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  %i16 = phi i32 [ 0, %b15 ], [ %i16n, %b16x ]
+  %i16n = add i32 %i16, 1
+  %v16_0 = load i32*, i32** %pp
+  %v16_1 = load i32*, i32** %pp
+  %c16 = icmp slt i32 %i16n, %v0_7
+  br i1 %c16, label %b16x, label %b17
+b16x:
+  br label %b16
+b17:
+  %i17 = phi i32 [ 0, %b16 ], [ %i17n, %b17x ]
+  %i17n = add i32 %i17, 1
+  %v17_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_2
+  %v17_1 = load i32*, i32** %pp
+  %v17_2 = load i32*, i32** %pp
+  %v17_3 = load i32*, i32** %pp
+  %v17_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_0
+  %v17_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_4
+  %v17_6 = add i32 %v1_0, %v15_7
+  %v17_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_2
+  %v17_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %v17_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_3
+  %v17_10 = load i32, i32* %v2_2
+  %c17 = icmp slt i32 %i17n, %v13_0
+  br i1 %c17, label %b17x, label %b18
+b17x:
+  br label %b17
+b18:
+  %i18 = phi i32 [ 0, %b17 ], [ %i18n, %b18x ]
+  %i18n = add i32 %i18, 1
+  %v18_0 = load i32, i32* %v1_1
+  %v18_1 = add i32 %v0_1, %v4_6
+  %v18_2 = load i32, i32* %v17_2
+  store i32 %v8_2, i32* %v5_7
+  %v18_4 = load i32, i32* %v17_9
+  %c18 = icmp slt i32 %i18n, %v3_2
+  br i1 %c18, label %b18x, label %b19
+b18x:
+  br label %b18
+b19:
+  %i19 = phi i32 [ 0, %b18 ], [ %i19n, %b19x ]
+  %i19n = add i32 %i19, 1
+  store i32 %v2_4, i32* %v15_8
+  store i32 %v7_0, i32* %v2_3
+  %v19_2 = load i32*, i32** %pp
+  %c19 = icmp slt i32 %i19n, %v13_8
+  br i1 %c19, label %b19x, label %b20
+b19x:
+  br label %b19
+b20:
+  %i20 = phi i32 [ 0, %b19 ], [ %i20n, %b20x ]
+  %i20n = add i32 %i20, 1
+  %v20_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v20_1 = add i32 %v3_3, %v9_2
+  %v20_2 = add i32 %v9_2, %v7_2
+  %v20_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v20_4 = add i32 %v15_5, %v8_2
+  %v20_5 = load i32, i32* %v15_6
+  %v20_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_6
+  %v20_7 = load i32, i32* %v2_2
+  %v20_8 = add i32 %n, %v5_2
+  %v20_9 = add i32 %v20_4, %v7_2
+  %c20 = icmp slt i32 %i20n, %v1_2
+  br i1 %c20, label %b20x, label %b21
+b20x:
+  br label %b20
+b21:
+  %i21 = phi i32 [ 0, %b20 ], [ %i21n, %b21x ]
+  %i21n = add i32 %i21, 1
+  %v21_0 = add i32 %v20_9, %v18_0
+  %v21_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_0
+  %v21_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v21_3 = add i32 %v13_5, %v0_7
+  %v21_4 = load i32, i32* %v17_4
+  %c21 = icmp slt i32 %i21n, %v18_1
+  br i1 %c21, label %b21x, label %b22
+b21x:
+  br label %b21
+b22:
+  %i22 = phi i32 [ 0, %b21 ], [ %i22n, %b22x ]
+  %i22n = add i32 %i22, 1
+  %v22_0 = add i32 %v4_4, %v1_0
+  %v22_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v15_1
+  %v22_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v21_3
+  %v22_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_4
+  %v22_4 = load i32, i32* %v14_0
+  %v22_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_0
+  %c22 = icmp slt i32 %i22n, %v18_4
+  br i1 %c22, label %b22x, label %b23
+b22x:
+  br label %b22
+b23:
+  %i23 = phi i32 [ 0, %b22 ], [ %i23n, %b23x ]
+  %i23n = add i32 %i23, 1
+  %v23_0 = add i32 %v20_1, %v18_1
+  %v23_1 = load i32*, i32** %pp
+  %v23_2 = add i32 %v7_3, %v2_5
+  %v23_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v20_2
+  %v23_4 = load i32, i32* %v5_7
+  %v23_5 = load i32*, i32** %pp
+  %v23_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v23_7 = add i32 %v4_2, %v5_4
+  %c23 = icmp slt i32 %i23n, %v21_4
+  br i1 %c23, label %b23x, label %b24
+b23x:
+  br label %b23
+b24:
+  %i24 = phi i32 [ 0, %b23 ], [ %i24n, %b24x ]
+  %i24n = add i32 %i24, 1
+  %v24_0 = load i32, i32* %v13_9
+  %v24_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %v24_2 = load i32, i32* %v10_7
+  %v24_3 = load i32, i32* %v23_5
+  %v24_4 = load i32*, i32** %pp
+  %v24_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  %v24_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v23_2
+  %v24_7 = add i32 %v23_0, %v8_2
+  %c24 = icmp slt i32 %i24n, %v20_9
+  br i1 %c24, label %b24x, label %b25
+b24x:
+  br label %b24
+b25:
+  %i25 = phi i32 [ 0, %b24 ], [ %i25n, %b25x ]
+  %i25n = add i32 %i25, 1
+  %v25_0 = add i32 %v20_9, %v20_5
+  %v25_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v25_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_6
+  %v25_3 = load i32, i32* %v3_0
+  %v25_4 = load i32, i32* %v15_8
+  %v25_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v25_3
+  %v25_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %c25 = icmp slt i32 %i25n, %v20_2
+  br i1 %c25, label %b25x, label %b26
+b25x:
+  br label %b25
+b26:
+  %i26 = phi i32 [ 0, %b25 ], [ %i26n, %b26x ]
+  %i26n = add i32 %i26, 1
+  %v26_0 = load i32, i32* %v22_3
+  %v26_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_3
+  %v26_2 = load i32, i32* %v2_2
+  %v26_3 = load i32, i32* %v24_1
+  %v26_4 = add i32 %v4_2, %v23_2
+  store i32 %v8_0, i32* %v3_0
+  %v26_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_2
+  %v26_7 = load i32, i32* %v26_6
+  %c26 = icmp slt i32 %i26n, %v20_9
+  br i1 %c26, label %b26x, label %b27
+b26x:
+  br label %b26
+b27:
+  %i27 = phi i32 [ 0, %b26 ], [ %i27n, %b27x ]
+  %i27n = add i32 %i27, 1
+  %v27_0 = add i32 %v0_3, %v4_2
+  %v27_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v21_4
+  %v27_2 = add i32 %v22_4, %n
+  %v27_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v24_0
+  %v27_4 = add i32 %v20_9, %v9_2
+  %v27_5 = add i32 %v8_2, %v5_0
+  %v27_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_2
+  %v27_7 = add i32 %v27_5, %v21_0
+  %c27 = icmp slt i32 %i27n, %v2_5
+  br i1 %c27, label %b27x, label %b28
+b27x:
+  br label %b27
+b28:
+  %i28 = phi i32 [ 0, %b27 ], [ %i28n, %b28x ]
+  %i28n = add i32 %i28, 1
+  %v28_0 = add i32 %n, %v4_2
+  %v28_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v28_2 = load i32*, i32** %pp
+  %v28_3 = load i32, i32* %v5_3
+  %v28_4 = load i32*, i32** %pp
+  store i32 %v20_7, i32* %v4_5
+  %v28_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_6
+  store i32 %v26_0, i32* %v9_4
+  %v28_8 = load i32, i32* %v10_5
+  %v28_9 = add i32 %n, %v0_1
+  %c28 = icmp slt i32 %i28n, %v24_2
+  br i1 %c28, label %b28x, label %b29
+b28x:
+  br label %b28
+b29:
+  ret i32 %n
+}
+
+define i32 @f3(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_1 = load i32*, i32** %pp
+  %v0_2 = add i32 %n, %n
+  store i32 %n, i32* %v0_0
+  %v0_4 = add i32 %v0_2, %n
+  %v0_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_6 = add i32 %v0_4, %v0_2
+  %v0_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_8 = load i32*, i32** %pp
+  %c0 = icmp slt i32 %i0n, %v0_4
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_8
+  %v1_1 = load i32, i32* %v0_5
+  %v1_2 = load i32, i32* %v0_5
+  %v1_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v1_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %c1 = icmp slt i32 %i1n, %v1_0
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v2_1 = load i32, i32* %v0_5
+  %v2_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %c2 = icmp slt i32 %i2n, %v1_0
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_1
+  %v3_1 = load i32*, i32** %pp
+  %v3_2 = add i32 %v2_1, %v1_2
+  %v3_3 = add i32 %n, %v0_4
+  %v3_4 = add i32 %n, %v0_6
+  %v3_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %c3 = icmp slt i32 %i3n, %v0_4
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v4_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_1
+  %v4_2 = add i32 %v1_1, %v0_2
+  %v4_3 = add i32 %v0_4, %v1_1
+  %v4_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_4
+  %v4_5 = add i32 %v4_2, %v2_1
+  %v4_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_4
+  %v4_7 = add i32 %v4_5, %v1_1
+  %c4 = icmp slt i32 %i4n, %v1_1
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v5_2 = load i32, i32* %v0_5
+  store i32 %v1_2, i32* %v3_5
+  %v5_4 = load i32, i32* %v2_2
+  %v5_5 = add i32 %v4_5, %v0_4
+  %v5_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  %v5_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_5
+  %v5_8 = add i32 %v1_2, %v3_4
+  %c5 = icmp slt i32 %i5n, %v4_2
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_5
+  %v6_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_3
+  %v6_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v6_3 = load i32, i32* %v0_0
+  %v6_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v6_5 = add i32 %v3_4, %v4_2
+  %v6_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_3
+  %v6_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_4
+  %v6_8 = add i32 %v3_3, %n
+  %c6 = icmp slt i32 %i6n, %v6_3
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = add i32 %v0_4, %n
+  %v7_1 = add i32 %v0_6, %v5_2
+  %v7_2 = add i32 %v4_7, %v4_3
+  %v7_3 = add i32 %v4_5, %v5_2
+  %v7_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  %v7_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_3
+  %v7_6 = add i32 %v3_3, %v7_0
+  %v7_7 = add i32 %v6_3, %v2_1
+  %v7_8 = load i32, i32* %v3_0
+  %v7_9 = load i32, i32* %v6_6
+  %v7_10 = add i32 %v0_4, %v5_4
+  %v7_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_2
+  %c7 = icmp slt i32 %i7n, %v1_1
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = load i32, i32* %v5_7
+  %v8_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_5
+  %v8_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_7
+  %v8_3 = add i32 %v1_0, %v5_4
+  %v8_4 = load i32*, i32** %pp
+  %c8 = icmp slt i32 %i8n, %v4_5
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = load i32, i32* %v7_5
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_2
+  %v9_2 = load i32, i32* %v4_4
+  %c9 = icmp slt i32 %i9n, %v9_2
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = add i32 %v5_8, %v5_8
+  %v10_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_5
+  %v10_2 = load i32, i32* %v4_6
+  %v10_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  %v10_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  %v10_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_3
+  %v10_6 = load i32, i32* %v6_6
+  %v10_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_2
+  store i32 %v4_7, i32* %v1_3
+  %v10_9 = load i32*, i32** %pp
+  %v10_10 = add i32 %v1_2, %n
+  %v10_11 = load i32, i32* %v4_1
+  %c10 = icmp slt i32 %i10n, %v7_8
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_8
+  %v11_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %v11_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_6
+  %v11_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v11_4 = load i32, i32* %v3_1
+  %v11_5 = load i32, i32* %v4_6
+  %v11_6 = add i32 %n, %v1_2
+  %c11 = icmp slt i32 %i11n, %v11_4
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  ret i32 %n
+}
+
+define i32 @f4(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32, i32* %a0
+  %v0_1 = load i32, i32* %a0
+  %v0_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v0_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v0_4 = load i32*, i32** %pp
+  %v0_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_6 = add i32 %v0_0, %v0_1
+  %v0_7 = load i32, i32* %v0_5
+  %v0_8 = load i32, i32* %v0_2
+  %v0_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  store i32 %n, i32* %v0_4
+  %c0 = icmp slt i32 %i0n, %n
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32*, i32** %pp
+  %v1_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v1_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v1_3 = load i32, i32* %v0_5
+  %v1_4 = load i32, i32* %v0_5
+  %v1_5 = load i32*, i32** %pp
+  %v1_6 = load i32, i32* %a0
+  %v1_7 = load i32, i32* %v1_5
+  %c1 = icmp slt i32 %i1n, %v0_8
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = load i32, i32* %v0_9
+  %v2_1 = load i32*, i32** %pp
+  %v2_2 = load i32, i32* %v1_0
+  %v2_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v2_4 = load i32, i32* %v0_3
+  %v2_5 = load i32, i32* %v0_2
+  %v2_6 = load i32, i32* %v0_9
+  %v2_7 = load i32, i32* %v0_3
+  %c2 = icmp slt i32 %i2n, %v0_7
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v3_1 = load i32*, i32** %pp
+  %c3 = icmp slt i32 %i3n, %v2_4
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  store i32 %v2_2, i32* %v2_3
+  store i32 %v0_7, i32* %v0_9
+  %v4_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %c4 = icmp slt i32 %i4n, %v0_1
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = load i32, i32* %v3_0
+  %v5_1 = add i32 %v1_3, %v1_7
+  %v5_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %c5 = icmp slt i32 %i5n, %v2_7
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  %v6_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v6_2 = load i32*, i32** %pp
+  %v6_3 = add i32 %v2_4, %v1_3
+  %v6_4 = add i32 %v0_8, %v6_3
+  %v6_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  %v6_6 = add i32 %v0_8, %v2_4
+  %c6 = icmp slt i32 %i6n, %v2_2
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_3
+  %v7_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_1
+  %v7_2 = add i32 %v0_0, %v2_0
+  %c7 = icmp slt i32 %i7n, %v0_6
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  store i32 %v5_1, i32* %v7_0
+  %v8_1 = add i32 %v6_6, %v2_5
+  %v8_2 = load i32, i32* %v1_1
+  %v8_3 = load i32, i32* %v7_1
+  %v8_4 = load i32, i32* %v6_0
+  %v8_5 = load i32, i32* %a0
+  %v8_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_7
+  %v8_7 = load i32, i32* %v4_2
+  %c8 = icmp slt i32 %i8n, %v8_3
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v2_6, %v8_5
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_7
+  %v9_2 = load i32, i32* %v0_3
+  %v9_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_5
+  %v9_4 = load i32, i32* %v4_2
+  store i32 %v7_2, i32* %v0_2
+  %v9_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v9_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_2
+  %v9_8 = load i32, i32* %v9_1
+  store i32 %v0_6, i32* %v9_3
+  store i32 %v8_3, i32* %v7_0
+  %c9 = icmp slt i32 %i9n, %v1_6
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = add i32 %v1_4, %v2_4
+  %v10_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_8
+  %c10 = icmp slt i32 %i10n, %v6_3
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = load i32*, i32** %pp
+  %v11_1 = add i32 %v2_6, %v0_7
+  %v11_2 = add i32 %v5_0, %v2_0
+  %v11_3 = load i32, i32* %v6_5
+  %c11 = icmp slt i32 %i11n, %v5_1
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_0
+  %v12_1 = add i32 %v9_4, %v2_5
+  store i32 %v10_0, i32* %v1_1
+  %v12_3 = load i32, i32* %v0_2
+  %v12_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_4
+  %v12_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_1
+  %v12_6 = load i32*, i32** %pp
+  %v12_7 = add i32 %v2_0, %v5_0
+  %v12_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_1
+  %c12 = icmp slt i32 %i12n, %v0_6
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = add i32 %v9_0, %v11_3
+  store i32 %v1_3, i32* %v6_0
+  %v13_2 = add i32 %v8_4, %v8_2
+  %v13_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_2
+  store i32 %v8_2, i32* %v7_1
+  %v13_5 = add i32 %v9_0, %v2_6
+  %v13_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %v13_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_1
+  %v13_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_2
+  %v13_9 = add i32 %v12_3, %v6_6
+  %v13_10 = add i32 %v0_1, %v2_6
+  %v13_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_0
+  %c13 = icmp slt i32 %i13n, %v13_2
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = load i32, i32* %v9_1
+  %v14_1 = add i32 %v1_6, %v9_8
+  %v14_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_5
+  %v14_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %v14_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_1
+  %v14_5 = load i32, i32* %v12_8
+  %v14_6 = load i32, i32* %v4_2
+  %v14_7 = load i32, i32* %v6_5
+  %c14 = icmp slt i32 %i14n, %v12_3
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  %v15_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_0
+  %v15_1 = add i32 %v2_0, %v1_6
+  %v15_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_7
+  %v15_3 = add i32 %v9_0, %v1_3
+  %c15 = icmp slt i32 %i15n, %v0_7
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  %i16 = phi i32 [ 0, %b15 ], [ %i16n, %b16x ]
+  %i16n = add i32 %i16, 1
+  %v16_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_9
+  %v16_1 = add i32 %v8_4, %v5_0
+  %v16_2 = add i32 %v0_6, %v13_5
+  %v16_3 = add i32 %v8_1, %v12_7
+  %v16_4 = load i32*, i32** %pp
+  %v16_5 = load i32, i32* %v12_8
+  %v16_6 = add i32 %v2_7, %v2_0
+  %v16_7 = add i32 %v0_1, %v0_6
+  store i32 %v8_4, i32* %v2_3
+  %v16_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %v16_10 = add i32 %v1_3, %n
+  %v16_11 = load i32*, i32** %pp
+  %c16 = icmp slt i32 %i16n, %v13_9
+  br i1 %c16, label %b16x, label %b17
+b16x:
+  br label %b16
+b17:
+  %i17 = phi i32 [ 0, %b16 ], [ %i17n, %b17x ]
+  %i17n = add i32 %i17, 1
+  %v17_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  store i32 %v13_5, i32* %v12_6
+  %v17_2 = load i32*, i32** %pp
+  %v17_3 = load i32, i32* %v14_2
+  %v17_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_4
+  %c17 = icmp slt i32 %i17n, %v0_7
+  br i1 %c17, label %b17x, label %b18
+b17x:
+  br label %b17
+b18:
+  %i18 = phi i32 [ 0, %b17 ], [ %i18n, %b18x ]
+  %i18n = add i32 %i18, 1
+  %v18_0 = load i32*, i32** %pp
+  %v18_1 = add i32 %v14_5, %v15_3
+  %v18_2 = load i32, i32* %v13_3
+  %v18_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v16_5
+  %v18_4 = load i32, i32* %v12_0
+  %v18_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_5
+  %c18 = icmp slt i32 %i18n, %v9_0
+  br i1 %c18, label %b18x, label %b19
+b18x:
+  br label %b18
+b19:
+  %i19 = phi i32 [ 0, %b18 ], [ %i19n, %b19x ]
+  %i19n = add i32 %i19, 1
+  %v19_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_3
+  %v19_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_5
+  %v19_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_2
+  %v19_3 = add i32 %v18_1, %v14_0
+  %c19 = icmp slt i32 %i19n, %v18_2
+  br i1 %c19, label %b19x, label %b20
+b19x:
+  br label %b19
+b20:
+  %i20 = phi i32 [ 0, %b19 ], [ %i20n, %b20x ]
+  %i20n = add i32 %i20, 1
+  %v20_0 = add i32 %v5_1, %v13_2
+  store i32 %v16_6, i32* %v15_2
+  %v20_2 = add i32 %v11_1, %v12_3
+  %v20_3 = load i32*, i32** %pp
+  %v20_4 = add i32 %v8_7, %v2_0
+  %v20_5 = add i32 %v0_0, %v7_2
+  %c20 = icmp slt i32 %i20n, %v11_1
+  br i1 %c20, label %b20x, label %b21
+b20x:
+  br label %b20
+b21:
+  %i21 = phi i32 [ 0, %b20 ], [ %i21n, %b21x ]
+  %i21n = add i32 %i21, 1
+  %v21_0 = add i32 %v8_4, %v6_6
+  %v21_1 = add i32 %v13_5, %v8_3
+  %v21_2 = add i32 %v13_9, %v9_4
+  %v21_3 = load i32, i32* %v19_0
+  %v21_4 = load i32*, i32** %pp
+  %c21 = icmp slt i32 %i21n, %v21_1
+  br i1 %c21, label %b21x, label %b22
+b21x:
+  br label %b21
+b22:
+  ret i32 %n
+}
+
+define i32 @f5(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = add i32 %n, %n
+  %v0_1 = load i32, i32* %a0
+  store i32 %v0_0, i32* %a0
+  %v0_3 = load i32, i32* %a0
+  store i32 %v0_0, i32* %a0
+  %v0_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v0_7 = load i32, i32* %a0
+  %v0_8 = add i32 %n, %n
+  %c0 = icmp slt i32 %i0n, %v0_0
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32*, i32** %pp
+  %v1_1 = load i32*, i32** %pp
+  %v1_2 = add i32 %n, %v0_7
+  %v1_3 = add i32 %v0_0, %v1_2
+  %v1_4 = add i32 %v0_0, %v1_2
+  %v1_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v1_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v1_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v1_8 = add i32 %v0_7, %v1_3
+  %v1_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v1_10 = add i32 %v0_3, %v0_7
+  %v1_11 = load i32, i32* %v1_6
+  %c1 = icmp slt i32 %i1n, %v0_7
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = load i32, i32* %v1_1
+  %v2_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  %c2 = icmp slt i32 %i2n, %v0_8
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = add i32 %v1_8, %v1_4
+  %v3_1 = load i32, i32* %v1_1
+  %v3_2 = load i32*, i32** %pp
+  %v3_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v3_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v3_5 = add i32 %v0_8, %v1_3
+  %v3_6 = add i32 %v1_2, %v0_1
+  %c3 = icmp slt i32 %i3n, %v1_8
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = load i32, i32* %v1_9
+  %v4_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v4_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_5
+  %v4_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %c4 = icmp slt i32 %i4n, %v3_5
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = load i32, i32* %v1_9
+  store i32 %v0_8, i32* %v2_1
+  %v5_2 = add i32 %v1_3, %v3_5
+  %v5_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v5_4 = load i32, i32* %v1_0
+  %v5_5 = load i32*, i32** %pp
+  %v5_6 = load i32, i32* %v3_4
+  %v5_7 = add i32 %v0_1, %v3_0
+  %v5_8 = add i32 %n, %v1_11
+  %v5_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v5_10 = load i32, i32* %v5_5
+  %c5 = icmp slt i32 %i5n, %v3_6
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = load i32, i32* %v1_7
+  %v6_1 = add i32 %v0_7, %v4_0
+  store i32 %v5_7, i32* %v0_5
+  %v6_3 = load i32, i32* %v3_2
+  %c6 = icmp slt i32 %i6n, %v3_6
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = add i32 %v3_1, %v5_6
+  store i32 %v1_10, i32* %v1_5
+  %v7_2 = load i32, i32* %v1_9
+  store i32 %v0_7, i32* %v3_2
+  %c7 = icmp slt i32 %i7n, %v3_1
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = add i32 %v1_3, %v3_6
+  %v8_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_8
+  %v8_2 = add i32 %v6_1, %v6_1
+  %v8_3 = load i32*, i32** %pp
+  %v8_4 = add i32 %v3_5, %v5_4
+  %v8_5 = load i32*, i32** %pp
+  %v8_6 = load i32, i32* %v1_7
+  %v8_7 = load i32, i32* %v1_6
+  %v8_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v8_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v8_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_8
+  %v8_11 = add i32 %v5_2, %v5_2
+  %c8 = icmp slt i32 %i8n, %v6_3
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_10
+  %v9_2 = load i32, i32* %a0
+  %v9_3 = load i32, i32* %v9_0
+  %v9_4 = load i32, i32* %v1_7
+  store i32 %v5_0, i32* %v4_2
+  %c9 = icmp slt i32 %i9n, %v0_0
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_0
+  %v10_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_5
+  %v10_2 = add i32 %v6_3, %v9_2
+  store i32 %v6_1, i32* %v10_0
+  %c10 = icmp slt i32 %i10n, %v3_1
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = add i32 %v9_3, %v3_1
+  %v11_1 = load i32*, i32** %pp
+  %v11_2 = load i32*, i32** %pp
+  %v11_3 = load i32, i32* %v3_2
+  %v11_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v11_5 = add i32 %v3_5, %v6_0
+  %v11_6 = add i32 %v11_0, %v1_10
+  %v11_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_3
+  %v11_8 = load i32, i32* %v0_5
+  %v11_9 = load i32*, i32** %pp
+  %v11_10 = load i32, i32* %v3_3
+  %v11_11 = add i32 %v5_4, %n
+  %c11 = icmp slt i32 %i11n, %v5_10
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = add i32 %v1_2, %v0_1
+  %v12_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_0
+  %v12_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  store i32 %v1_2, i32* %v11_1
+  store i32 %v11_10, i32* %v11_2
+  store i32 %v11_0, i32* %v8_9
+  store i32 %v6_1, i32* %v11_1
+  %v12_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_6
+  %v12_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_4
+  %c12 = icmp slt i32 %i12n, %v1_3
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = load i32, i32* %v1_0
+  %v13_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_10
+  %v13_2 = load i32, i32* %a0
+  %v13_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_1
+  %v13_4 = load i32*, i32** %pp
+  %v13_5 = load i32*, i32** %pp
+  store i32 %v1_2, i32* %v4_2
+  %v13_7 = load i32, i32* %v9_0
+  %v13_8 = add i32 %v8_6, %v3_1
+  %v13_9 = add i32 %v6_0, %v7_2
+  %v13_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %c13 = icmp slt i32 %i13n, %v13_2
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = add i32 %v11_0, %v2_0
+  %v14_1 = load i32, i32* %v12_2
+  %v14_2 = add i32 %v13_9, %v1_8
+  %c14 = icmp slt i32 %i14n, %v5_7
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  %v15_0 = load i32*, i32** %pp
+  %v15_1 = add i32 %v13_9, %v6_1
+  %v15_2 = load i32, i32* %v5_9
+  %v15_3 = add i32 %v11_3, %v1_4
+  %v15_4 = add i32 %v8_0, %v5_7
+  %v15_5 = add i32 %v3_1, %v4_0
+  %v15_6 = add i32 %v11_6, %v3_6
+  %v15_7 = add i32 %v11_6, %v1_11
+  %v15_8 = load i32, i32* %v5_5
+  %v15_9 = load i32, i32* %v13_5
+  %v15_10 = load i32, i32* %v11_2
+  %v15_11 = load i32, i32* %v13_3
+  %c15 = icmp slt i32 %i15n, %v1_10
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  %i16 = phi i32 [ 0, %b15 ], [ %i16n, %b16x ]
+  %i16n = add i32 %i16, 1
+  %v16_0 = add i32 %v5_2, %v9_4
+  %v16_1 = add i32 %v1_3, %v1_10
+  %v16_2 = add i32 %v11_3, %v4_0
+  store i32 %v11_8, i32* %v13_4
+  store i32 %v0_0, i32* %v4_1
+  %v16_5 = add i32 %v9_3, %v8_4
+  %v16_6 = load i32*, i32** %pp
+  store i32 %v7_2, i32* %v3_3
+  %v16_8 = add i32 %v11_8, %v5_2
+  %v16_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_8
+  %v16_10 = add i32 %v5_6, %v1_11
+  %v16_11 = load i32*, i32** %pp
+  %c16 = icmp slt i32 %i16n, %v16_5
+  br i1 %c16, label %b16x, label %b17
+b16x:
+  br label %b16
+b17:
+  %i17 = phi i32 [ 0, %b16 ], [ %i17n, %b17x ]
+  %i17n = add i32 %i17, 1
+  %v17_0 = add i32 %v6_0, %v15_8
+  %v17_1 = load i32*, i32** %pp
+  store i32 %v15_1, i32* %v13_10
+  %v17_3 = add i32 %v16_8, %v3_5
+  %v17_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_2
+  %v17_5 = add i32 %v15_5, %v15_8
+  store i32 %v15_6, i32* %v11_1
+  %v17_7 = add i32 %v15_7, %v8_2
+  %v17_8 = load i32, i32* %v12_1
+  store i32 %n, i32* %v3_2
+  %v17_10 = add i32 %v15_4, %v16_10
+  %v17_11 = load i32, i32* %v5_9
+  %c17 = icmp slt i32 %i17n, %v15_4
+  br i1 %c17, label %b17x, label %b18
+b17x:
+  br label %b17
+b18:
+  ret i32 %n
+}
+
+define i32 @f6(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32, i32* %a0
+  %v0_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v0_2 = load i32*, i32** %pp
+  %v0_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_4 = load i32*, i32** %pp
+  %v0_5 = add i32 %v0_0, %n
+  store i32 %v0_0, i32* %v0_1
+  %v0_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %c0 = icmp slt i32 %i0n, %v0_0
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v1_1 = add i32 %v0_0, %v0_0
+  %v1_2 = load i32, i32* %v0_4
+  store i32 %v0_0, i32* %v0_2
+  %v1_4 = load i32, i32* %v0_3
+  %v1_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v1_6 = add i32 %v0_5, %v0_5
+  %v1_7 = add i32 %v1_1, %v0_5
+  store i32 %v1_2, i32* %v0_7
+  %v1_9 = add i32 %v1_7, %v0_0
+  %v1_10 = load i32, i32* %v0_7
+  %v1_11 = add i32 %v0_5, %v1_10
+  %c1 = icmp slt i32 %i1n, %v1_11
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = add i32 %n, %v1_6
+  %v2_1 = add i32 %v1_6, %v1_9
+  store i32 %v1_6, i32* %v0_4
+  %c2 = icmp slt i32 %i2n, %v0_0
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_7
+  %v3_1 = load i32*, i32** %pp
+  %c3 = icmp slt i32 %i3n, %v1_11
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = add i32 %v1_9, %v1_10
+  %v4_1 = load i32, i32* %v0_2
+  %c4 = icmp slt i32 %i4n, %v1_11
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = load i32*, i32** %pp
+  store i32 %v1_11, i32* %v0_1
+  %v5_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_11
+  %v5_3 = load i32*, i32** %pp
+  %v5_4 = load i32*, i32** %pp
+  %v5_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_11
+  %v5_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v5_7 = load i32, i32* %v0_3
+  %v5_8 = add i32 %n, %v2_0
+  %v5_9 = add i32 %v1_2, %v1_10
+  store i32 %v1_9, i32* %v3_1
+  %v5_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %c5 = icmp slt i32 %i5n, %v1_11
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = load i32, i32* %v0_1
+  %v6_1 = load i32, i32* %v5_11
+  %c6 = icmp slt i32 %i6n, %v0_0
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = add i32 %v4_0, %v6_0
+  %v7_1 = load i32*, i32** %pp
+  %v7_2 = load i32, i32* %v0_2
+  %c7 = icmp slt i32 %i7n, %n
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = load i32, i32* %v0_4
+  %v8_1 = load i32, i32* %v5_4
+  store i32 %v0_5, i32* %v5_6
+  %v8_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v8_4 = load i32*, i32** %pp
+  %v8_5 = load i32, i32* %a0
+  %v8_6 = load i32*, i32** %pp
+  %v8_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %v8_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v8_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v8_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_0
+  %v8_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_1
+  %c8 = icmp slt i32 %i8n, %v8_1
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v2_0, %v8_5
+  %v9_1 = add i32 %v8_0, %v1_2
+  %v9_2 = add i32 %v0_5, %v1_10
+  %v9_3 = load i32*, i32** %pp
+  %c9 = icmp slt i32 %i9n, %v8_0
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = load i32, i32* %v3_0
+  %v10_1 = add i32 %v0_0, %v8_0
+  %v10_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v10_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_0
+  %v10_4 = load i32*, i32** %pp
+  %v10_5 = load i32*, i32** %pp
+  %v10_6 = load i32, i32* %v3_1
+  %v10_7 = add i32 %v1_4, %v10_6
+  %v10_8 = add i32 %v10_7, %v1_1
+  %c10 = icmp slt i32 %i10n, %v7_0
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = add i32 %v10_0, %v10_6
+  %v11_1 = load i32*, i32** %pp
+  %v11_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_7
+  %v11_3 = load i32, i32* %v5_0
+  %v11_4 = load i32*, i32** %pp
+  %v11_5 = load i32, i32* %v8_10
+  %v11_6 = add i32 %v10_0, %v5_9
+  %c11 = icmp slt i32 %i11n, %v11_6
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v12_1 = load i32*, i32** %pp
+  %v12_2 = load i32*, i32** %pp
+  %v12_3 = add i32 %v7_2, %n
+  %v12_4 = add i32 %v6_1, %v12_3
+  %v12_5 = load i32, i32* %v5_6
+  %v12_6 = load i32, i32* %v8_10
+  %c12 = icmp slt i32 %i12n, %v12_4
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = add i32 %v6_0, %n
+  %v13_1 = load i32, i32* %v7_1
+  %v13_2 = load i32, i32* %v0_2
+  %v13_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_10
+  %v13_4 = add i32 %v11_6, %v1_10
+  %c13 = icmp slt i32 %i13n, %v5_9
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  ret i32 %n
+}
+
+define i32 @f7(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32*, i32** %pp
+  %v0_1 = add i32 %n, %n
+  store i32 %v0_1, i32* %v0_0
+  %v0_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_4 = load i32, i32* %a0
+  %v0_5 = load i32*, i32** %pp
+  %v0_6 = load i32, i32* %v0_0
+  %v0_7 = add i32 %n, %v0_6
+  %v0_8 = load i32, i32* %a0
+  store i32 %v0_4, i32* %a0
+  %c0 = icmp slt i32 %i0n, %v0_1
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  store i32 %v0_4, i32* %v0_3
+  %v1_1 = load i32, i32* %v0_0
+  %v1_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v1_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v1_4 = add i32 %v0_4, %v0_7
+  store i32 %v1_1, i32* %v1_2
+  %v1_6 = add i32 %v0_6, %n
+  %v1_7 = add i32 %v1_4, %v0_8
+  %c1 = icmp slt i32 %i1n, %v0_1
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = load i32*, i32** %pp
+  %v2_1 = add i32 %v0_4, %v0_8
+  store i32 %v0_8, i32* %v0_3
+  store i32 %n, i32* %a0
+  %v2_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_7
+  %v2_5 = load i32, i32* %v0_5
+  %v2_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %c2 = icmp slt i32 %i2n, %v1_1
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = add i32 %v1_7, %v1_7
+  %v3_1 = add i32 %v0_7, %n
+  %v3_2 = load i32, i32* %v0_3
+  %c3 = icmp slt i32 %i3n, %v1_1
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  store i32 %v3_1, i32* %v2_4
+  %v4_2 = load i32, i32* %v0_0
+  %c4 = icmp slt i32 %i4n, %v3_0
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = add i32 %v0_4, %v1_6
+  %v5_1 = load i32, i32* %v0_5
+  %v5_2 = load i32*, i32** %pp
+  %c5 = icmp slt i32 %i5n, %v5_0
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v6_1 = load i32, i32* %v0_5
+  %v6_2 = add i32 %v1_4, %v0_8
+  %v6_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %v6_4 = add i32 %v0_1, %v5_1
+  %v6_5 = add i32 %v0_1, %v1_6
+  %v6_6 = add i32 %v6_4, %v4_2
+  %v6_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %c6 = icmp slt i32 %i6n, %v2_1
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = add i32 %v6_5, %v1_7
+  store i32 %v3_2, i32* %v6_3
+  %c7 = icmp slt i32 %i7n, %v6_4
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = load i32, i32* %v1_3
+  %v8_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %v8_2 = load i32, i32* %v2_0
+  %c8 = icmp slt i32 %i8n, %v0_8
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v9_1 = add i32 %n, %v3_2
+  %v9_2 = add i32 %v1_1, %v8_2
+  %v9_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_1
+  %v9_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_2
+  %v9_5 = add i32 %v7_0, %v0_7
+  %v9_6 = add i32 %v0_6, %v3_0
+  %v9_7 = add i32 %v6_4, %v0_4
+  %v9_8 = load i32, i32* %v5_2
+  %c9 = icmp slt i32 %i9n, %v6_4
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = load i32, i32* %v6_0
+  %v10_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_2
+  %v10_2 = add i32 %v2_5, %v9_5
+  store i32 %v1_7, i32* %v8_1
+  %v10_4 = add i32 %v5_1, %v9_1
+  %c10 = icmp slt i32 %i10n, %v9_1
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_1
+  store i32 %v6_1, i32* %v5_2
+  %v11_2 = add i32 %v5_0, %v9_8
+  %v11_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_6
+  %v11_4 = add i32 %v1_4, %v1_7
+  %c11 = icmp slt i32 %i11n, %v10_0
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = load i32*, i32** %pp
+  %v12_1 = add i32 %v3_1, %v11_2
+  %c12 = icmp slt i32 %i12n, %v9_7
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_0
+  %v13_1 = add i32 %v9_2, %v5_0
+  %v13_2 = add i32 %v4_2, %v1_1
+  %v13_3 = load i32, i32* %v6_7
+  %v13_4 = add i32 %v0_6, %v6_1
+  %v13_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_3
+  %c13 = icmp slt i32 %i13n, %v0_1
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = add i32 %v6_5, %v10_0
+  %v14_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v14_2 = add i32 %v10_2, %v6_1
+  %v14_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_2
+  %v14_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_1
+  %v14_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_4
+  %v14_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_5
+  store i32 %v3_2, i32* %v13_0
+  %v14_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_1
+  %c14 = icmp slt i32 %i14n, %v0_8
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  %v15_0 = add i32 %v9_8, %v5_1
+  %v15_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %v15_2 = load i32*, i32** %pp
+  %c15 = icmp slt i32 %i15n, %v13_3
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  %i16 = phi i32 [ 0, %b15 ], [ %i16n, %b16x ]
+  %i16n = add i32 %i16, 1
+  store i32 %v3_0, i32* %a0
+  %v16_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %v16_2 = load i32, i32* %v0_5
+  store i32 %v6_6, i32* %v12_0
+  %v16_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_3
+  %c16 = icmp slt i32 %i16n, %v9_8
+  br i1 %c16, label %b16x, label %b17
+b16x:
+  br label %b16
+b17:
+  %i17 = phi i32 [ 0, %b16 ], [ %i17n, %b17x ]
+  %i17n = add i32 %i17, 1
+  %v17_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_7
+  %v17_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v14_0
+  %v17_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_5
+  %c17 = icmp slt i32 %i17n, %v11_4
+  br i1 %c17, label %b17x, label %b18
+b17x:
+  br label %b17
+b18:
+  %i18 = phi i32 [ 0, %b17 ], [ %i18n, %b18x ]
+  %i18n = add i32 %i18, 1
+  %v18_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v15_0
+  %v18_1 = load i32, i32* %a0
+  %v18_2 = load i32, i32* %v14_6
+  %v18_3 = add i32 %v0_7, %v1_4
+  %v18_4 = load i32, i32* %v9_0
+  %v18_5 = add i32 %v6_4, %v18_4
+  %v18_6 = add i32 %v8_0, %v11_4
+  %c18 = icmp slt i32 %i18n, %v18_3
+  br i1 %c18, label %b18x, label %b19
+b18x:
+  br label %b18
+b19:
+  %i19 = phi i32 [ 0, %b18 ], [ %i19n, %b19x ]
+  %i19n = add i32 %i19, 1
+  %v19_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v19_1 = add i32 %v9_8, %v9_5
+  %c19 = icmp slt i32 %i19n, %v10_0
+  br i1 %c19, label %b19x, label %b20
+b19x:
+  br label %b19
+b20:
+  %i20 = phi i32 [ 0, %b19 ], [ %i20n, %b20x ]
+  %i20n = add i32 %i20, 1
+  store i32 %v10_4, i32* %v2_6
+  %v20_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %c20 = icmp slt i32 %i20n, %v3_2
+  br i1 %c20, label %b20x, label %b21
+b20x:
+  br label %b20
+b21:
+  %i21 = phi i32 [ 0, %b20 ], [ %i21n, %b21x ]
+  %i21n = add i32 %i21, 1
+  %v21_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v21_1 = load i32, i32* %v17_1
+  %v21_2 = add i32 %v0_1, %v0_1
+  %v21_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v15_0
+  %v21_4 = add i32 %v5_0, %v0_1
+  %v21_5 = add i32 %v13_3, %v11_4
+  %v21_6 = load i32, i32* %v9_0
+  %v21_7 = add i32 %v1_1, %v6_6
+  %v21_8 = add i32 %v16_2, %v2_5
+  %v21_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v21_10 = load i32, i32* %v18_0
+  %c21 = icmp slt i32 %i21n, %v10_0
+  br i1 %c21, label %b21x, label %b22
+b21x:
+  br label %b21
+b22:
+  %i22 = phi i32 [ 0, %b21 ], [ %i22n, %b22x ]
+  %i22n = add i32 %i22, 1
+  %v22_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v22_1 = load i32, i32* %v2_6
+  store i32 %v3_2, i32* %v8_1
+  %v22_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_4
+  %v22_4 = load i32, i32* %v14_3
+  %v22_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v19_1
+  %c22 = icmp slt i32 %i22n, %v0_1
+  br i1 %c22, label %b22x, label %b23
+b22x:
+  br label %b22
+b23:
+  %i23 = phi i32 [ 0, %b22 ], [ %i23n, %b23x ]
+  %i23n = add i32 %i23, 1
+  %v23_0 = load i32, i32* %v14_4
+  store i32 %v0_7, i32* %v14_3
+  %v23_2 = add i32 %v1_1, %v18_1
+  %v23_3 = load i32, i32* %v9_0
+  %v23_4 = add i32 %v21_4, %v13_4
+  %v23_5 = add i32 %v1_1, %v13_4
+  store i32 %v16_2, i32* %v9_0
+  %v23_7 = add i32 %v0_1, %v18_1
+  %v23_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_0
+  %v23_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v21_4
+  %v23_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v23_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v21_1
+  %c23 = icmp slt i32 %i23n, %v18_5
+  br i1 %c23, label %b23x, label %b24
+b23x:
+  br label %b23
+b24:
+  %i24 = phi i32 [ 0, %b23 ], [ %i24n, %b24x ]
+  %i24n = add i32 %i24, 1
+  %v24_0 = load i32*, i32** %pp
+  %v24_1 = add i32 %v0_8, %v0_7
+  %v24_2 = add i32 %v10_4, %v10_4
+  %v24_3 = load i32*, i32** %pp
+  %v24_4 = add i32 %v0_7, %v3_0
+  %v24_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v23_4
+  %v24_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_7
+  %v24_7 = add i32 %v11_4, %v3_2
+  %v24_8 = load i32, i32* %v21_3
+  %c24 = icmp slt i32 %i24n, %v6_5
+  br i1 %c24, label %b24x, label %b25
+b24x:
+  br label %b24
+b25:
+  %i25 = phi i32 [ 0, %b24 ], [ %i25n, %b25x ]
+  %i25n = add i32 %i25, 1
+  %v25_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v23_3
+  %v25_1 = add i32 %v2_1, %v21_8
+  store i32 %v6_1, i32* %v14_6
+  %c25 = icmp slt i32 %i25n, %v4_2
+  br i1 %c25, label %b25x, label %b26
+b25x:
+  br label %b25
+b26:
+  %i26 = phi i32 [ 0, %b25 ], [ %i26n, %b26x ]
+  %i26n = add i32 %i26, 1
+  %v26_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v12_1
+  %v26_1 = add i32 %v24_8, %v11_4
+  %v26_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_5
+  %v26_3 = add i32 %v11_4, %v21_7
+  %v26_4 = load i32*, i32** %pp
+  store i32 %v18_4, i32* %v6_3
+  store i32 %v18_1, i32* %v14_8
+  %v26_7 = add i32 %v13_1, %v22_1
+  %v26_8 = load i32, i32* %v11_0
+  %v26_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v14_0
+  %c26 = icmp slt i32 %i26n, %v9_5
+  br i1 %c26, label %b26x, label %b27
+b26x:
+  br label %b26
+b27:
+  %i27 = phi i32 [ 0, %b26 ], [ %i27n, %b27x ]
+  %i27n = add i32 %i27, 1
+  store i32 %v18_4, i32* %v18_0
+  %v27_1 = load i32, i32* %v13_0
+  %v27_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_7
+  %v27_3 = load i32, i32* %v11_3
+  %v27_4 = load i32, i32* %v10_1
+  %c27 = icmp slt i32 %i27n, %v9_2
+  br i1 %c27, label %b27x, label %b28
+b27x:
+  br label %b27
+b28:
+  %i28 = phi i32 [ 0, %b27 ], [ %i28n, %b28x ]
+  %i28n = add i32 %i28, 1
+  %v28_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v28_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %v28_2 = load i32*, i32** %pp
+  %v28_3 = load i32, i32* %v21_9
+  %v28_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v18_4
+  %v28_5 = add i32 %v16_2, %v3_1
+  %c28 = icmp slt i32 %i28n, %v23_4
+  br i1 %c28, label %b28x, label %b29
+b28x:
+  br label %b28
+b29:
+  %i29 = phi i32 [ 0, %b28 ], [ %i29n, %b29x ]
+  %i29n = add i32 %i29, 1
+  %v29_0 = add i32 %v6_2, %v21_1
+  %v29_1 = load i32, i32* %v22_5
+  %v29_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_2
+  %v29_3 = load i32*, i32** %pp
+  %v29_4 = add i32 %v23_4, %v3_0
+  %c29 = icmp slt i32 %i29n, %v21_10
+  br i1 %c29, label %b29x, label %b30
+b29x:
+  br label %b29
+b30:
+  ret i32 %n
+}
+
+define i32 @f8(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = add i32 %n, %n
+  %v0_1 = add i32 %n, %v0_0
+  %v0_2 = add i32 %v0_1, %n
+  %v0_3 = load i32, i32* %a0
+  %v0_4 = load i32, i32* %a0
+  %v0_5 = add i32 %v0_3, %n
+  %v0_6 = load i32, i32* %a0
+  %v0_7 = load i32*, i32** %pp
+  %v0_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v0_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  store i32 %v0_5, i32* %v0_8
+  %v0_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %c0 = icmp slt i32 %i0n, %v0_5
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_11
+  %v1_1 = load i32, i32* %v0_7
+  %v1_2 = load i32, i32* %v0_9
+  store i32 %v0_0, i32* %v0_8
+  %v1_4 = load i32, i32* %v0_11
+  %v1_5 = add i32 %v0_4, %v0_2
+  %v1_6 = add i32 %n, %n
+  %v1_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v1_8 = add i32 %v0_3, %v1_0
+  %c1 = icmp slt i32 %i1n, %v1_5
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  store i32 %v0_5, i32* %v0_11
+  %v2_1 = add i32 %v1_4, %v1_2
+  %v2_2 = load i32, i32* %v0_9
+  %v2_3 = load i32, i32* %v0_11
+  %v2_4 = load i32*, i32** %pp
+  %v2_5 = load i32, i32* %a0
+  %c2 = icmp slt i32 %i2n, %v0_1
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %v3_1 = load i32, i32* %v2_4
+  %v3_2 = load i32*, i32** %pp
+  %v3_3 = add i32 %v0_3, %v0_5
+  %v3_4 = add i32 %v2_1, %v1_5
+  %v3_5 = load i32, i32* %v1_7
+  %v3_6 = load i32*, i32** %pp
+  %v3_7 = add i32 %v0_1, %v0_4
+  %v3_8 = load i32, i32* %v1_7
+  %v3_9 = add i32 %v1_1, %v2_2
+  %c3 = icmp slt i32 %i3n, %v0_4
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = load i32*, i32** %pp
+  %v4_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v4_2 = add i32 %v2_2, %v1_6
+  %c4 = icmp slt i32 %i4n, %v3_3
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  store i32 %v4_2, i32* %v3_2
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %v5_2 = load i32, i32* %a0
+  %v5_3 = load i32*, i32** %pp
+  %c5 = icmp slt i32 %i5n, %v3_1
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = load i32, i32* %v4_0
+  %v6_1 = load i32*, i32** %pp
+  %v6_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %c6 = icmp slt i32 %i6n, %n
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = load i32, i32* %a0
+  %v7_1 = add i32 %v1_5, %v4_2
+  %c7 = icmp slt i32 %i7n, %v0_2
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v8_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_1
+  %v8_2 = add i32 %v2_5, %v1_0
+  %v8_3 = add i32 %v1_1, %v1_5
+  %v8_4 = load i32, i32* %v0_9
+  %v8_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_4
+  %v8_6 = add i32 %v0_5, %v0_0
+  %v8_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v8_8 = add i32 %v8_2, %v7_0
+  %v8_9 = load i32*, i32** %pp
+  %v8_10 = add i32 %v0_2, %n
+  %c8 = icmp slt i32 %i8n, %v3_3
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v3_5, %v2_3
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_3
+  %v9_2 = load i32*, i32** %pp
+  %v9_3 = add i32 %v9_0, %v0_3
+  %c9 = icmp slt i32 %i9n, %v3_5
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = load i32, i32* %v5_1
+  %v10_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_8
+  %v10_2 = add i32 %v9_0, %v0_1
+  %v10_3 = load i32, i32* %v8_7
+  %v10_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_8
+  %c10 = icmp slt i32 %i10n, %v0_1
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  ret i32 %n
+}
+
+define i32 @f9(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = add i32 %n, %n
+  %v0_1 = add i32 %v0_0, %v0_0
+  %v0_2 = load i32, i32* %a0
+  %v0_3 = add i32 %v0_2, %n
+  %v0_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_5 = load i32*, i32** %pp
+  store i32 %v0_2, i32* %v0_4
+  %v0_7 = load i32, i32* %v0_5
+  %v0_8 = load i32, i32* %a0
+  %v0_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v0_10 = load i32, i32* %v0_4
+  %c0 = icmp slt i32 %i0n, %n
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_5
+  %v1_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v1_2 = add i32 %v0_7, %v0_8
+  %v1_3 = load i32*, i32** %pp
+  %v1_4 = add i32 %v0_8, %v0_7
+  store i32 %v0_8, i32* %v0_4
+  %c1 = icmp slt i32 %i1n, %v0_10
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = load i32, i32* %v0_9
+  %v2_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v2_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v2_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v2_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  store i32 %v0_1, i32* %v2_3
+  %c2 = icmp slt i32 %i2n, %v0_10
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = add i32 %v0_2, %v0_1
+  %v3_1 = load i32, i32* %v0_9
+  %v3_2 = add i32 %v0_8, %v1_4
+  %v3_3 = add i32 %v0_2, %v0_3
+  %v3_4 = add i32 %v0_8, %v0_10
+  %v3_5 = add i32 %v0_3, %v1_0
+  store i32 %v3_2, i32* %v2_4
+  %v3_7 = add i32 %v3_5, %v0_10
+  %v3_8 = load i32, i32* %v2_3
+  %c3 = icmp slt i32 %i3n, %v0_8
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = add i32 %v0_2, %v3_4
+  %v4_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v4_2 = add i32 %v3_0, %n
+  %v4_3 = load i32*, i32** %pp
+  %c4 = icmp slt i32 %i4n, %v3_7
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = load i32, i32* %v2_1
+  %v5_1 = add i32 %v5_0, %v0_7
+  %v5_2 = add i32 %v0_10, %v1_4
+  %v5_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %c5 = icmp slt i32 %i5n, %v0_1
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = add i32 %v3_4, %v5_2
+  %v6_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v6_2 = add i32 %v0_1, %v0_10
+  %v6_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_2
+  %v6_4 = add i32 %v1_2, %v2_0
+  %v6_5 = load i32, i32* %v6_3
+  %v6_6 = load i32, i32* %v4_1
+  %v6_7 = add i32 %v6_4, %v6_4
+  %v6_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v6_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  %c6 = icmp slt i32 %i6n, %v4_2
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = load i32*, i32** %pp
+  %v7_1 = add i32 %n, %v4_2
+  %v7_2 = add i32 %v6_6, %v3_3
+  %v7_3 = add i32 %v6_0, %v5_0
+  %v7_4 = add i32 %v0_8, %v2_0
+  %v7_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_5
+  %v7_6 = add i32 %v3_2, %v0_1
+  %v7_7 = load i32, i32* %v1_3
+  %v7_8 = load i32, i32* %v2_4
+  %v7_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  store i32 %v2_0, i32* %v7_5
+  %v7_11 = add i32 %v7_7, %v7_1
+  %c7 = icmp slt i32 %i7n, %v7_3
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  ret i32 %n
+}
+
+define i32 @f10(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32*, i32** %pp
+  store i32 %n, i32* %a0
+  %v0_2 = add i32 %n, %n
+  %v0_3 = add i32 %n, %n
+  %v0_4 = load i32*, i32** %pp
+  %v0_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_7 = add i32 %n, %v0_2
+  %c0 = icmp slt i32 %i0n, %v0_7
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = add i32 %v0_3, %n
+  %v1_1 = load i32, i32* %v0_5
+  %v1_2 = load i32, i32* %v0_4
+  %v1_3 = load i32*, i32** %pp
+  %v1_4 = add i32 %v1_2, %v1_2
+  %v1_5 = load i32*, i32** %pp
+  %v1_6 = load i32, i32* %a0
+  %v1_7 = load i32*, i32** %pp
+  %v1_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %v1_9 = add i32 %v0_3, %v1_4
+  %v1_10 = add i32 %n, %v1_6
+  %c1 = icmp slt i32 %i1n, %v1_0
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  store i32 %v1_10, i32* %v0_5
+  store i32 %v0_7, i32* %a0
+  %v2_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v2_3 = load i32, i32* %v0_5
+  %c2 = icmp slt i32 %i2n, %v1_10
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_10
+  %v3_1 = add i32 %v1_10, %v1_4
+  %v3_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_7
+  %v3_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_3
+  %v3_4 = load i32, i32* %v3_0
+  %v3_5 = load i32, i32* %v0_6
+  %c3 = icmp slt i32 %i3n, %v0_3
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  store i32 %v0_7, i32* %v1_3
+  %v4_1 = load i32*, i32** %pp
+  %v4_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v4_3 = add i32 %v0_3, %v1_10
+  %c4 = icmp slt i32 %i4n, %v1_0
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = add i32 %v3_1, %v1_2
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_9
+  %v5_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_3
+  %v5_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v5_4 = add i32 %v1_9, %v1_2
+  %v5_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_9
+  %v5_6 = load i32, i32* %v0_5
+  %v5_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_5
+  %v5_8 = load i32, i32* %v3_2
+  %v5_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_4
+  %v5_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %c5 = icmp slt i32 %i5n, %v3_5
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_10
+  %v6_1 = add i32 %v5_6, %v1_6
+  %v6_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_3
+  %v6_3 = add i32 %v4_3, %v1_2
+  %v6_4 = add i32 %v1_10, %n
+  %v6_5 = load i32, i32* %v0_4
+  %v6_6 = load i32*, i32** %pp
+  %v6_7 = load i32*, i32** %pp
+  %v6_8 = add i32 %v6_1, %v6_4
+  %c6 = icmp slt i32 %i6n, %v1_6
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v7_1 = add i32 %n, %v6_8
+  %v7_2 = load i32, i32* %v0_6
+  %v7_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v7_4 = add i32 %v5_0, %v6_3
+  %v7_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v7_6 = add i32 %v1_9, %v6_5
+  %v7_7 = load i32*, i32** %pp
+  %v7_8 = load i32, i32* %v5_9
+  %v7_9 = add i32 %v1_10, %v1_4
+  %v7_10 = load i32, i32* %v5_3
+  %v7_11 = add i32 %v5_0, %v4_3
+  %c7 = icmp slt i32 %i7n, %v0_7
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v8_1 = add i32 %v3_4, %v7_10
+  %c8 = icmp slt i32 %i8n, %v7_4
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v5_8, %v1_1
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_5
+  %v9_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_6
+  %v9_3 = load i32*, i32** %pp
+  %v9_4 = load i32, i32* %v0_4
+  %v9_5 = add i32 %v7_9, %v3_1
+  %v9_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_5
+  %v9_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_11
+  %v9_8 = load i32, i32* %v5_5
+  %c9 = icmp slt i32 %i9n, %v1_0
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_2
+  %v10_1 = add i32 %v1_0, %v7_6
+  %v10_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_3
+  %v10_3 = add i32 %v1_10, %v6_8
+  %v10_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_6
+  %v10_5 = add i32 %v6_4, %v9_5
+  %v10_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  store i32 %v8_1, i32* %v7_7
+  %v10_8 = load i32, i32* %v9_6
+  %v10_9 = add i32 %v1_9, %v7_1
+  %v10_10 = add i32 %v10_3, %v1_1
+  %v10_11 = add i32 %v0_7, %v10_10
+  %c10 = icmp slt i32 %i10n, %v6_3
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  ret i32 %n
+}
+
+define i32 @f11(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_1 = add i32 %n, %n
+  %v0_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  store i32 %n, i32* %a0
+  %v0_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v0_5 = load i32*, i32** %pp
+  %v0_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  store i32 %v0_1, i32* %v0_2
+  store i32 %v0_1, i32* %v0_4
+  %v0_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  store i32 %n, i32* %v0_4
+  %c0 = icmp slt i32 %i0n, %v0_1
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v1_1 = add i32 %n, %v0_1
+  %v1_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v1_3 = load i32*, i32** %pp
+  %v1_4 = add i32 %v1_1, %v1_1
+  %v1_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v1_6 = load i32*, i32** %pp
+  %v1_7 = add i32 %v0_1, %n
+  %v1_8 = load i32*, i32** %pp
+  %v1_9 = add i32 %v1_7, %n
+  %v1_10 = load i32, i32* %v1_3
+  %v1_11 = load i32, i32* %v0_2
+  %c1 = icmp slt i32 %i1n, %v1_4
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = load i32, i32* %v0_0
+  %v2_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v2_2 = load i32, i32* %a0
+  %v2_3 = load i32, i32* %a0
+  %v2_4 = add i32 %v1_4, %v1_11
+  %v2_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  %v2_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v2_7 = load i32*, i32** %pp
+  %v2_8 = add i32 %v2_2, %v0_1
+  %v2_9 = add i32 %v1_9, %v1_1
+  %v2_10 = load i32, i32* %v1_3
+  %c2 = icmp slt i32 %i2n, %v2_8
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_7
+  %v3_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_9
+  store i32 %v2_0, i32* %v1_5
+  %v3_3 = add i32 %n, %v2_9
+  %v3_4 = load i32*, i32** %pp
+  %v3_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_3
+  %v3_6 = add i32 %v1_4, %v0_1
+  %v3_7 = add i32 %v1_11, %v2_0
+  %v3_8 = load i32, i32* %v2_1
+  %v3_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_8
+  %v3_10 = load i32, i32* %a0
+  %v3_11 = load i32, i32* %v0_2
+  %c3 = icmp slt i32 %i3n, %v2_0
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_2
+  %v4_1 = add i32 %v2_8, %v1_7
+  store i32 %v2_0, i32* %v2_7
+  %v4_3 = add i32 %v2_0, %v2_10
+  %c4 = icmp slt i32 %i4n, %n
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = load i32, i32* %v0_5
+  %v5_1 = load i32, i32* %v2_5
+  %c5 = icmp slt i32 %i5n, %v0_1
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_10
+  %v6_1 = add i32 %v4_1, %v3_10
+  %c6 = icmp slt i32 %i6n, %v2_8
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = add i32 %v4_3, %v2_10
+  %v7_1 = load i32, i32* %v3_1
+  store i32 %v2_4, i32* %v1_3
+  store i32 %v2_2, i32* %v0_5
+  store i32 %v0_1, i32* %v0_9
+  %v7_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  %v7_6 = add i32 %v2_3, %v3_8
+  %v7_7 = load i32, i32* %v1_5
+  %v7_8 = load i32, i32* %v1_3
+  %c7 = icmp slt i32 %i7n, %v3_8
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = load i32, i32* %a0
+  %v8_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v8_2 = load i32*, i32** %pp
+  %v8_3 = add i32 %v2_2, %v3_7
+  %v8_4 = load i32, i32* %v0_2
+  store i32 %v3_6, i32* %v1_5
+  store i32 %v8_4, i32* %v3_0
+  %v8_7 = add i32 %v1_1, %v1_10
+  %v8_8 = add i32 %v7_1, %v1_10
+  %c8 = icmp slt i32 %i8n, %v5_0
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v3_3, %v2_2
+  %v9_1 = load i32*, i32** %pp
+  %v9_2 = load i32, i32* %v6_0
+  %v9_3 = load i32, i32* %v1_5
+  store i32 %v3_3, i32* %v1_5
+  %v9_5 = add i32 %v6_1, %v4_1
+  %c9 = icmp slt i32 %i9n, %v1_4
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = load i32*, i32** %pp
+  %v10_1 = add i32 %v7_8, %v8_3
+  %v10_2 = load i32, i32* %v0_10
+  %v10_3 = add i32 %v4_3, %v2_2
+  %v10_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v10_5 = add i32 %v10_3, %v7_7
+  %v10_6 = load i32, i32* %v1_6
+  %c10 = icmp slt i32 %i10n, %v9_0
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = add i32 %v9_2, %v1_7
+  %v11_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_10
+  %v11_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_0
+  store i32 %v4_1, i32* %v0_5
+  %v11_4 = add i32 %v9_2, %v1_9
+  store i32 %v3_10, i32* %v3_9
+  %c11 = icmp slt i32 %i11n, %v7_7
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = add i32 %v10_6, %v7_1
+  %v12_1 = add i32 %v1_7, %v8_0
+  %v12_2 = load i32, i32* %v1_5
+  %v12_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_6
+  store i32 %v12_1, i32* %v1_3
+  %v12_5 = load i32*, i32** %pp
+  %v12_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %c12 = icmp slt i32 %i12n, %v2_9
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = load i32, i32* %v1_6
+  %v13_1 = add i32 %v3_8, %v8_3
+  %c13 = icmp slt i32 %i13n, %v10_2
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_4
+  %v14_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  %v14_2 = load i32*, i32** %pp
+  %c14 = icmp slt i32 %i14n, %v1_9
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  %v15_0 = add i32 %v9_0, %v4_1
+  %v15_1 = add i32 %n, %v2_8
+  %v15_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %c15 = icmp slt i32 %i15n, %n
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  %i16 = phi i32 [ 0, %b15 ], [ %i16n, %b16x ]
+  %i16n = add i32 %i16, 1
+  %v16_0 = load i32, i32* %v0_0
+  %v16_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_11
+  %v16_2 = add i32 %v0_1, %v10_2
+  %v16_3 = load i32, i32* %v15_2
+  %v16_4 = load i32*, i32** %pp
+  %v16_5 = load i32, i32* %v0_4
+  %v16_6 = add i32 %v13_0, %v1_1
+  %v16_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_5
+  %v16_8 = load i32, i32* %v11_1
+  %v16_9 = add i32 %v6_1, %v3_6
+  %v16_10 = add i32 %v16_2, %n
+  %v16_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_11
+  %c16 = icmp slt i32 %i16n, %v9_0
+  br i1 %c16, label %b16x, label %b17
+b16x:
+  br label %b16
+b17:
+  %i17 = phi i32 [ 0, %b16 ], [ %i17n, %b17x ]
+  %i17n = add i32 %i17, 1
+  %v17_0 = add i32 %v1_4, %v7_0
+  %v17_1 = load i32*, i32** %pp
+  %v17_2 = add i32 %v4_1, %v2_3
+  %v17_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_10
+  %v17_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_4
+  %v17_5 = load i32, i32* %v4_0
+  %v17_6 = load i32, i32* %v12_5
+  %v17_7 = load i32*, i32** %pp
+  %v17_8 = add i32 %v3_10, %v10_3
+  %v17_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_4
+  %v17_10 = add i32 %v16_10, %v1_7
+  %v17_11 = add i32 %v9_5, %v16_6
+  %c17 = icmp slt i32 %i17n, %v8_8
+  br i1 %c17, label %b17x, label %b18
+b17x:
+  br label %b17
+b18:
+  %i18 = phi i32 [ 0, %b17 ], [ %i18n, %b18x ]
+  %i18n = add i32 %i18, 1
+  store i32 %v8_8, i32* %v1_0
+  %v18_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v16_9
+  %v18_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_4
+  %v18_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_7
+  %v18_4 = load i32, i32* %v0_6
+  %v18_5 = add i32 %v3_7, %v3_3
+  %v18_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v17_5
+  %c18 = icmp slt i32 %i18n, %v7_0
+  br i1 %c18, label %b18x, label %b19
+b18x:
+  br label %b18
+b19:
+  %i19 = phi i32 [ 0, %b18 ], [ %i19n, %b19x ]
+  %i19n = add i32 %i19, 1
+  %v19_0 = add i32 %v8_4, %v11_4
+  %v19_1 = add i32 %v4_3, %v3_11
+  store i32 %v10_6, i32* %v18_1
+  %v19_3 = add i32 %v16_3, %v17_2
+  %v19_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_6
+  %v19_5 = add i32 %v12_2, %v16_6
+  %v19_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_4
+  %v19_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v19_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v13_1
+  %v19_9 = load i32*, i32** %pp
+  %c19 = icmp slt i32 %i19n, %v10_6
+  br i1 %c19, label %b19x, label %b20
+b19x:
+  br label %b19
+b20:
+  %i20 = phi i32 [ 0, %b19 ], [ %i20n, %b20x ]
+  %i20n = add i32 %i20, 1
+  %v20_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v12_1
+  %v20_1 = load i32, i32* %v20_0
+  %c20 = icmp slt i32 %i20n, %v12_1
+  br i1 %c20, label %b20x, label %b21
+b20x:
+  br label %b20
+b21:
+  %i21 = phi i32 [ 0, %b20 ], [ %i21n, %b21x ]
+  %i21n = add i32 %i21, 1
+  %v21_0 = load i32*, i32** %pp
+  %v21_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_3
+  %v21_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v16_2
+  %v21_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_0
+  %v21_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v16_0
+  %v21_5 = load i32*, i32** %pp
+  %v21_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v17_2
+  %v21_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v19_1
+  %v21_8 = add i32 %v16_10, %v8_7
+  %v21_9 = add i32 %v3_7, %v9_3
+  %v21_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_3
+  %v21_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_0
+  %c21 = icmp slt i32 %i21n, %v3_11
+  br i1 %c21, label %b21x, label %b22
+b21x:
+  br label %b21
+b22:
+  ret i32 %n
+}
+
+define i32 @f12(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32*, i32** %pp
+  %v0_1 = add i32 %n, %n
+  %v0_2 = add i32 %n, %v0_1
+  %v0_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v0_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_5 = add i32 %v0_1, %v0_2
+  %v0_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v0_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v0_11 = load i32, i32* %v0_8
+  %c0 = icmp slt i32 %i0n, %n
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_8
+  %v1_1 = add i32 %n, %v0_11
+  %v1_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v1_3 = load i32*, i32** %pp
+  %v1_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  store i32 %v0_1, i32* %v1_2
+  %v1_6 = load i32, i32* %v0_0
+  %v1_7 = add i32 %n, %v1_0
+  %c1 = icmp slt i32 %i1n, %v0_1
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  %v2_1 = add i32 %v1_7, %v1_1
+  %v2_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %c2 = icmp slt i32 %i2n, %v1_7
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = load i32*, i32** %pp
+  store i32 %v0_1, i32* %v0_10
+  %v3_2 = load i32, i32* %v0_9
+  %v3_3 = add i32 %v0_1, %v1_0
+  %c3 = icmp slt i32 %i3n, %v0_5
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = add i32 %v0_11, %v3_3
+  %v4_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_11
+  %v4_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v4_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v4_4 = load i32, i32* %v4_3
+  %c4 = icmp slt i32 %i4n, %v1_0
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_6
+  store i32 %v1_7, i32* %v1_3
+  %v5_3 = load i32*, i32** %pp
+  %v5_4 = add i32 %v4_4, %v3_3
+  %v5_5 = add i32 %v1_1, %v1_1
+  %c5 = icmp slt i32 %i5n, %v3_2
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = load i32, i32* %v0_6
+  %v6_1 = load i32, i32* %v2_0
+  %v6_2 = add i32 %v0_11, %n
+  %v6_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_0
+  %v6_4 = add i32 %v1_7, %v4_0
+  %v6_5 = add i32 %v1_1, %v0_5
+  %v6_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_4
+  %v6_7 = add i32 %v0_1, %v4_0
+  %v6_8 = load i32*, i32** %pp
+  %v6_9 = load i32, i32* %v5_3
+  %c6 = icmp slt i32 %i6n, %v5_4
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = load i32*, i32** %pp
+  %v7_1 = load i32, i32* %v5_0
+  %v7_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v7_3 = load i32*, i32** %pp
+  %v7_4 = load i32, i32* %v1_3
+  store i32 %v4_0, i32* %v0_9
+  %v7_6 = add i32 %v7_1, %v4_0
+  %v7_7 = load i32, i32* %v0_3
+  %v7_8 = load i32, i32* %v4_2
+  %v7_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_7
+  %c7 = icmp slt i32 %i7n, %v6_7
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  %v8_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_6
+  store i32 %v1_6, i32* %v5_1
+  %v8_2 = add i32 %v1_7, %v7_7
+  %v8_3 = load i32, i32* %v6_8
+  %v8_4 = load i32, i32* %v5_0
+  %v8_5 = load i32, i32* %v0_9
+  %v8_6 = add i32 %v0_11, %v7_1
+  %c8 = icmp slt i32 %i8n, %v4_4
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_1
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v9_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_3
+  %v9_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v9_4 = load i32, i32* %v6_8
+  %v9_5 = add i32 %v7_8, %v1_6
+  %v9_6 = load i32, i32* %v4_2
+  %v9_7 = load i32, i32* %v6_8
+  %v9_8 = load i32, i32* %v5_1
+  %v9_9 = load i32, i32* %v0_7
+  %c9 = icmp slt i32 %i9n, %v6_1
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_2
+  %v10_1 = load i32*, i32** %pp
+  %v10_2 = load i32, i32* %v9_1
+  %v10_3 = add i32 %v3_3, %v9_4
+  %v10_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_7
+  %v10_5 = load i32, i32* %v10_0
+  %v10_6 = load i32*, i32** %pp
+  %v10_7 = load i32*, i32** %pp
+  %c10 = icmp slt i32 %i10n, %v9_4
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = add i32 %v6_0, %v0_1
+  store i32 %n, i32* %v10_6
+  %v11_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_8
+  %v11_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_5
+  %v11_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_5
+  %v11_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_0
+  %v11_6 = add i32 %v1_0, %v9_4
+  %c11 = icmp slt i32 %i11n, %v10_3
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = add i32 %v4_0, %v1_7
+  %v12_1 = load i32, i32* %v5_0
+  %v12_2 = load i32*, i32** %pp
+  %v12_3 = load i32, i32* %v0_3
+  %v12_4 = add i32 %v7_4, %v7_1
+  %v12_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_2
+  %v12_6 = add i32 %v7_8, %v10_5
+  %v12_7 = load i32*, i32** %pp
+  %v12_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_5
+  %c12 = icmp slt i32 %i12n, %v7_4
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  ret i32 %n
+}
+
+define i32 @f13(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_1 = add i32 %n, %n
+  %v0_2 = load i32*, i32** %pp
+  %v0_3 = load i32, i32* %a0
+  %v0_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v0_5 = load i32, i32* %v0_4
+  %v0_6 = load i32, i32* %a0
+  %v0_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_6
+  %v0_8 = load i32, i32* %v0_4
+  %v0_9 = add i32 %v0_5, %v0_5
+  %v0_10 = add i32 %v0_1, %n
+  %c0 = icmp slt i32 %i0n, %v0_10
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_7
+  %v1_1 = add i32 %n, %v0_5
+  %v1_2 = add i32 %v0_9, %v1_0
+  %v1_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v1_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_8
+  %v1_5 = add i32 %v0_10, %v0_1
+  %v1_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  store i32 %n, i32* %v0_0
+  %c1 = icmp slt i32 %i1n, %v0_10
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = add i32 %v0_5, %v1_1
+  %v2_1 = load i32, i32* %v0_4
+  %v2_2 = add i32 %v0_10, %v2_1
+  %c2 = icmp slt i32 %i2n, %n
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = load i32*, i32** %pp
+  %v3_1 = load i32, i32* %v0_2
+  %v3_2 = add i32 %v0_1, %v0_6
+  %v3_3 = load i32, i32* %v0_4
+  store i32 %n, i32* %v0_2
+  %v3_5 = add i32 %v1_0, %v3_2
+  %v3_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v3_7 = load i32, i32* %v0_7
+  store i32 %v3_2, i32* %v1_4
+  %v3_9 = load i32*, i32** %pp
+  %c3 = icmp slt i32 %i3n, %v1_1
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_0
+  %v4_1 = add i32 %v3_3, %v1_0
+  %v4_2 = load i32, i32* %v0_2
+  %v4_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v4_4 = load i32*, i32** %pp
+  %v4_5 = add i32 %v4_2, %v3_1
+  %c4 = icmp slt i32 %i4n, %v4_5
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_5
+  store i32 %v0_1, i32* %v3_9
+  %v5_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v5_4 = load i32, i32* %v3_9
+  %v5_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_10
+  %v5_6 = add i32 %v1_1, %v0_9
+  %v5_7 = add i32 %v3_5, %v3_7
+  %v5_8 = load i32, i32* %v5_0
+  %v5_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_9
+  %v5_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_1
+  %c5 = icmp slt i32 %i5n, %v4_1
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v6_1 = add i32 %v3_1, %v0_8
+  %v6_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_4
+  %c6 = icmp slt i32 %i6n, %v3_3
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = load i32, i32* %v6_2
+  %v7_1 = add i32 %v5_4, %v1_1
+  %v7_2 = add i32 %v3_3, %v5_8
+  %v7_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_6
+  %c7 = icmp slt i32 %i7n, %v7_1
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  store i32 %v2_2, i32* %v0_4
+  %v8_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_3
+  %v8_2 = add i32 %v2_1, %v0_10
+  %v8_3 = load i32*, i32** %pp
+  %v8_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_0
+  %c8 = icmp slt i32 %i8n, %v6_1
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v1_0, %v0_3
+  %v9_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_0
+  %v9_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_2
+  %v9_3 = add i32 %v4_1, %v1_1
+  %c9 = icmp slt i32 %i9n, %v3_7
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = load i32, i32* %v9_1
+  %v10_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_2
+  %v10_2 = load i32, i32* %v0_0
+  %v10_3 = load i32, i32* %v0_7
+  %v10_4 = load i32*, i32** %pp
+  %v10_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_0
+  %c10 = icmp slt i32 %i10n, %v0_8
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = load i32, i32* %v8_1
+  %v11_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_2
+  %v11_2 = load i32*, i32** %pp
+  %v11_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_5
+  %v11_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_1
+  %c11 = icmp slt i32 %i11n, %v9_3
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_2
+  %v12_1 = load i32, i32* %v11_1
+  %v12_2 = add i32 %v0_8, %v2_0
+  %v12_3 = load i32, i32* %v5_10
+  store i32 %v10_0, i32* %v1_3
+  %v12_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v7_2
+  %v12_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_2
+  store i32 %v3_7, i32* %v0_2
+  store i32 %v0_9, i32* %a0
+  %v12_9 = load i32, i32* %v3_6
+  %c12 = icmp slt i32 %i12n, %v3_7
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_5
+  %v13_1 = load i32, i32* %v5_1
+  %c13 = icmp slt i32 %i13n, %v4_2
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_7
+  %v14_1 = add i32 %v10_2, %v7_1
+  %v14_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %v14_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_2
+  store i32 %v7_1, i32* %v0_2
+  %v14_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_0
+  store i32 %v5_8, i32* %v14_3
+  %c14 = icmp slt i32 %i14n, %v1_0
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  store i32 %v4_5, i32* %v0_7
+  %v15_1 = load i32, i32* %v14_5
+  %v15_2 = add i32 %v5_4, %v1_2
+  %v15_3 = load i32*, i32** %pp
+  %v15_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v15_5 = add i32 %v7_2, %v3_7
+  %v15_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_9
+  %v15_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_1
+  %c15 = icmp slt i32 %i15n, %v0_10
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  %i16 = phi i32 [ 0, %b15 ], [ %i16n, %b16x ]
+  %i16n = add i32 %i16, 1
+  %v16_0 = load i32, i32* %v11_4
+  store i32 %v4_1, i32* %v10_4
+  %v16_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_3
+  store i32 %v9_0, i32* %v5_3
+  %c16 = icmp slt i32 %i16n, %v5_4
+  br i1 %c16, label %b16x, label %b17
+b16x:
+  br label %b16
+b17:
+  %i17 = phi i32 [ 0, %b16 ], [ %i17n, %b17x ]
+  %i17n = add i32 %i17, 1
+  %v17_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_2
+  %v17_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v17_2 = add i32 %v15_5, %v10_0
+  store i32 %v0_9, i32* %a0
+  %v17_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %c17 = icmp slt i32 %i17n, %v8_2
+  br i1 %c17, label %b17x, label %b18
+b17x:
+  br label %b17
+b18:
+  %i18 = phi i32 [ 0, %b17 ], [ %i18n, %b18x ]
+  %i18n = add i32 %i18, 1
+  %v18_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v16_0
+  %v18_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v17_2
+  %v18_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_2
+  %v18_3 = add i32 %v6_1, %v5_7
+  %v18_4 = load i32*, i32** %pp
+  %v18_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_3
+  %v18_6 = add i32 %v0_8, %v13_1
+  store i32 %v2_2, i32* %v5_1
+  store i32 %v18_6, i32* %v11_2
+  %v18_9 = add i32 %v0_5, %v3_1
+  %v18_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_2
+  %c18 = icmp slt i32 %i18n, %v0_9
+  br i1 %c18, label %b18x, label %b19
+b18x:
+  br label %b18
+b19:
+  %i19 = phi i32 [ 0, %b18 ], [ %i19n, %b19x ]
+  %i19n = add i32 %i19, 1
+  %v19_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v18_3
+  %v19_1 = load i32*, i32** %pp
+  %c19 = icmp slt i32 %i19n, %v3_7
+  br i1 %c19, label %b19x, label %b20
+b19x:
+  br label %b19
+b20:
+  %i20 = phi i32 [ 0, %b19 ], [ %i20n, %b20x ]
+  %i20n = add i32 %i20, 1
+  %v20_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v17_2
+  %v20_1 = load i32, i32* %v19_1
+  %v20_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %v20_3 = add i32 %v5_8, %v18_6
+  %v20_4 = load i32, i32* %v1_3
+  %v20_5 = add i32 %v1_1, %v15_5
+  store i32 %v1_2, i32* %v3_6
+  %c20 = icmp slt i32 %i20n, %v18_9
+  br i1 %c20, label %b20x, label %b21
+b20x:
+  br label %b20
+b21:
+  %i21 = phi i32 [ 0, %b20 ], [ %i21n, %b21x ]
+  %i21n = add i32 %i21, 1
+  %v21_0 = add i32 %v2_1, %v2_0
+  %v21_1 = add i32 %v14_1, %v4_2
+  %v21_2 = add i32 %v0_6, %n
+  %v21_3 = add i32 %v7_2, %v0_3
+  %v21_4 = load i32, i32* %v17_1
+  %v21_5 = load i32, i32* %v0_7
+  %v21_6 = add i32 %v12_3, %v0_6
+  %c21 = icmp slt i32 %i21n, %v2_0
+  br i1 %c21, label %b21x, label %b22
+b21x:
+  br label %b21
+b22:
+  %i22 = phi i32 [ 0, %b21 ], [ %i22n, %b22x ]
+  %i22n = add i32 %i22, 1
+  %v22_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_4
+  %v22_1 = add i32 %v0_8, %v12_9
+  %v22_2 = add i32 %v15_1, %v4_1
+  %v22_3 = add i32 %v22_1, %v22_1
+  %v22_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v12_1
+  %v22_5 = add i32 %v21_3, %v4_2
+  %v22_6 = load i32, i32* %v18_1
+  %v22_7 = load i32*, i32** %pp
+  %v22_8 = add i32 %v22_3, %v12_1
+  %v22_9 = add i32 %v22_8, %v2_2
+  %v22_10 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_0
+  %v22_11 = add i32 %v7_1, %v7_2
+  %c22 = icmp slt i32 %i22n, %v5_7
+  br i1 %c22, label %b22x, label %b23
+b22x:
+  br label %b22
+b23:
+  %i23 = phi i32 [ 0, %b22 ], [ %i23n, %b23x ]
+  %i23n = add i32 %i23, 1
+  %v23_0 = load i32, i32* %v10_5
+  %v23_1 = add i32 %v0_9, %v18_6
+  %v23_2 = load i32*, i32** %pp
+  %v23_3 = load i32, i32* %v15_3
+  %v23_4 = add i32 %v18_9, %v1_5
+  %v23_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v14_1
+  %v23_6 = load i32*, i32** %pp
+  %v23_7 = add i32 %v20_4, %v12_2
+  %v23_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v21_6
+  %v23_9 = load i32*, i32** %pp
+  %v23_10 = add i32 %v21_4, %v20_3
+  %c23 = icmp slt i32 %i23n, %v20_1
+  br i1 %c23, label %b23x, label %b24
+b23x:
+  br label %b23
+b24:
+  %i24 = phi i32 [ 0, %b23 ], [ %i24n, %b24x ]
+  %i24n = add i32 %i24, 1
+  %v24_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_5
+  %v24_1 = load i32, i32* %v9_2
+  %v24_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v18_6
+  %v24_3 = add i32 %v0_6, %v11_0
+  %v24_4 = load i32, i32* %v11_4
+  %v24_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v21_0
+  %v24_6 = load i32, i32* %v23_8
+  %v24_7 = add i32 %v3_1, %v6_1
+  %v24_8 = load i32*, i32** %pp
+  %v24_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v5_4
+  %v24_10 = load i32, i32* %v14_5
+  %c24 = icmp slt i32 %i24n, %v3_7
+  br i1 %c24, label %b24x, label %b25
+b24x:
+  br label %b24
+b25:
+  %i25 = phi i32 [ 0, %b24 ], [ %i25n, %b25x ]
+  %i25n = add i32 %i25, 1
+  %v25_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v15_1
+  %v25_1 = add i32 %v24_3, %v18_6
+  %v25_2 = load i32, i32* %v14_2
+  %v25_3 = add i32 %v22_2, %v24_1
+  %v25_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %v25_5 = load i32, i32* %v0_0
+  %v25_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_5
+  %c25 = icmp slt i32 %i25n, %v2_1
+  br i1 %c25, label %b25x, label %b26
+b25x:
+  br label %b25
+b26:
+  %i26 = phi i32 [ 0, %b25 ], [ %i26n, %b26x ]
+  %i26n = add i32 %i26, 1
+  %v26_0 = load i32, i32* %v11_2
+  %v26_1 = add i32 %v25_5, %v2_0
+  %v26_2 = add i32 %v22_3, %v25_3
+  %v26_3 = load i32, i32* %v11_2
+  %v26_4 = load i32*, i32** %pp
+  %c26 = icmp slt i32 %i26n, %v1_1
+  br i1 %c26, label %b26x, label %b27
+b26x:
+  br label %b26
+b27:
+  %i27 = phi i32 [ 0, %b26 ], [ %i27n, %b27x ]
+  %i27n = add i32 %i27, 1
+  %v27_0 = load i32*, i32** %pp
+  %v27_1 = load i32, i32* %v12_6
+  %v27_2 = load i32, i32* %v17_0
+  %v27_3 = add i32 %v25_5, %v0_10
+  %v27_4 = add i32 %v22_1, %v22_1
+  %v27_5 = load i32, i32* %v0_2
+  %v27_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v26_0
+  %v27_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v17_2
+  %v27_8 = load i32, i32* %v23_2
+  %v27_9 = add i32 %v27_3, %v24_1
+  %c27 = icmp slt i32 %i27n, %v27_5
+  br i1 %c27, label %b27x, label %b28
+b27x:
+  br label %b27
+b28:
+  %i28 = phi i32 [ 0, %b27 ], [ %i28n, %b28x ]
+  %i28n = add i32 %i28, 1
+  %v28_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v12_9
+  %v28_1 = load i32, i32* %a0
+  %v28_2 = add i32 %v10_0, %v3_5
+  %v28_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v23_3
+  store i32 %v18_6, i32* %v7_3
+  %v28_5 = add i32 %v24_10, %v10_2
+  %v28_6 = load i32*, i32** %pp
+  %v28_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v28_1
+  store i32 %v20_3, i32* %v24_0
+  %c28 = icmp slt i32 %i28n, %v20_1
+  br i1 %c28, label %b28x, label %b29
+b28x:
+  br label %b28
+b29:
+  %i29 = phi i32 [ 0, %b28 ], [ %i29n, %b29x ]
+  %i29n = add i32 %i29, 1
+  %v29_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v25_5
+  %v29_1 = load i32*, i32** %pp
+  %v29_2 = load i32, i32* %v15_7
+  %v29_3 = load i32*, i32** %pp
+  %v29_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %v29_5 = add i32 %v22_1, %v0_9
+  %v29_6 = add i32 %v15_1, %v3_3
+  %v29_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v29_6
+  %v29_8 = add i32 %v4_1, %v12_2
+  %v29_9 = add i32 %v4_2, %v26_0
+  %v29_10 = load i32, i32* %v1_4
+  store i32 %v18_3, i32* %v15_7
+  %c29 = icmp slt i32 %i29n, %v26_1
+  br i1 %c29, label %b29x, label %b30
+b29x:
+  br label %b29
+b30:
+  ret i32 %n
+}
+
+define i32 @f14(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = load i32, i32* %a0
+  %v0_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_0
+  %v0_2 = add i32 %v0_0, %n
+  %v0_3 = load i32*, i32** %pp
+  %v0_4 = load i32, i32* %v0_1
+  %v0_5 = load i32, i32* %v0_1
+  %c0 = icmp slt i32 %i0n, %v0_2
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %v1_1 = load i32, i32* %v1_0
+  %v1_2 = load i32*, i32** %pp
+  %c1 = icmp slt i32 %i1n, %v0_2
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_5
+  %v2_1 = load i32, i32* %v1_2
+  %c2 = icmp slt i32 %i2n, %v2_1
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = load i32, i32* %a0
+  %v3_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v3_2 = add i32 %v2_1, %v0_5
+  %v3_3 = add i32 %v0_0, %v0_5
+  %v3_4 = load i32, i32* %a0
+  %v3_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v3_6 = load i32, i32* %v2_0
+  %v3_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v3_8 = add i32 %v3_2, %v0_0
+  %v3_9 = add i32 %v3_4, %v2_1
+  %v3_10 = add i32 %v3_6, %v0_0
+  %v3_11 = add i32 %v0_2, %v3_4
+  %c3 = icmp slt i32 %i3n, %v1_1
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = add i32 %v0_4, %v3_8
+  %v4_1 = load i32, i32* %v2_0
+  %v4_2 = load i32, i32* %v3_5
+  %v4_3 = add i32 %v3_6, %v1_1
+  %v4_4 = add i32 %v0_5, %v4_1
+  %v4_5 = add i32 %v3_9, %v3_3
+  %v4_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_4
+  %v4_7 = load i32*, i32** %pp
+  %v4_8 = add i32 %v0_2, %v4_0
+  %v4_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_2
+  %v4_10 = load i32*, i32** %pp
+  store i32 %v3_8, i32* %v1_0
+  %c4 = icmp slt i32 %i4n, %v4_2
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = add i32 %v4_5, %v0_5
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_5
+  %v5_2 = add i32 %v3_0, %v4_0
+  %v5_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v5_4 = add i32 %v5_0, %v4_4
+  %v5_5 = load i32, i32* %v1_2
+  %c5 = icmp slt i32 %i5n, %v0_5
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = add i32 %v4_8, %v3_8
+  %v6_1 = load i32*, i32** %pp
+  %v6_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_2
+  %v6_3 = add i32 %v4_3, %v5_5
+  store i32 %v4_3, i32* %v3_1
+  %v6_5 = add i32 %v3_3, %v0_4
+  %v6_6 = load i32, i32* %v0_3
+  %v6_7 = load i32, i32* %v6_2
+  %v6_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_4
+  %v6_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_5
+  %v6_10 = load i32*, i32** %pp
+  %v6_11 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_1
+  %c6 = icmp slt i32 %i6n, %v0_4
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  store i32 %v0_2, i32* %v0_1
+  store i32 %v6_5, i32* %v1_0
+  %v7_2 = load i32, i32* %v4_6
+  %v7_3 = load i32*, i32** %pp
+  %v7_4 = load i32, i32* %v4_7
+  store i32 %v3_10, i32* %v3_1
+  store i32 %v3_9, i32* %v4_6
+  %v7_7 = add i32 %v0_0, %v3_10
+  %v7_8 = add i32 %v0_0, %v7_2
+  %c7 = icmp slt i32 %i7n, %v4_1
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  ret i32 %n
+}
+
+define i32 @f15(i32* %a0, i32 %n) {
+entry:
+  %base = alloca [64 x i32]
+  %pp = alloca i32*
+  store i32* %a0, i32** %pp
+  br label %b0
+b0:
+  %i0 = phi i32 [ 0, %entry ], [ %i0n, %b0x ]
+  %i0n = add i32 %i0, 1
+  %v0_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_1 = add i32 %n, %n
+  %v0_2 = load i32, i32* %v0_0
+  %v0_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %n
+  %v0_4 = add i32 %v0_2, %v0_1
+  %v0_5 = load i32*, i32** %pp
+  %v0_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %c0 = icmp slt i32 %i0n, %v0_1
+  br i1 %c0, label %b0x, label %b1
+b0x:
+  br label %b0
+b1:
+  %i1 = phi i32 [ 0, %b0 ], [ %i1n, %b1x ]
+  %i1n = add i32 %i1, 1
+  %v1_0 = load i32, i32* %v0_6
+  %v1_1 = load i32, i32* %v0_3
+  %v1_2 = load i32*, i32** %pp
+  %v1_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v1_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v1_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v1_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %v1_7 = add i32 %v1_1, %v0_1
+  %c1 = icmp slt i32 %i1n, %v1_7
+  br i1 %c1, label %b1x, label %b2
+b1x:
+  br label %b1
+b2:
+  %i2 = phi i32 [ 0, %b1 ], [ %i2n, %b2x ]
+  %i2n = add i32 %i2, 1
+  %v2_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_7
+  %v2_1 = add i32 %v0_2, %v1_1
+  %v2_2 = add i32 %n, %n
+  %v2_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v2_4 = load i32, i32* %v2_0
+  %v2_5 = add i32 %v2_2, %v1_0
+  %c2 = icmp slt i32 %i2n, %v2_2
+  br i1 %c2, label %b2x, label %b3
+b2x:
+  br label %b2
+b3:
+  %i3 = phi i32 [ 0, %b2 ], [ %i3n, %b3x ]
+  %i3n = add i32 %i3, 1
+  %v3_0 = load i32*, i32** %pp
+  store i32 %v1_1, i32* %v1_2
+  %v3_2 = load i32, i32* %a0
+  %v3_3 = add i32 %v3_2, %v1_1
+  %v3_4 = load i32, i32* %a0
+  %v3_5 = add i32 %v2_1, %v3_3
+  %v3_6 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  %c3 = icmp slt i32 %i3n, %v3_4
+  br i1 %c3, label %b3x, label %b4
+b3x:
+  br label %b3
+b4:
+  %i4 = phi i32 [ 0, %b3 ], [ %i4n, %b4x ]
+  %i4n = add i32 %i4, 1
+  %v4_0 = load i32, i32* %v1_4
+  %v4_1 = load i32, i32* %v0_0
+  %v4_2 = add i32 %v2_5, %v4_0
+  %v4_3 = add i32 %v1_0, %v0_4
+  %c4 = icmp slt i32 %i4n, %v4_1
+  br i1 %c4, label %b4x, label %b5
+b4x:
+  br label %b4
+b5:
+  %i5 = phi i32 [ 0, %b4 ], [ %i5n, %b5x ]
+  %i5n = add i32 %i5, 1
+  %v5_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_3
+  %v5_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v2_2
+  %v5_2 = load i32*, i32** %pp
+  %v5_3 = add i32 %v1_7, %v2_2
+  %v5_4 = add i32 %v4_1, %v3_4
+  %v5_5 = add i32 %v3_3, %v1_1
+  %v5_6 = add i32 %v3_4, %v1_0
+  %v5_7 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_4
+  %v5_8 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_3
+  store i32 %n, i32* %a0
+  %v5_10 = add i32 %v0_2, %v3_5
+  %c5 = icmp slt i32 %i5n, %v0_1
+  br i1 %c5, label %b5x, label %b6
+b5x:
+  br label %b5
+b6:
+  %i6 = phi i32 [ 0, %b5 ], [ %i6n, %b6x ]
+  %i6n = add i32 %i6, 1
+  %v6_0 = add i32 %v4_2, %v0_2
+  %v6_1 = add i32 %v2_5, %v5_3
+  store i32 %v3_5, i32* %v5_1
+  %v6_3 = add i32 %v1_7, %n
+  %v6_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_2
+  %c6 = icmp slt i32 %i6n, %v3_3
+  br i1 %c6, label %b6x, label %b7
+b6x:
+  br label %b6
+b7:
+  %i7 = phi i32 [ 0, %b6 ], [ %i7n, %b7x ]
+  %i7n = add i32 %i7, 1
+  %v7_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v7_1 = add i32 %v3_5, %v3_5
+  store i32 %v5_4, i32* %v5_0
+  %c7 = icmp slt i32 %i7n, %v6_0
+  br i1 %c7, label %b7x, label %b8
+b7x:
+  br label %b7
+b8:
+  %i8 = phi i32 [ 0, %b7 ], [ %i8n, %b8x ]
+  %i8n = add i32 %i8, 1
+  store i32 %v5_10, i32* %v0_0
+  %v8_1 = add i32 %v1_1, %v3_3
+  %v8_2 = load i32*, i32** %pp
+  %c8 = icmp slt i32 %i8n, %v7_1
+  br i1 %c8, label %b8x, label %b9
+b8x:
+  br label %b8
+b9:
+  %i9 = phi i32 [ 0, %b8 ], [ %i9n, %b9x ]
+  %i9n = add i32 %i9, 1
+  %v9_0 = add i32 %v4_0, %v5_6
+  %v9_1 = add i32 %v5_3, %v1_0
+  %v9_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_0
+  store i32 %v0_2, i32* %v9_2
+  %v9_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v8_1
+  %c9 = icmp slt i32 %i9n, %v2_1
+  br i1 %c9, label %b9x, label %b10
+b9x:
+  br label %b9
+b10:
+  %i10 = phi i32 [ 0, %b9 ], [ %i10n, %b10x ]
+  %i10n = add i32 %i10, 1
+  %v10_0 = load i32, i32* %v9_4
+  %v10_1 = add i32 %v0_2, %v4_0
+  %c10 = icmp slt i32 %i10n, %v1_7
+  br i1 %c10, label %b10x, label %b11
+b10x:
+  br label %b10
+b11:
+  %i11 = phi i32 [ 0, %b10 ], [ %i11n, %b11x ]
+  %i11n = add i32 %i11, 1
+  %v11_0 = add i32 %v0_2, %v9_0
+  %v11_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_0
+  %v11_2 = add i32 %v3_5, %v0_2
+  %v11_3 = add i32 %v6_3, %v4_1
+  %v11_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v9_0
+  %c11 = icmp slt i32 %i11n, %v0_1
+  br i1 %c11, label %b11x, label %b12
+b11x:
+  br label %b11
+b12:
+  %i12 = phi i32 [ 0, %b11 ], [ %i12n, %b12x ]
+  %i12n = add i32 %i12, 1
+  %v12_0 = add i32 %v1_7, %v1_7
+  %v12_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v11_0
+  %v12_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_1
+  %v12_3 = load i32, i32* %v5_2
+  %v12_4 = add i32 %v6_0, %n
+  %v12_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v0_1
+  store i32 %v1_1, i32* %v5_2
+  store i32 %v12_4, i32* %v11_4
+  %v12_8 = add i32 %v1_0, %v0_4
+  %c12 = icmp slt i32 %i12n, %v11_2
+  br i1 %c12, label %b12x, label %b13
+b12x:
+  br label %b12
+b13:
+  %i13 = phi i32 [ 0, %b12 ], [ %i13n, %b13x ]
+  %i13n = add i32 %i13, 1
+  %v13_0 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v6_1
+  %v13_1 = load i32*, i32** %pp
+  store i32 %v3_4, i32* %a0
+  %v13_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v10_1
+  %v13_4 = add i32 %v9_0, %v3_4
+  %v13_5 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v3_4
+  %v13_6 = load i32*, i32** %pp
+  %v13_7 = add i32 %v12_8, %v1_1
+  store i32 %v5_6, i32* %v1_3
+  %v13_9 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v4_0
+  %v13_10 = add i32 %v1_7, %v1_1
+  %c13 = icmp slt i32 %i13n, %v5_10
+  br i1 %c13, label %b13x, label %b14
+b13x:
+  br label %b13
+b14:
+  %i14 = phi i32 [ 0, %b13 ], [ %i14n, %b14x ]
+  %i14n = add i32 %i14, 1
+  %v14_0 = load i32, i32* %v5_8
+  %v14_1 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v12_4
+  store i32 %v5_5, i32* %v3_0
+  %v14_3 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_0
+  %v14_4 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v14_0
+  %v14_5 = load i32*, i32** %pp
+  %c14 = icmp slt i32 %i14n, %v12_4
+  br i1 %c14, label %b14x, label %b15
+b14x:
+  br label %b14
+b15:
+  %i15 = phi i32 [ 0, %b14 ], [ %i15n, %b15x ]
+  %i15n = add i32 %i15, 1
+  store i32 %v9_0, i32* %v12_1
+  %v15_1 = add i32 %v12_0, %v13_7
+  %v15_2 = getelementptr inbounds [64 x i32], [64 x i32]* %base, i32 0, i32 %v1_1
+  %v15_3 = add i32 %v0_4, %v0_1
+  %v15_4 = load i32*, i32** %pp
+  %c15 = icmp slt i32 %i15n, %v2_2
+  br i1 %c15, label %b15x, label %b16
+b15x:
+  br label %b15
+b16:
+  ret i32 %n
+}
+
+define i32 @main() {
+entry:
+  %buf = alloca [16 x i32]
+  %p = getelementptr inbounds [16 x i32], [16 x i32]* %buf, i32 0, i32 0
+  %r0 = call i32 @f0(i32* %p, i32 16)
+  %r1 = call i32 @f1(i32* %p, i32 %r0)
+  %r2 = call i32 @f2(i32* %p, i32 %r1)
+  ret i32 %r2
+}
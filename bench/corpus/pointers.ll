@@ -0,0 +1,2600 @@
+define i32* @f0(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f95(i32* %c2, i32** %p)
+  %r1 = call i32* @f102(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f1(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f33(i32* %l1, i32** %p)
+  %r1 = call i32* @f117(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f2(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f34(i32* %ld, i32** %p)
+  %r1 = call i32* @f72(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f3(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f31(i32* %ld, i32** %p)
+  %r1 = call i32* @f39(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f4(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f25(i32* %l1, i32** %p)
+  %r1 = call i32* @f22(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f5(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f6(i32* %l1, i32** %p)
+  %r1 = call i32* @f32(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f6(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f28(i32* %c2, i32** %p)
+  %r1 = call i32* @f47(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f7(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f34(i32* %l2, i32** %p)
+  %r1 = call i32* @f96(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f8(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f47(i32* %l1, i32** %p)
+  %r1 = call i32* @f55(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f9(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f18(i32* %c2, i32** %p)
+  %r1 = call i32* @f48(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f10(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f101(i32* %c2, i32** %p)
+  %r1 = call i32* @f19(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f11(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f101(i32* %c2, i32** %p)
+  %r1 = call i32* @f35(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f12(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f45(i32* %l1, i32** %p)
+  %r1 = call i32* @f108(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f13(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f114(i32* %ld, i32** %p)
+  %r1 = call i32* @f60(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f14(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f20(i32* %l2, i32** %p)
+  %r1 = call i32* @f94(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f15(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f75(i32* %c2, i32** %p)
+  %r1 = call i32* @f81(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f16(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f76(i32* %l1, i32** %p)
+  %r1 = call i32* @f92(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f17(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f29(i32* %l2, i32** %p)
+  %r1 = call i32* @f61(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f18(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f62(i32* %c2, i32** %p)
+  %r1 = call i32* @f108(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f19(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f59(i32* %l2, i32** %p)
+  %r1 = call i32* @f30(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f20(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f82(i32* %l2, i32** %p)
+  %r1 = call i32* @f113(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f21(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f73(i32* %l1, i32** %p)
+  %r1 = call i32* @f52(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f22(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f106(i32* %ld, i32** %p)
+  %r1 = call i32* @f41(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f23(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f87(i32* %c2, i32** %p)
+  %r1 = call i32* @f50(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f24(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f41(i32* %ld, i32** %p)
+  %r1 = call i32* @f38(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f25(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f79(i32* %c2, i32** %p)
+  %r1 = call i32* @f44(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f26(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f48(i32* %g, i32** %p)
+  %r1 = call i32* @f85(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f27(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f63(i32* %c2, i32** %p)
+  %r1 = call i32* @f88(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f28(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f97(i32* %l2, i32** %p)
+  %r1 = call i32* @f109(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f29(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f92(i32* %c2, i32** %p)
+  %r1 = call i32* @f95(i32* %g, i32** %p)
+  ret i32* %l1
+}
+define i32* @f30(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f76(i32* %g, i32** %p)
+  %r1 = call i32* @f115(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f31(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f117(i32* %c2, i32** %p)
+  %r1 = call i32* @f94(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f32(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f70(i32* %c2, i32** %p)
+  %r1 = call i32* @f116(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f33(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f104(i32* %c2, i32** %p)
+  %r1 = call i32* @f75(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f34(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f117(i32* %c2, i32** %p)
+  %r1 = call i32* @f79(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f35(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f88(i32* %c2, i32** %p)
+  %r1 = call i32* @f58(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f36(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f103(i32* %l2, i32** %p)
+  %r1 = call i32* @f104(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f37(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f99(i32* %c2, i32** %p)
+  %r1 = call i32* @f48(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f38(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f113(i32* %g, i32** %p)
+  %r1 = call i32* @f92(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f39(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f74(i32* %l1, i32** %p)
+  %r1 = call i32* @f65(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f40(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f64(i32* %l2, i32** %p)
+  %r1 = call i32* @f64(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f41(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f63(i32* %l1, i32** %p)
+  %r1 = call i32* @f59(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f42(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f67(i32* %g, i32** %p)
+  %r1 = call i32* @f47(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f43(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f53(i32* %g, i32** %p)
+  %r1 = call i32* @f70(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f44(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f89(i32* %ld, i32** %p)
+  %r1 = call i32* @f80(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f45(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %c2, i32** %p)
+  %r1 = call i32* @f50(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f46(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %g, i32** %p)
+  %r1 = call i32* @f90(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f47(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f64(i32* %ld, i32** %p)
+  %r1 = call i32* @f100(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f48(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f67(i32* %l2, i32** %p)
+  %r1 = call i32* @f97(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f49(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f67(i32* %g, i32** %p)
+  %r1 = call i32* @f61(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f50(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f99(i32* %l1, i32** %p)
+  %r1 = call i32* @f92(i32* %g, i32** %p)
+  ret i32* %l1
+}
+define i32* @f51(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f93(i32* %g, i32** %p)
+  %r1 = call i32* @f100(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f52(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f90(i32* %ld, i32** %p)
+  %r1 = call i32* @f101(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f53(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f87(i32* %c2, i32** %p)
+  %r1 = call i32* @f117(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f54(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f94(i32* %ld, i32** %p)
+  %r1 = call i32* @f91(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f55(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f112(i32* %l2, i32** %p)
+  %r1 = call i32* @f93(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f56(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f57(i32* %ld, i32** %p)
+  %r1 = call i32* @f91(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f57(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f108(i32* %l1, i32** %p)
+  %r1 = call i32* @f73(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f58(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f77(i32* %c2, i32** %p)
+  %r1 = call i32* @f90(i32* %g, i32** %p)
+  ret i32* %l1
+}
+define i32* @f59(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f115(i32* %g, i32** %p)
+  %r1 = call i32* @f116(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f60(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f79(i32* %g, i32** %p)
+  %r1 = call i32* @f106(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f61(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f63(i32* %ld, i32** %p)
+  %r1 = call i32* @f84(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f62(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f71(i32* %l1, i32** %p)
+  %r1 = call i32* @f63(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f63(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f70(i32* %g, i32** %p)
+  %r1 = call i32* @f76(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f64(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f103(i32* %g, i32** %p)
+  %r1 = call i32* @f109(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f65(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f96(i32* %ld, i32** %p)
+  %r1 = call i32* @f109(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f66(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f115(i32* %l1, i32** %p)
+  %r1 = call i32* @f86(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f67(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f86(i32* %ld, i32** %p)
+  %r1 = call i32* @f87(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f68(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f100(i32* %c2, i32** %p)
+  %r1 = call i32* @f103(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f69(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f73(i32* %l1, i32** %p)
+  %r1 = call i32* @f116(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f70(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f75(i32* %l1, i32** %p)
+  %r1 = call i32* @f92(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f71(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %ld, i32** %p)
+  %r1 = call i32* @f75(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f72(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f114(i32* %l1, i32** %p)
+  %r1 = call i32* @f118(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f73(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f102(i32* %l2, i32** %p)
+  %r1 = call i32* @f85(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f74(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f79(i32* %g, i32** %p)
+  %r1 = call i32* @f88(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f75(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f80(i32* %c2, i32** %p)
+  %r1 = call i32* @f79(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f76(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %l2, i32** %p)
+  %r1 = call i32* @f77(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f77(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f109(i32* %ld, i32** %p)
+  %r1 = call i32* @f100(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f78(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f97(i32* %l2, i32** %p)
+  %r1 = call i32* @f115(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f79(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f115(i32* %g, i32** %p)
+  %r1 = call i32* @f94(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f80(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f99(i32* %g, i32** %p)
+  %r1 = call i32* @f89(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f81(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f106(i32* %l2, i32** %p)
+  %r1 = call i32* @f90(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f82(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f85(i32* %l1, i32** %p)
+  %r1 = call i32* @f90(i32* %g, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f83(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f113(i32* %ld, i32** %p)
+  %r1 = call i32* @f104(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f84(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f109(i32* %l1, i32** %p)
+  %r1 = call i32* @f94(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f85(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f93(i32* %l1, i32** %p)
+  %r1 = call i32* @f117(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f86(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f109(i32* %l2, i32** %p)
+  %r1 = call i32* @f105(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f87(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f112(i32* %ld, i32** %p)
+  %r1 = call i32* @f96(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f88(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f102(i32* %c2, i32** %p)
+  %r1 = call i32* @f105(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f89(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f113(i32* %l2, i32** %p)
+  %r1 = call i32* @f102(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f90(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f97(i32* %l2, i32** %p)
+  %r1 = call i32* @f92(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f91(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %c2, i32** %p)
+  %r1 = call i32* @f92(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f92(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f112(i32* %ld, i32** %p)
+  %r1 = call i32* @f103(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f93(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f114(i32* %l2, i32** %p)
+  %r1 = call i32* @f96(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f94(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f110(i32* %l2, i32** %p)
+  %r1 = call i32* @f112(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f95(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f105(i32* %l2, i32** %p)
+  %r1 = call i32* @f97(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f96(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f108(i32* %c2, i32** %p)
+  %r1 = call i32* @f98(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f97(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f102(i32* %l1, i32** %p)
+  %r1 = call i32* @f119(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f98(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f104(i32* %l1, i32** %p)
+  %r1 = call i32* @f105(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f99(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f119(i32* %ld, i32** %p)
+  %r1 = call i32* @f111(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f100(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f103(i32* %ld, i32** %p)
+  %r1 = call i32* @f106(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f101(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f103(i32* %g, i32** %p)
+  %r1 = call i32* @f115(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f102(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %l2, i32** %p)
+  %r1 = call i32* @f104(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f103(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f115(i32* %l1, i32** %p)
+  %r1 = call i32* @f106(i32* %l2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f104(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f119(i32* %ld, i32** %p)
+  %r1 = call i32* @f105(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f105(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f118(i32* %l1, i32** %p)
+  %r1 = call i32* @f106(i32* %c2, i32** %p)
+  ret i32* %l1
+}
+define i32* @f106(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f117(i32* %l1, i32** %p)
+  %r1 = call i32* @f107(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f107(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f114(i32* %l2, i32** %p)
+  %r1 = call i32* @f116(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f108(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f110(i32* %l1, i32** %p)
+  %r1 = call i32* @f117(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f109(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f113(i32* %g, i32** %p)
+  %r1 = call i32* @f110(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f110(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f117(i32* %g, i32** %p)
+  %r1 = call i32* @f113(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f111(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f119(i32* %l2, i32** %p)
+  %r1 = call i32* @f113(i32* %l2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f112(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f119(i32* %c2, i32** %p)
+  %r1 = call i32* @f119(i32* %ld, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f113(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f114(i32* %ld, i32** %p)
+  %r1 = call i32* @f115(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f114(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f116(i32* %c2, i32** %p)
+  %r1 = call i32* @f115(i32* %ld, i32** %p)
+  ret i32* %l1
+}
+define i32* @f115(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f117(i32* %c2, i32** %p)
+  %r1 = call i32* @f118(i32* %l1, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f116(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f118(i32* %g, i32** %p)
+  %r1 = call i32* @f117(i32* %c2, i32** %p)
+  %s = select i1 true, i32* %r0, i32* %l2
+  ret i32* %s
+}
+define i32* @f117(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f118(i32* %ld, i32** %p)
+  %r1 = call i32* @f118(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f118(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %a, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  %r0 = call i32* @f119(i32* %l1, i32** %p)
+  ret i32* %l1
+}
+define i32* @f119(i32* %a, i32** %pp) {
+entry:
+  %x = alloca i32
+  %y = alloca i32
+  %p = alloca i32*
+  %q = alloca i32*
+  %a.addr = alloca i32*
+  store i32* %a, i32** %a.addr
+  store i32* %x, i32** %p
+  store i32* %y, i32** %q
+  %l1 = load i32*, i32** %p
+  %l2 = load i32*, i32** %q
+  %ld = load i32*, i32** %pp
+  store i32* %l1, i32** %pp
+  %c = bitcast i32* %l2 to i8*
+  %c2 = bitcast i8* %c to i32*
+  %g = getelementptr i32, i32* %c2, i64 1
+  ret i32* %l1
+}
+define i32 @main() {
+  %m = alloca i32
+  %mp = alloca i32*
+  store i32* %m, i32** %mp
+  %r = call i32* @f0(i32* %m, i32** %mp)
+  ret i32 0
+}
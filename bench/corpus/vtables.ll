@@ -0,0 +1,70 @@
+%struct.A = type { i32 (...)** }
+%struct.B = type { %struct.A }
+%struct.C = type { i32 (...)** }
+
+@_ZTV1A = constant { [4 x i8*] } { [4 x i8*] [i8* null, i8* null, i8* bitcast (i32 (%struct.A*)* @_ZN1A1fEv to i8*), i8* bitcast (i32 (%struct.A*)* @_ZN1A1gEv to i8*)] }, align 8, !type !0
+@_ZTV1B = constant { [4 x i8*] } { [4 x i8*] [i8* null, i8* null, i8* bitcast (i32 (%struct.B*)* @_ZN1B1fEv to i8*), i8* bitcast (i32 (%struct.A*)* @_ZN1A1gEv to i8*)] }, align 8, !type !0, !type !1
+@_ZTV1C = constant { [3 x i8*] } { [3 x i8*] [i8* null, i8* null, i8* bitcast (i32 (%struct.C*)* @_ZN1C1fEv to i8*)] }, align 8, !type !2
+
+define i32 @_ZN1A1fEv(%struct.A* %this) { ret i32 1 }
+define i32 @_ZN1A1gEv(%struct.A* %this) { ret i32 2 }
+define i32 @_ZN1B1fEv(%struct.B* %this) { ret i32 3 }
+define i32 @_ZN1C1fEv(%struct.C* %this) { ret i32 4 }
+
+define void @_ZN1BC2Ev(%struct.B* %this) {
+  %1 = bitcast %struct.B* %this to i32 (...)***
+  store i32 (...)** bitcast (i8** getelementptr inbounds ({ [4 x i8*] }, { [4 x i8*] }* @_ZTV1B, i32 0, inrange i32 0, i32 2) to i32 (...)**), i32 (...)*** %1
+  ret void
+}
+define void @_ZN1AC2Ev(%struct.A* %this) {
+  %1 = bitcast %struct.A* %this to i32 (...)***
+  store i32 (...)** bitcast (i8** getelementptr inbounds ({ [4 x i8*] }, { [4 x i8*] }* @_ZTV1A, i32 0, inrange i32 0, i32 2) to i32 (...)**), i32 (...)*** %1
+  ret void
+}
+
+define i32 @main() {
+  %b = alloca %struct.B
+  %a = alloca %struct.A
+  call void @_ZN1BC2Ev(%struct.B* %b)
+  call void @_ZN1AC2Ev(%struct.A* %a)
+  %r0 = call i32 @callg(%struct.A* %a)
+  %r1 = call i32 @callb(%struct.B* %b)
+  %r = add i32 %r0, %r1
+  ret i32 %r
+}
+
+declare i1 @llvm.type.test(i8*, metadata)
+declare void @llvm.assume(i1)
+
+define i32 @callg(%struct.A* %a) {
+entry:
+  %0 = bitcast %struct.A* %a to i32 (%struct.A*)***
+  %vtable = load i32 (%struct.A*)**, i32 (%struct.A*)*** %0
+  %1 = bitcast i32 (%struct.A*)** %vtable to i8*
+  %2 = call i1 @llvm.type.test(i8* %1, metadata !"_ZTS1A")
+  call void @llvm.assume(i1 %2)
+  %vfn = getelementptr inbounds i32 (%struct.A*)*, i32 (%struct.A*)** %vtable, i64 1
+  %3 = load i32 (%struct.A*)*, i32 (%struct.A*)** %vfn
+  %call = call i32 %3(%struct.A* %a)
+  %vtable2 = load i32 (%struct.A*)**, i32 (%struct.A*)*** %0
+  %4 = load i32 (%struct.A*)*, i32 (%struct.A*)** %vtable2
+  %call2 = call i32 %4(%struct.A* %a)
+  %s = add i32 %call, %call2
+  ret i32 %s
+}
+
+define i32 @callb(%struct.B* %b) {
+entry:
+  %0 = bitcast %struct.B* %b to i32 (%struct.B*)***
+  %vtable = load i32 (%struct.B*)**, i32 (%struct.B*)*** %0
+  %1 = bitcast i32 (%struct.B*)** %vtable to i8*
+  %2 = call i1 @llvm.type.test(i8* %1, metadata !"_ZTS1B")
+  call void @llvm.assume(i1 %2)
+  %3 = load i32 (%struct.B*)*, i32 (%struct.B*)** %vtable
+  %call = call i32 %3(%struct.B* %b)
+  ret i32 %call
+}
+
+!0 = !{i64 16, !"_ZTS1A"}
+!1 = !{i64 16, !"_ZTS1B"}
+!2 = !{i64 16, !"_ZTS1C"}
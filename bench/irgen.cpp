@@ -0,0 +1,25 @@
+// Writes a synthetic module to stdout, e.g.
+//   irgen functions=500 blocks=40 depth=3 phi=0.5 chain=4 fanout=4
+//         indirect=0.3 seed=7 > big.ll
+#include "irgen.h"
+
+#include "llvm/Support/InitLLVM.h"
+
+using namespace llvm;
+
+int main(int argc, char *argv[]) {
+  InitLLVM X(argc, argv);
+  GenParams params;
+  for (int i = 1; i < argc; ++i) {
+    auto [key, value] = StringRef(argv[i]).split('=');
+    if (!params.set(key, value)) {
+      errs() << "Unknown parameter " << argv[i] << "\n";
+      errs() << "Defaults: " << params.str() << "\n";
+      exit(1);
+    }
+  }
+  LLVMContext context;
+  auto module = generateModule(context, params);
+  outs() << "; " << params.str() << "\n";
+  module->print(outs(), nullptr);
+}
@@ -0,0 +1,323 @@
+// Synthetic LLVM module generator for scaling benchmarks. Every generated
+// function has the type i8* (i8*, i32) and a body of nested counted loops,
+// if/else diamonds, pointer chains through memory and calls, all controlled
+// by GenParams. The same parameters and seed always give the same module.
+#pragma once
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Verifier.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+struct GenParams {
+  unsigned functions = 100;
+  unsigned blocks = 20;     // basic blocks per function, roughly
+  unsigned loopDepth = 2;   // deepest loop nest
+  double phiDensity = 0.5;  // chance of an extra phi per block
+  unsigned chainLength = 2; // levels of indirection per pointer chain
+  unsigned fanout = 3;      // call sites per function
+  double indirectRatio = 0.25;
+  // 0 gives every function the same shape. Larger values draw each
+  // function's block count from a heavier Pareto tail (capped at 64x) and
+  // its loop depth and phi density uniformly up to twice the defaults.
+  double skew = 0;
+  unsigned seed = 1;
+
+  // Sets key=value; returns false for an unknown key or a bad number.
+  bool set(llvm::StringRef key, llvm::StringRef value) {
+    double num;
+    if (value.getAsDouble(num))
+      return false;
+    if (key == "functions") {
+      functions = std::max(1.0, num);
+    } else if (key == "blocks") {
+      blocks = num;
+    } else if (key == "depth") {
+      loopDepth = num;
+    } else if (key == "phi") {
+      phiDensity = num;
+    } else if (key == "chain") {
+      chainLength = num;
+    } else if (key == "fanout") {
+      fanout = num;
+    } else if (key == "indirect") {
+      indirectRatio = num;
+    } else if (key == "skew") {
+      skew = num;
+    } else if (key == "seed") {
+      seed = num;
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  std::string str() const {
+    return "functions=" + std::to_string(functions) +
+           " blocks=" + std::to_string(blocks) +
+           " depth=" + std::to_string(loopDepth) +
+           " phi=" + std::to_string(phiDensity) +
+           " chain=" + std::to_string(chainLength) +
+           " fanout=" + std::to_string(fanout) +
+           " indirect=" + std::to_string(indirectRatio) +
+           " skew=" + std::to_string(skew) +
+           " seed=" + std::to_string(seed);
+  }
+};
+
+class IRGenerator {
+public:
+  IRGenerator(llvm::LLVMContext &context, const GenParams &params)
+      : context(context), params(params), rng(params.seed),
+        builder(context) {}
+
+  std::unique_ptr<llvm::Module> generate() {
+    using namespace llvm;
+    module = std::make_unique<Module>("synthetic", context);
+    i8p = Type::getInt8PtrTy(context);
+    i32 = Type::getInt32Ty(context);
+    fnType = FunctionType::get(i8p, {i8p, i32}, false);
+
+    for (unsigned i = 0; i < params.functions; ++i) {
+      funcs.push_back(Function::Create(fnType, Function::ExternalLinkage,
+                                       "f" + std::to_string(i), *module));
+    }
+    // Indirect calls load their target from one of these tables, which
+    // functions also overwrite.
+    unsigned tableCount = std::max(1u, params.functions / 8);
+    for (unsigned i = 0; i < tableCount; ++i) {
+      tables.push_back(new GlobalVariable(
+          *module, fnType->getPointerTo(), false, GlobalValue::ExternalLinkage,
+          randomFunc(), "table" + std::to_string(i)));
+    }
+    for (auto *func : funcs) {
+      emitFunction(func);
+    }
+    emitMain();
+    if (verifyModule(*module, &errs()))
+      report_fatal_error("generated module is broken");
+    return std::move(module);
+  }
+
+private:
+  llvm::LLVMContext &context;
+  GenParams params;
+  std::mt19937 rng;
+  llvm::IRBuilder<> builder;
+  std::unique_ptr<llvm::Module> module;
+  llvm::Type *i8p = nullptr;
+  llvm::Type *i32 = nullptr;
+  llvm::FunctionType *fnType = nullptr;
+  std::vector<llvm::Function *> funcs;
+  std::vector<llvm::GlobalVariable *> tables;
+
+  // Per-function state: the values live at the insertion point.
+  llvm::Function *func = nullptr;
+  llvm::Value *ptr = nullptr;
+  llvm::Value *num = nullptr;
+  std::vector<llvm::AllocaInst *> slots;
+  int blocksLeft = 0;
+  unsigned callsLeft = 0;
+  unsigned loopDepth = 0;
+  double phiDensity = 0;
+
+  bool chance(double p) {
+    return std::uniform_real_distribution<double>(0, 1)(rng) < p;
+  }
+
+  unsigned pick(size_t n) {
+    return std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+  }
+
+  llvm::Function *randomFunc() { return funcs[pick(funcs.size())]; }
+
+  llvm::BasicBlock *newBlock() {
+    blocksLeft--;
+    return llvm::BasicBlock::Create(context, "", func);
+  }
+
+  void emitFunction(llvm::Function *f) {
+    using namespace llvm;
+    func = f;
+    blocksLeft = params.blocks;
+    loopDepth = params.loopDepth;
+    phiDensity = params.phiDensity;
+    if (params.skew > 0) {
+      double u = std::uniform_real_distribution<double>(1.0 / 4096, 1)(rng);
+      blocksLeft *= std::min(64.0, std::pow(u, -params.skew));
+      loopDepth = pick(2 * params.loopDepth + 1);
+      phiDensity = std::min(
+          1.0, std::uniform_real_distribution<double>(
+                   0, 2 * params.phiDensity)(rng));
+    }
+    callsLeft = params.fanout;
+    builder.SetInsertPoint(newBlock());
+    ptr = func->getArg(0);
+    num = func->getArg(1);
+    // Slot k holds a pointer with k + 1 levels of indirection.
+    slots.clear();
+    Type *slotType = i8p;
+    for (unsigned k = 0; k < params.chainLength; ++k) {
+      slots.push_back(builder.CreateAlloca(slotType));
+      slotType = slotType->getPointerTo();
+    }
+    emitRegion(0);
+    while (callsLeft > 0) {
+      emitCall();
+    }
+    builder.CreateRet(ptr);
+  }
+
+  void emitRegion(unsigned depth) {
+    while (blocksLeft > 0) {
+      if (depth < loopDepth && blocksLeft >= 3 && chance(0.5)) {
+        emitLoop(depth + 1);
+      } else {
+        emitStraight();
+      }
+      if (depth > 0 && chance(0.5))
+        return;
+    }
+  }
+
+  // header: phis for the counter, the pointer and maybe more values.
+  // body: a nested region. latch: counter increment and back edge.
+  void emitLoop(unsigned depth) {
+    using namespace llvm;
+    BasicBlock *preheader = builder.GetInsertBlock();
+    BasicBlock *header = newBlock();
+    builder.CreateBr(header);
+    builder.SetInsertPoint(header);
+    PHINode *counter = builder.CreatePHI(i32, 2);
+    counter->addIncoming(builder.getInt32(0), preheader);
+    PHINode *ptrPhi = builder.CreatePHI(i8p, 2);
+    ptrPhi->addIncoming(ptr, preheader);
+    PHINode *numPhi = nullptr;
+    if (chance(phiDensity)) {
+      numPhi = builder.CreatePHI(i32, 2);
+      numPhi->addIncoming(num, preheader);
+      num = numPhi;
+    }
+    Value *bound = num;
+    ptr = ptrPhi;
+
+    emitRegion(depth);
+
+    BasicBlock *latch = newBlock();
+    builder.CreateBr(latch);
+    builder.SetInsertPoint(latch);
+    Value *next = builder.CreateAdd(counter, builder.getInt32(1));
+    Value *cond = builder.CreateICmpSLT(next, bound);
+    BasicBlock *exit = newBlock();
+    builder.CreateCondBr(cond, header, exit);
+    counter->addIncoming(next, latch);
+    ptrPhi->addIncoming(ptr, latch);
+    if (numPhi)
+      numPhi->addIncoming(num, latch);
+    builder.SetInsertPoint(exit);
+    num = builder.CreateAdd(num, counter);
+  }
+
+  // One block of arithmetic, a pointer chain and maybe a call, or an if/else
+  // diamond joined by phis.
+  void emitStraight() {
+    using namespace llvm;
+    num = builder.CreateAdd(num, builder.getInt32(pick(16) + 1));
+    emitChain();
+    if (callsLeft > 0 && chance((double)callsLeft / std::max(1, blocksLeft)))
+      emitCall();
+
+    if (blocksLeft >= 3 && chance(phiDensity)) {
+      Value *cond = builder.CreateICmpSGT(num, builder.getInt32(pick(64)));
+      BasicBlock *thenBB = newBlock();
+      BasicBlock *elseBB = newBlock();
+      BasicBlock *join = newBlock();
+      builder.CreateCondBr(cond, thenBB, elseBB);
+      Value *before = ptr;
+      builder.SetInsertPoint(thenBB);
+      Value *thenNum = builder.CreateMul(num, builder.getInt32(3));
+      Value *thenPtr = builder.CreateGEP(builder.getInt8Ty(), ptr,
+                                         builder.getInt32(pick(8)));
+      builder.CreateBr(join);
+      builder.SetInsertPoint(elseBB);
+      emitChain();
+      Value *elseNum = builder.CreateSub(num, builder.getInt32(1));
+      Value *elsePtr = ptr;
+      builder.CreateBr(join);
+      builder.SetInsertPoint(join);
+      PHINode *numPhi = builder.CreatePHI(i32, 2);
+      numPhi->addIncoming(thenNum, thenBB);
+      numPhi->addIncoming(elseNum, elseBB);
+      PHINode *ptrPhi = builder.CreatePHI(i8p, 2);
+      ptrPhi->addIncoming(thenPtr, thenBB);
+      ptrPhi->addIncoming(elsePtr, elseBB);
+      num = numPhi;
+      ptr = chance(0.5) ? (Value *)ptrPhi : before;
+    } else if (blocksLeft > 0) {
+      BasicBlock *next = newBlock();
+      builder.CreateBr(next);
+      builder.SetInsertPoint(next);
+    }
+  }
+
+  // Stores the pointer through every slot level and loads it back.
+  void emitChain() {
+    if (slots.empty())
+      return;
+    builder.CreateStore(ptr, slots[0]);
+    for (size_t k = 1; k < slots.size(); ++k) {
+      builder.CreateStore(slots[k - 1], slots[k]);
+    }
+    llvm::Value *level = slots.back();
+    for (size_t k = slots.size(); k > 0; --k) {
+      level = builder.CreateLoad(slots[k - 1]->getAllocatedType(), level);
+    }
+    ptr = level;
+  }
+
+  void emitCall() {
+    using namespace llvm;
+    callsLeft--;
+    Value *callee;
+    if (chance(params.indirectRatio)) {
+      GlobalVariable *table = tables[pick(tables.size())];
+      callee = builder.CreateLoad(fnType->getPointerTo(), table);
+      if (chance(0.5))
+        builder.CreateStore(randomFunc(), tables[pick(tables.size())]);
+    } else {
+      callee = randomFunc();
+    }
+    ptr = builder.CreateCall(fnType, callee, {ptr, num});
+  }
+
+  void emitMain() {
+    using namespace llvm;
+    Function *mainFunc =
+        Function::Create(FunctionType::get(i32, false),
+                         Function::ExternalLinkage, "main", *module);
+    builder.SetInsertPoint(BasicBlock::Create(context, "entry", mainFunc));
+    Value *buf = builder.CreateAlloca(ArrayType::get(builder.getInt8Ty(), 64));
+    Value *p = builder.CreateBitCast(buf, i8p);
+    for (unsigned i = 0; i < std::min(3u, params.functions); ++i) {
+      p = builder.CreateCall(fnType, funcs[i], {p, builder.getInt32(16)});
+    }
+    builder.CreateRet(builder.getInt32(0));
+  }
+};
+
+inline std::unique_ptr<llvm::Module> generateModule(llvm::LLVMContext &context,
+                                                    const GenParams &params) {
+  return IRGenerator(context, params).generate();
+}
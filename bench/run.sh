@@ -0,0 +1,3 @@
+# Runs the suite over corpus/ and writes the results to results.json.
+# ./run.sh --sweep runs the generator sweeps instead.
+./bench corpus --benchmark_out=results.json --benchmark_out_format=json "$@"
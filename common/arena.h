@@ -0,0 +1,218 @@
+// Per-thread bump arenas for per-function analysis state. arena::Allocator
+// is a stateless STL allocator that draws from the calling thread's arena,
+// so containers built from the aliases below (arena::Set, arena::UnorderedMap,
+// ...) nest and default-construct like their std counterparts, but never
+// call malloc in the steady state and never take a lock.
+//
+// Freed blocks go onto per-size free lists of the same arena, so worklists
+// that churn through copies stay bounded. When the outermost arena::Scope
+// of a thread ends, the whole arena is rewound in one step.
+//
+// Containers using the arena must be destroyed before their Scope ends and
+// must not be handed to another thread; results that outlive the function
+// stay in std containers.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <map>
+#include <new>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifndef ARENA_CHUNK
+#define ARENA_CHUNK (64 * 1024)
+#endif
+
+// Bytes of chunks a thread keeps for the next function after a reset.
+#ifndef ARENA_RETAIN
+#define ARENA_RETAIN (1024 * 1024)
+#endif
+
+namespace arena {
+
+class Arena {
+public:
+  Arena() = default;
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+  ~Arena() {
+    for (auto &chunk : chunks) {
+      ::operator delete(chunk.begin);
+    }
+  }
+
+  void *allocate(size_t size) {
+    int cls = sizeClass(size);
+    if (cls >= 0) {
+      if (FreeBlock *block = freeLists[cls]) {
+        freeLists[cls] = block->next;
+        return block;
+      }
+      size = classSize(cls);
+    } else {
+      size = roundUp(size);
+    }
+    if (size > (size_t)(end - ptr))
+      grow(size);
+    void *result = ptr;
+    ptr += size;
+    return result;
+  }
+
+  void deallocate(void *p, size_t size) {
+    int cls = sizeClass(size);
+    if (cls < 0)
+      return;
+    auto *block = static_cast<FreeBlock *>(p);
+    block->next = freeLists[cls];
+    freeLists[cls] = block;
+  }
+
+  // Drops every allocation at once. Keeps up to ARENA_RETAIN bytes of
+  // chunks for reuse and returns the rest to the system.
+  void reset() {
+    std::fill(std::begin(freeLists), std::end(freeLists), nullptr);
+    size_t kept = 0, n = 0;
+    for (auto &chunk : chunks) {
+      if (kept + chunk.size <= ARENA_RETAIN) {
+        kept += chunk.size;
+        chunks[n++] = chunk;
+      } else {
+        ::operator delete(chunk.begin);
+      }
+    }
+    chunks.resize(n);
+    current = 0;
+    ptr = end = nullptr;
+    if (!chunks.empty()) {
+      ptr = chunks[0].begin;
+      end = ptr + chunks[0].size;
+    }
+  }
+
+private:
+  struct Chunk {
+    char *begin;
+    size_t size;
+  };
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  static constexpr size_t Align = alignof(std::max_align_t);
+  // 16-byte steps up to 256 bytes, then powers of two up to 64 KiB; larger
+  // blocks are not reused before the reset.
+  static constexpr int SmallClasses = 256 / Align;
+  static constexpr int NumClasses = SmallClasses + 8;
+
+  static size_t roundUp(size_t size) {
+    return (std::max<size_t>(size, 1) + Align - 1) & ~(Align - 1);
+  }
+  static int sizeClass(size_t size) {
+    size = roundUp(size);
+    if (size <= 256)
+      return size / Align - 1;
+    for (int cls = SmallClasses; cls < NumClasses; ++cls) {
+      if (size <= classSize(cls))
+        return cls;
+    }
+    return -1;
+  }
+  static size_t classSize(int cls) {
+    if (cls < SmallClasses)
+      return (cls + 1) * Align;
+    return (size_t)512 << (cls - SmallClasses);
+  }
+
+  // Moves on to the next retained chunk that fits, or allocates a new one.
+  void grow(size_t size) {
+    while (++current < chunks.size()) {
+      if (chunks[current].size >= size) {
+        ptr = chunks[current].begin;
+        end = ptr + chunks[current].size;
+        return;
+      }
+    }
+    size_t chunkSize = std::max<size_t>(ARENA_CHUNK, size);
+    chunks.push_back({static_cast<char *>(::operator new(chunkSize)), chunkSize});
+    current = chunks.size() - 1;
+    ptr = chunks[current].begin;
+    end = ptr + chunkSize;
+  }
+
+  std::vector<Chunk> chunks;
+  size_t current = 0;
+  char *ptr = nullptr;
+  char *end = nullptr;
+  FreeBlock *freeLists[NumClasses] = {};
+};
+
+inline thread_local Arena localArena;
+inline thread_local int scopeDepth = 0;
+
+inline Arena &local() { return localArena; }
+
+// Marks the lifetime of one function's analysis state on this thread.
+// Nested scopes are free; the outermost one resets the arena when it ends.
+class Scope {
+public:
+  Scope() { ++scopeDepth; }
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+  ~Scope() {
+    if (--scopeDepth == 0)
+      localArena.reset();
+  }
+
+  // For state that is reused across functions: resets the arena early if
+  // no other scope is open. Every container must be empty and released.
+  void reset() {
+    if (scopeDepth == 1)
+      localArena.reset();
+  }
+};
+
+template <typename T> struct Allocator {
+  using value_type = T;
+
+  Allocator() = default;
+  template <typename U> Allocator(const Allocator<U> &) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(localArena.allocate(n * sizeof(T)));
+  }
+  void deallocate(T *p, size_t n) { localArena.deallocate(p, n * sizeof(T)); }
+
+  template <typename U> bool operator==(const Allocator<U> &) const {
+    return true;
+  }
+  template <typename U> bool operator!=(const Allocator<U> &) const {
+    return false;
+  }
+};
+
+template <typename T> using Vector = std::vector<T, Allocator<T>>;
+template <typename T>
+using Set = std::set<T, std::less<T>, Allocator<T>>;
+template <typename K, typename V>
+using Map = std::map<K, V, std::less<K>, Allocator<std::pair<const K, V>>>;
+template <typename T>
+using UnorderedSet =
+    std::unordered_set<T, std::hash<T>, std::equal_to<T>, Allocator<T>>;
+template <typename K, typename V>
+using UnorderedMap =
+    std::unordered_map<K, V, std::hash<K>, std::equal_to<K>,
+                       Allocator<std::pair<const K, V>>>;
+template <typename T>
+using Queue = std::queue<T, std::deque<T, Allocator<T>>>;
+
+} // namespace arena
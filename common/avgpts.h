@@ -0,0 +1,61 @@
+// The "Average points-to set size" the points-to tools print and bench
+// reports as avg_pts, defined once so that the engines compare: the mean
+// number of objects a pointer-typed argument or instruction of the analyzed
+// functions may point to, empty sets included. Objects are allocas and
+// GEPs, as the Andersen tools model them.
+//
+// Every value of the domain counts, whether the engine gave it a set or
+// not, so a coarser engine over the same functions never reports less.
+#pragma once
+
+#include "llvm/IR/Argument.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Value.h"
+
+#include <cstddef>
+
+namespace avgpts {
+
+inline bool isObject(const llvm::Value *val) {
+  return llvm::isa<llvm::AllocaInst>(val) ||
+         llvm::isa<llvm::GetElementPtrInst>(val);
+}
+
+// Whether val is in the domain of the mean.
+inline bool counted(const llvm::Value *val) {
+  return (llvm::isa<llvm::Argument>(val) || llvm::isa<llvm::Instruction>(val)) &&
+         val->getType()->isPointerTy();
+}
+
+struct Mean {
+  size_t values = 0;
+  size_t total = 0;
+
+  void add(llvm::Value *val, size_t size) {
+    if (!counted(val))
+      return;
+    ++values;
+    total += size;
+  }
+
+  // Adds the counted values of func, with size(val) objects each. A
+  // declaration is not analyzed and adds nothing.
+  template <typename Size> void add(llvm::Function &func, Size &&size) {
+    if (func.isDeclaration())
+      return;
+    for (auto &arg : func.args()) {
+      if (counted(&arg))
+        add(&arg, size(&arg));
+    }
+    for (auto &inst : llvm::instructions(func)) {
+      if (counted(&inst))
+        add(&inst, size(&inst));
+    }
+  }
+
+  double get() const { return values ? (double)total / values : 0; }
+};
+
+} // namespace avgpts
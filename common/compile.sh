@@ -0,0 +1,3 @@
+# Fits a cost model from CSVs written by the tools' -DCSV builds, e.g.
+# ./fitcost points2 p2.csv ... (see cost.h)
+clang++ -O3 fitcost.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o fitcost
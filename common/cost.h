@@ -0,0 +1,150 @@
+// Cost model for ordering scheduler tasks longest-processing-time first.
+// Block count alone predicts analysis time poorly, so a function is
+// described by a few cheap structural features and its time is predicted
+// with a power law fitted per analysis:
+//
+//   time(us) = exp(intercept + sum_i weight_i * log(1 + feature_i)) - 1
+//
+// The tools' CSV modes write the features next to the measured time, and
+// fitcost.cpp fits the weights from one or more of those CSVs.
+#pragma once
+
+#include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum CostFeature {
+  Insts,
+  Blocks,
+  Phis,
+  LoopDepth,
+  BackEdges,
+  PointerInsts,
+  Calls,
+  NumCostFeatures
+};
+constexpr const char *costFeatureNames[NumCostFeatures] = {
+    "insts", "blocks", "phis", "depth", "backedges", "ptrs", "calls"};
+
+struct FuncFeatures {
+  double values[NumCostFeatures] = {};
+
+  FuncFeatures() = default;
+
+  // One pass over the instructions and one RPO walk of the CFG. Loop depth
+  // is the largest number of [header, latch] RPO intervals of back edges
+  // that overlap, which matches the loop nest on structured code without
+  // building a dominator tree.
+  explicit FuncFeatures(llvm::Function &func) {
+    using namespace llvm;
+    for (auto &BB : func) {
+      values[Blocks]++;
+      for (auto &inst : BB) {
+        values[Insts]++;
+        if (isa<PHINode>(inst))
+          values[Phis]++;
+        if (isa<CallBase>(inst))
+          values[Calls]++;
+        if (inst.getType()->isPointerTy() || isa<LoadInst>(inst) ||
+            isa<StoreInst>(inst))
+          values[PointerInsts]++;
+      }
+    }
+    if (func.isDeclaration())
+      return;
+
+    DenseMap<BasicBlock *, unsigned> order;
+    ReversePostOrderTraversal<Function *> RPOT(&func);
+    unsigned counter = 0;
+    for (BasicBlock *BB : RPOT) {
+      order[BB] = counter++;
+    }
+    // +1 opens a loop at its header, -1 closes it after its latch.
+    std::vector<std::pair<unsigned, int>> bounds;
+    for (BasicBlock *BB : RPOT) {
+      for (BasicBlock *succ : successors(BB)) {
+        if (order[succ] <= order[BB]) {
+          values[BackEdges]++;
+          bounds.push_back({order[succ], 1});
+          bounds.push_back({order[BB] + 1, -1});
+        }
+      }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    int depth = 0;
+    for (auto [at, delta] : bounds) {
+      depth += delta;
+      values[LoopDepth] = std::max<double>(values[LoopDepth], depth);
+    }
+  }
+
+  static std::string csvHeader() {
+    std::string header;
+    for (auto *name : costFeatureNames) {
+      header += std::string(header.empty() ? "" : ",") + name;
+    }
+    return header;
+  }
+
+  std::string csvRow() const {
+    std::string row;
+    for (int i = 0; i < NumCostFeatures; ++i) {
+      row += (i ? "," : "") + std::to_string((long long)values[i]);
+    }
+    return row;
+  }
+};
+
+struct CostModel {
+  double intercept;
+  double weights[NumCostFeatures];
+
+  // Predicted time in us.
+  double predict(const FuncFeatures &features) const {
+    double x = intercept;
+    for (int i = 0; i < NumCostFeatures; ++i) {
+      x += weights[i] * std::log1p(features.values[i]);
+    }
+    return std::expm1(x);
+  }
+
+  double predict(llvm::Function &func) const {
+    return predict(FuncFeatures(func));
+  }
+};
+
+// Fitted by fitcost on skewed irgen modules (skew=1,2; p2 runs out of
+// memory on them) and the test IR. Spearman correlation of predicted and
+// measured time, block count vs. model: liveness 0.934 vs 0.977, p2 0.819
+// vs 0.962, 0cfa 0.158 vs 0.560, slicing 0.943 vs 0.985.
+constexpr CostModel liveCost = {
+    -0.7517, {0.0000, 0.7465, 0.0000, 0.7009, 0.0000, 0.3012, 0.0000}};
+constexpr CostModel points2Cost = {
+    -2.4502, {0.0000, 0.1686, 0.2320, 0.0000, 0.0000, 0.9074, 0.5208}};
+constexpr CostModel cfaCost = {
+    -0.1469, {0.0000, 0.0000, 0.0000, 0.0000, 0.0840, 0.0000, 0.6138}};
+constexpr CostModel sliceCost = {
+    -1.3212, {0.0000, 0.1519, 0.0000, 0.1533, 0.1817, 0.6250, 0.0000}};
+
+// With no negative weight, a function that has at least as much of every
+// feature as another never costs less, so LPT never runs a larger function
+// after a smaller one.
+constexpr bool isMonotone(const CostModel &model) {
+  for (double weight : model.weights) {
+    if (weight < 0)
+      return false;
+  }
+  return true;
+}
+static_assert(isMonotone(liveCost) && isMonotone(points2Cost) &&
+                  isMonotone(cfaCost) && isMonotone(sliceCost),
+              "a larger function must never cost less than a smaller one");
@@ -0,0 +1,555 @@
+// Monotone dataflow framework over dense bitsets. A problem names its
+// direction and meet as types and supplies its transfer function; Solver is
+// instantiated per problem, so the worklist loop, the meet and the transfer
+// are all inlined into one specialized solver for each analysis.
+//
+// Facts are bits of an llvm::BitVector over a per-function universe the
+// problem numbers densely (values, stores or expressions), and blocks are
+// numbered in reverse post-order, so the solver never hashes a pointer.
+//
+// Four problems ship here: Liveness, ReachingDefs, AvailableExprs and
+// VeryBusyExprs. A new one usually derives from GenKillProblem and fills
+// in gen and kill per block. SnapshotLiveness runs on a snapshot.h copy of
+// the module instead of the IR.
+//
+// Problems and solvers keep their per-function state in the calling thread's
+// arena (arena.h), so callers open an arena::Scope that outlives both. The
+// words of Facts wider than their inline storage and the DenseMap indexes
+// still come from malloc; results that outlive the function are copied out.
+#pragma once
+
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/InstrTypes.h"
+#include "llvm/IR/Instructions.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "arena.h"
+#include "instrument.h"
+#include "snapshot.h"
+
+namespace dataflow {
+
+using Facts = llvm::BitVector;
+
+// Blocks numbered with the reachable ones first, in reverse post-order, and
+// the unreachable ones after them in layout order.
+struct BlockGraph {
+  arena::Vector<llvm::BasicBlock *> blocks;
+  llvm::DenseMap<const llvm::BasicBlock *, unsigned> index;
+  arena::Vector<uint32_t> ids, order;
+  arena::Vector<llvm::SmallVector<unsigned, 2>> preds, succs;
+  unsigned reachable = 0;
+
+  explicit BlockGraph(llvm::Function &func) {
+    using namespace llvm;
+    for (BasicBlock *BB : ReversePostOrderTraversal<Function *>(&func)) {
+      index[BB] = blocks.size();
+      blocks.push_back(BB);
+    }
+    reachable = blocks.size();
+    for (auto &BB : func) {
+      if (index.try_emplace(&BB, blocks.size()).second)
+        blocks.push_back(&BB);
+    }
+    preds.resize(blocks.size());
+    succs.resize(blocks.size());
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+      for (BasicBlock *succ : successors(blocks[b])) {
+        unsigned s = index[succ];
+        succs[b].push_back(s);
+        preds[s].push_back(b);
+      }
+    }
+  }
+
+  // From a snapshot: ids holds the snapshot blocks instead of blocks, and
+  // order maps snapshot block first + k to its position.
+  BlockGraph(const snapshot::Module &ir, uint32_t func) {
+    auto range = ir.blocks(func);
+    uint32_t first = *range.begin();
+    size_t n = range.size();
+    order.assign(n, snapshot::None);
+    ids.reserve(n);
+    // Iterative DFS; post-order reversed in place afterwards.
+    arena::Vector<std::pair<uint32_t, unsigned>> stack;
+    if (n) {
+      stack.push_back({first, 0});
+      order[0] = 0;
+    }
+    while (!stack.empty()) {
+      auto &[b, next] = stack.back();
+      auto out = ir.successors(b);
+      if (next < out.size()) {
+        uint32_t s = out[next++];
+        if (order[s - first] == snapshot::None) {
+          order[s - first] = 0;
+          stack.push_back({s, 0});
+        }
+        continue;
+      }
+      ids.push_back(b);
+      stack.pop_back();
+    }
+    std::reverse(ids.begin(), ids.end());
+    reachable = ids.size();
+    for (uint32_t b : range) {
+      if (order[b - first] == snapshot::None)
+        ids.push_back(b);
+    }
+    for (unsigned k = 0; k < n; ++k) {
+      order[ids[k] - first] = k;
+    }
+    preds.resize(n);
+    succs.resize(n);
+    for (unsigned k = 0; k < n; ++k) {
+      for (uint32_t s : ir.successors(ids[k])) {
+        unsigned j = order[s - first];
+        succs[k].push_back(j);
+        preds[j].push_back(k);
+      }
+    }
+  }
+
+  size_t size() const { return preds.size(); }
+};
+
+// Direction policies. The solver meets facts from a block's inputs and
+// transfers them to its other side.
+struct Forward {
+  static constexpr bool forward = true;
+  static const llvm::SmallVector<unsigned, 2> &inputs(const BlockGraph &graph,
+                                                      unsigned b) {
+    return graph.preds[b];
+  }
+  static const llvm::SmallVector<unsigned, 2> &outputs(const BlockGraph &graph,
+                                                       unsigned b) {
+    return graph.succs[b];
+  }
+};
+
+struct Backward {
+  static constexpr bool forward = false;
+  static const llvm::SmallVector<unsigned, 2> &inputs(const BlockGraph &graph,
+                                                      unsigned b) {
+    return graph.succs[b];
+  }
+  static const llvm::SmallVector<unsigned, 2> &outputs(const BlockGraph &graph,
+                                                       unsigned b) {
+    return graph.preds[b];
+  }
+};
+
+// Meet policies: may (union, starting empty) and must (intersection,
+// starting from the full universe).
+struct Union {
+  static constexpr bool top = false;
+  static void meet(Facts &acc, const Facts &facts) { acc |= facts; }
+};
+
+struct Intersect {
+  static constexpr bool top = true;
+  static void meet(Facts &acc, const Facts &facts) { acc &= facts; }
+};
+
+// Base for the common case: out = gen | (in & ~kill) per block, the plain
+// meet on every edge and an empty boundary. Problems override any of the
+// members by redefining them; Solver calls them on the derived type.
+template <typename DirectionT, typename MeetT> struct GenKillProblem {
+  using Direction = DirectionT;
+  using Meet = MeetT;
+
+  BlockGraph graph;
+  arena::Vector<Facts> gen, kill;
+
+  explicit GenKillProblem(llvm::Function &func) : graph(func) {}
+  GenKillProblem(const snapshot::Module &ir, uint32_t func)
+      : graph(ir, func) {}
+
+  // Sizes gen and kill once the universe is known.
+  void allocate(size_t universe) {
+    gen.assign(graph.size(), Facts(universe));
+    kill.assign(graph.size(), Facts(universe));
+  }
+
+  // Facts of a block without inputs: the entry going forward, exits
+  // going backward.
+  void boundary(unsigned, Facts &acc) { acc.reset(); }
+
+  // Starts the meet for a block with inputs.
+  void initMeet(unsigned, Facts &acc) {
+    if (Meet::top)
+      acc.set();
+    else
+      acc.reset();
+  }
+
+  // Meets the facts of one input into the block.
+  void meetEdge(unsigned, unsigned, const Facts &facts, Facts &acc) {
+    Meet::meet(acc, facts);
+  }
+
+  void transfer(unsigned b, const Facts &in, Facts &out) {
+    out = in;
+    out.reset(kill[b]);
+    out |= gen[b];
+  }
+};
+
+// Chaotic iteration with a FIFO worklist, seeded with the reachable blocks
+// in the direction's order. Unreachable blocks are only visited once a
+// neighbour changes, and until then impose no constraint.
+template <typename Problem> class Solver {
+  using Direction = typename Problem::Direction;
+  using Meet = typename Problem::Meet;
+
+public:
+  explicit Solver(Problem &problem)
+      : problem(problem), graph(problem.graph) {}
+
+  void solve(size_t universe) {
+    size_t n = graph.size();
+    in.assign(n, Facts(universe));
+    out.assign(n, Facts(universe, Meet::top));
+    Facts next(universe);
+
+    arena::Vector<unsigned> queue;
+    queue.reserve(n);
+    Facts queued(n);
+    for (unsigned k = 0; k < graph.reachable; ++k) {
+      unsigned b = Direction::forward ? k : graph.reachable - 1 - k;
+      queue.push_back(b);
+      queued.set(b);
+    }
+    // A ring over queue; each block is queued at most once at a time.
+    size_t head = 0, count = queue.size();
+    queue.resize(n);
+    while (count > 0) {
+      unsigned b = queue[head];
+      head = head + 1 == n ? 0 : head + 1;
+      count--;
+      queued.reset(b);
+      instrument::worklistPops();
+
+      auto &inputs = Direction::inputs(graph, b);
+      Facts &acc = in[b];
+      if (inputs.empty()) {
+        problem.boundary(b, acc);
+      } else {
+        problem.initMeet(b, acc);
+        for (unsigned i : inputs) {
+          problem.meetEdge(b, i, out[i], acc);
+        }
+      }
+      problem.transfer(b, acc, next);
+      if (instrument::enabled)
+        instrument::setUnion(next.count());
+      if (next == out[b])
+        continue;
+      std::swap(next, out[b]);
+      for (unsigned o : Direction::outputs(graph, b)) {
+        if (queued.test(o))
+          continue;
+        queued.set(o);
+        queue[(head + count) % n] = o;
+        count++;
+      }
+    }
+  }
+
+  // Facts at the entry and at the exit of block b, in program order.
+  const Facts &entry(unsigned b) const {
+    return Direction::forward ? in[b] : out[b];
+  }
+  const Facts &exit(unsigned b) const {
+    return Direction::forward ? out[b] : in[b];
+  }
+
+private:
+  Problem &problem;
+  const BlockGraph &graph;
+  // in is the meet side of each block, out the transfer side.
+  arena::Vector<Facts> in, out;
+};
+
+// Dense numbering of the values a problem reasons about.
+struct ValueIndex {
+  arena::Vector<llvm::Value *> values;
+  llvm::DenseMap<const llvm::Value *, unsigned> index;
+
+  unsigned add(llvm::Value *val) {
+    auto [it, inserted] = index.try_emplace(val, values.size());
+    if (inserted)
+      values.push_back(val);
+    return it->second;
+  }
+
+  size_t size() const { return values.size(); }
+};
+
+// SSA liveness, the same equations as before the framework:
+//   LiveOut(B) = U_S (LiveIn(S) \ PhiDefs(S)) U PhiUses(B)
+//   LiveIn(B)  = PhiDefs(B) U UpwardExposed(B) U (LiveOut(B) \ Defs(B))
+// over the arguments and non-void instructions.
+struct Liveness : GenKillProblem<Backward, Union> {
+  ValueIndex facts;
+  arena::Vector<Facts> phiDefs, phiUses;
+  Facts scratch;
+
+  explicit Liveness(llvm::Function &func) : GenKillProblem(func) {
+    using namespace llvm;
+    for (auto &arg : func.args()) {
+      facts.add(&arg);
+    }
+    for (BasicBlock *BB : graph.blocks) {
+      for (auto &inst : *BB) {
+        if (!inst.getType()->isVoidTy())
+          facts.add(&inst);
+      }
+    }
+    allocate(facts.size());
+    phiDefs.assign(graph.size(), Facts(facts.size()));
+    phiUses.assign(graph.size(), Facts(facts.size()));
+
+    for (unsigned b = 0; b < graph.size(); ++b) {
+      for (auto &inst : *graph.blocks[b]) {
+        if (auto *phi = dyn_cast<PHINode>(&inst)) {
+          phiDefs[b].set(facts.index[phi]);
+          for (unsigned i = 0; i < phi->getNumIncomingValues(); ++i) {
+            Value *inVal = phi->getIncomingValue(i);
+            if (isa<Instruction>(inVal) || isa<Argument>(inVal))
+              phiUses[graph.index[phi->getIncomingBlock(i)]].set(
+                  facts.index[inVal]);
+          }
+          continue;
+        }
+        for (auto &operand : inst.operands()) {
+          Value *val = operand.get();
+          if (isa<Instruction>(val) || isa<Argument>(val)) {
+            unsigned id = facts.index[val];
+            if (!kill[b].test(id))
+              gen[b].set(id);
+          }
+        }
+        if (!inst.getType()->isVoidTy())
+          kill[b].set(facts.index[&inst]);
+      }
+      gen[b] |= phiDefs[b];
+    }
+  }
+
+  size_t universe() const { return facts.size(); }
+  llvm::Value *fact(unsigned id) const { return facts.values[id]; }
+
+  void boundary(unsigned b, Facts &acc) { acc = phiUses[b]; }
+  void initMeet(unsigned b, Facts &acc) { acc = phiUses[b]; }
+
+  void meetEdge(unsigned, unsigned s, const Facts &liveIn, Facts &acc) {
+    scratch = liveIn;
+    scratch.reset(phiDefs[s]);
+    acc |= scratch;
+  }
+};
+
+// Liveness on a snapshot, with the same equations. Facts are the local
+// indices of the function (arguments, then instructions), so the universe
+// also covers void instructions, which are never set.
+struct SnapshotLiveness : GenKillProblem<Backward, Union> {
+  const snapshot::Module &ir;
+  uint32_t func;
+  arena::Vector<Facts> phiDefs, phiUses;
+  Facts scratch;
+
+  SnapshotLiveness(const snapshot::Module &ir, uint32_t func)
+      : GenKillProblem(ir, func), ir(ir), func(func) {
+    using llvm::Instruction;
+    size_t n = universe();
+    allocate(n);
+    phiDefs.assign(graph.size(), Facts(n));
+    phiUses.assign(graph.size(), Facts(n));
+    uint32_t first = *ir.blocks(func).begin();
+
+    for (unsigned b = 0; b < graph.size(); ++b) {
+      for (uint32_t v : ir.instsOf(graph.ids[b])) {
+        if (ir.opcode[v] == Instruction::PHI) {
+          phiDefs[b].set(ir.localIndex(func, v));
+          for (unsigned i = 0; i < ir.numIncoming(v); ++i) {
+            uint32_t in = ir.incomingValue(v, i);
+            if (ir.isLocal(in))
+              phiUses[graph.order[ir.incomingBlock(v, i) - first]].set(
+                  ir.localIndex(func, in));
+          }
+          continue;
+        }
+        for (uint32_t op : ir.operands(v)) {
+          if (ir.isLocal(op)) {
+            unsigned id = ir.localIndex(func, op);
+            if (!kill[b].test(id))
+              gen[b].set(id);
+          }
+        }
+        if (!ir.is(v, snapshot::Void))
+          kill[b].set(ir.localIndex(func, v));
+      }
+      gen[b] |= phiDefs[b];
+    }
+  }
+
+  size_t universe() const { return ir.numLocals(func); }
+  uint32_t fact(unsigned id) const { return ir.localValue(func, id); }
+
+  void boundary(unsigned b, Facts &acc) { acc = phiUses[b]; }
+  void initMeet(unsigned b, Facts &acc) { acc = phiUses[b]; }
+
+  void meetEdge(unsigned, unsigned s, const Facts &liveIn, Facts &acc) {
+    scratch = liveIn;
+    scratch.reset(phiDefs[s]);
+    acc |= scratch;
+  }
+};
+
+// Stores reaching each point. A store kills the other stores through the
+// same pointer value; without alias analysis, other writes kill nothing.
+struct ReachingDefs : GenKillProblem<Forward, Union> {
+  ValueIndex facts;
+
+  explicit ReachingDefs(llvm::Function &func) : GenKillProblem(func) {
+    using namespace llvm;
+    DenseMap<Value *, SmallVector<unsigned, 4>> storesTo;
+    for (BasicBlock *BB : graph.blocks) {
+      for (auto &inst : *BB) {
+        if (auto *store = dyn_cast<StoreInst>(&inst))
+          storesTo[store->getPointerOperand()].push_back(facts.add(store));
+      }
+    }
+    allocate(facts.size());
+    for (unsigned b = 0; b < graph.size(); ++b) {
+      for (auto &inst : *graph.blocks[b]) {
+        auto *store = dyn_cast<StoreInst>(&inst);
+        if (!store)
+          continue;
+        for (unsigned other : storesTo[store->getPointerOperand()]) {
+          kill[b].set(other);
+          gen[b].reset(other);
+        }
+        gen[b].set(facts.index[store]);
+      }
+    }
+  }
+
+  size_t universe() const { return facts.size(); }
+  llvm::Value *fact(unsigned id) const { return facts.values[id]; }
+};
+
+// Numbers side-effect-free computations by opcode, type and operands, so
+// lexically equal instructions share one expression. Loads are expressions
+// too, and any instruction that may write memory kills all of them.
+struct ExprIndex {
+  arena::Vector<llvm::Value *> exprs; // first instruction of each expression
+  arena::Map<arena::Vector<const void *>, unsigned> ids;
+  llvm::DenseMap<const llvm::Instruction *, unsigned> index;
+  Facts loads;
+
+  static bool isExpr(const llvm::Instruction &inst) {
+    using namespace llvm;
+    return isa<BinaryOperator>(inst) || isa<CmpInst>(inst) ||
+           isa<CastInst>(inst) || isa<GetElementPtrInst>(inst) ||
+           isa<SelectInst>(inst) ||
+           (isa<LoadInst>(inst) && !cast<LoadInst>(inst).isVolatile());
+  }
+
+  explicit ExprIndex(const BlockGraph &graph) {
+    using namespace llvm;
+    arena::Vector<unsigned> loadIds;
+    for (BasicBlock *BB : graph.blocks) {
+      for (auto &inst : *BB) {
+        if (!isExpr(inst))
+          continue;
+        arena::Vector<const void *> key = {
+            (const void *)(uintptr_t)inst.getOpcode(), inst.getType()};
+        if (auto *cmp = dyn_cast<CmpInst>(&inst))
+          key.push_back((const void *)(uintptr_t)cmp->getPredicate());
+        if (auto *gep = dyn_cast<GetElementPtrInst>(&inst))
+          key.push_back(gep->getSourceElementType());
+        for (auto &operand : inst.operands()) {
+          key.push_back(operand.get());
+        }
+        auto [it, inserted] = ids.try_emplace(std::move(key), exprs.size());
+        if (inserted) {
+          exprs.push_back(&inst);
+          if (isa<LoadInst>(inst))
+            loadIds.push_back(it->second);
+        }
+        index[&inst] = it->second;
+      }
+    }
+    loads.resize(exprs.size());
+    for (unsigned id : loadIds) {
+      loads.set(id);
+    }
+  }
+
+  size_t size() const { return exprs.size(); }
+};
+
+// Expressions computed on every path to a point and not killed since.
+struct AvailableExprs : GenKillProblem<Forward, Intersect> {
+  ExprIndex exprs;
+
+  explicit AvailableExprs(llvm::Function &func)
+      : GenKillProblem(func), exprs(graph) {
+    allocate(exprs.size());
+    for (unsigned b = 0; b < graph.size(); ++b) {
+      for (auto &inst : *graph.blocks[b]) {
+        if (inst.mayWriteToMemory()) {
+          gen[b].reset(exprs.loads);
+          kill[b] |= exprs.loads;
+        }
+        auto it = exprs.index.find(&inst);
+        if (it != exprs.index.end())
+          gen[b].set(it->second);
+      }
+    }
+  }
+
+  size_t universe() const { return exprs.size(); }
+  llvm::Value *fact(unsigned id) const { return exprs.exprs[id]; }
+};
+
+// Expressions evaluated on every path from a point before anything kills
+// them.
+struct VeryBusyExprs : GenKillProblem<Backward, Intersect> {
+  ExprIndex exprs;
+
+  explicit VeryBusyExprs(llvm::Function &func)
+      : GenKillProblem(func), exprs(graph) {
+    allocate(exprs.size());
+    for (unsigned b = 0; b < graph.size(); ++b) {
+      bool written = false;
+      for (auto &inst : *graph.blocks[b]) {
+        auto it = exprs.index.find(&inst);
+        if (it != exprs.index.end() &&
+            !(written && exprs.loads.test(it->second)))
+          gen[b].set(it->second);
+        if (inst.mayWriteToMemory()) {
+          written = true;
+          kill[b] |= exprs.loads;
+        }
+      }
+    }
+  }
+
+  size_t universe() const { return exprs.size(); }
+  llvm::Value *fact(unsigned id) const { return exprs.exprs[id]; }
+};
+
+} // namespace dataflow
@@ -0,0 +1,327 @@
+// Result output shared by the tools. `outs() << *val` builds a fresh slot
+// numbering of val's function on every call, which makes printing a result
+// set quadratic in the function size. An emit::Writer numbers the module
+// once through a shared ModuleSlotTracker and writes through one buffered
+// stream, in the format chosen on the command line:
+//
+//   --emit=full     (default) the tools' own layouts, full instruction text
+//   --emit=text     one line per result set, values by operand name
+//   --emit=json     {"tool": ..., "results": [{function, kind, key, values}]}
+//   --emit=binary   varint records over dense value IDs, see below
+//   --emit-file=<file> writes results there instead of to stdout, where
+//                      the tools' status lines would break JSON and binary
+//
+// In text and JSON, values local to another function than the one being
+// written are qualified as @func:%name, and void instructions such as
+// stores are named by block and position, as %block#3.
+//
+// Binary layout: "LRES", version byte, tool string, then tagged records.
+// Integers are unsigned LEB128 and strings are a length and bytes. Value
+// IDs follow module order: globals, functions, aliases, ifuncs, then per
+// function its arguments, blocks and instructions. Any other value gets the
+// next ID at first use, announced by a 'V' record.
+//   'F' id            results of a function follow
+//   'K' kind string   defines the next kind number, from 0
+//   'V' id string     names a value outside the module order
+//   'R' kind key+1 n id...   one result set; key 0 means none
+#pragma once
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSlotTracker.h"
+#include "llvm/IR/Value.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef EMIT_BUFFER
+#define EMIT_BUFFER (1 << 20)
+#endif
+
+namespace emit {
+
+enum Format { Full, Text, JSON, Binary };
+
+inline Format format = Full;
+inline std::string outputPath;
+
+// Strips --emit=<format> and --emit-file=<file> from argv.
+inline void init(int &argc, char **argv) {
+  int kept = 1;
+  for (int i = 1; i < argc; ++i) {
+    llvm::StringRef arg(argv[i]);
+    if (arg.consume_front("--emit=")) {
+      if (arg == "full") {
+        format = Full;
+      } else if (arg == "text") {
+        format = Text;
+      } else if (arg == "json") {
+        format = JSON;
+      } else if (arg == "binary") {
+        format = Binary;
+      } else {
+        llvm::errs() << "Unknown --emit format: " << arg << "\n";
+        exit(1);
+      }
+    } else if (arg.consume_front("--emit-file=")) {
+      outputPath = arg.str();
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  argc = kept;
+  argv[argc] = nullptr;
+}
+
+// Prints like `os << value`, numbered by the writer's slot tracker.
+struct FullText {
+  const llvm::Value &value;
+  llvm::ModuleSlotTracker &slots;
+};
+
+inline llvm::raw_ostream &operator<<(llvm::raw_ostream &os,
+                                     const FullText &text) {
+  text.value.print(os, text.slots);
+  return os;
+}
+
+class Writer {
+public:
+  Writer(const llvm::Module &module, llvm::StringRef tool)
+      : module(module), slots(&module) {
+    if (!outputPath.empty()) {
+      std::error_code ec;
+      file = std::make_unique<llvm::raw_fd_ostream>(outputPath, ec);
+      if (ec) {
+        llvm::errs() << "Cannot write " << outputPath << ": " << ec.message()
+                     << "\n";
+        exit(1);
+      }
+    }
+    os().SetBufferSize(EMIT_BUFFER);
+
+    if (format == JSON) {
+      json = std::make_unique<llvm::json::OStream>(os());
+      json->objectBegin();
+      json->attribute("tool", tool);
+      json->attributeBegin("results");
+      json->arrayBegin();
+    } else if (format == Binary) {
+      os() << "LRES" << (char)1;
+      writeString(tool);
+      numberModule();
+    }
+  }
+
+  ~Writer() { finish(); }
+
+  // Closes the JSON document and flushes; nothing may be written after.
+  void finish() {
+    if (json) {
+      json->arrayEnd();
+      json->attributeEnd();
+      json->objectEnd();
+      json.reset();
+      os() << "\n";
+    }
+    os().flush();
+  }
+
+  llvm::raw_ostream &os() { return file ? *file : llvm::outs(); }
+
+  // For the --emit=full layouts: os() << writer.full(*val).
+  FullText full(const llvm::Value &value) { return {value, slots}; }
+
+  // Starts the results of func; records until the next call belong to it.
+  void beginFunction(const llvm::Function &func) {
+    current = &func;
+    if (format == Text) {
+      os() << "function " << name(&func) << "\n";
+    } else if (format == Binary) {
+      os() << 'F';
+      writeNumber(id(&func));
+    }
+  }
+
+  // One result set: kind names the relation (e.g. "in", "points-to"), key
+  // is the value it belongs to or null.
+  template <typename Range>
+  void record(llvm::StringRef kind, const llvm::Value *key,
+              const Range &values) {
+    if (format == Text) {
+      os() << kind;
+      if (key) {
+        os() << " ";
+        writeName(key);
+      }
+      os() << ":";
+      for (const llvm::Value *val : values) {
+        os() << " ";
+        writeName(val);
+      }
+      os() << "\n";
+
+    } else if (format == JSON) {
+      json->objectBegin();
+      if (current)
+        json->attribute("function", current->getName());
+      json->attribute("kind", kind);
+      if (key)
+        json->attribute("key", label(key));
+      json->attributeBegin("values");
+      json->arrayBegin();
+      for (const llvm::Value *val : values) {
+        json->value(label(val));
+      }
+      json->arrayEnd();
+      json->attributeEnd();
+      json->objectEnd();
+
+    } else if (format == Binary) {
+      unsigned kindId = kindNumber(kind);
+      uint64_t keyId = key ? id(key) + 1 : 0;
+      // IDs first, so that 'V' records come before the set that uses them.
+      scratch.clear();
+      for (const llvm::Value *val : values) {
+        scratch.push_back(id(val));
+      }
+      os() << 'R';
+      writeNumber(kindId);
+      writeNumber(keyId);
+      writeNumber(scratch.size());
+      for (uint64_t valId : scratch) {
+        writeNumber(valId);
+      }
+    }
+  }
+
+private:
+  static const llvm::Function *parentOf(const llvm::Value *val) {
+    if (auto *inst = llvm::dyn_cast<llvm::Instruction>(val))
+      return inst->getFunction();
+    if (auto *arg = llvm::dyn_cast<llvm::Argument>(val))
+      return arg->getParent();
+    if (auto *BB = llvm::dyn_cast<llvm::BasicBlock>(val))
+      return BB->getParent();
+    return nullptr;
+  }
+
+  // Operand name without the function, computed once per value.
+  llvm::StringRef name(const llvm::Value *val) {
+    auto [it, inserted] = names.try_emplace(val);
+    if (inserted) {
+      llvm::raw_string_ostream out(it->second);
+      if (const llvm::Function *parent = parentOf(val))
+        slots.incorporateFunction(*parent);
+      auto *inst = llvm::dyn_cast<llvm::Instruction>(val);
+      if (inst && inst->getType()->isVoidTy()) {
+        inst->getParent()->printAsOperand(out, false, slots);
+        out << "#" << std::distance(inst->getParent()->begin(),
+                                    inst->getIterator());
+      } else {
+        val->printAsOperand(out, false, slots);
+      }
+    }
+    return it->second;
+  }
+
+  // Function the name must be qualified with, if any.
+  const llvm::Function *qualifier(const llvm::Value *val) {
+    const llvm::Function *parent = parentOf(val);
+    return parent != current ? parent : nullptr;
+  }
+
+  void writeName(const llvm::Value *val) {
+    if (auto *parent = qualifier(val))
+      os() << name(parent) << ":";
+    os() << name(val);
+  }
+
+  std::string label(const llvm::Value *val) {
+    std::string text;
+    if (auto *parent = qualifier(val))
+      text = name(parent).str() + ":";
+    return text + name(val).str();
+  }
+
+  void numberModule() {
+    auto add = [&](const llvm::Value &val) {
+      uint64_t next = ids.size();
+      ids[&val] = next;
+    };
+    for (auto &global : module.globals())
+      add(global);
+    for (auto &func : module)
+      add(func);
+    for (auto &alias : module.aliases())
+      add(alias);
+    for (auto &ifunc : module.ifuncs())
+      add(ifunc);
+    for (auto &func : module) {
+      for (auto &arg : func.args())
+        add(arg);
+      for (auto &BB : func)
+        add(BB);
+      for (auto &BB : func) {
+        for (auto &inst : BB)
+          add(inst);
+      }
+    }
+  }
+
+  uint64_t id(const llvm::Value *val) {
+    auto [it, inserted] = ids.try_emplace(val, ids.size());
+    if (inserted) {
+      std::string text;
+      llvm::raw_string_ostream out(text);
+      val->printAsOperand(out, true, slots);
+      os() << 'V';
+      writeNumber(it->second);
+      writeString(out.str());
+    }
+    return it->second;
+  }
+
+  unsigned kindNumber(llvm::StringRef kind) {
+    auto [it, inserted] = kinds.try_emplace(kind, kinds.size());
+    if (inserted) {
+      os() << 'K';
+      writeString(kind);
+    }
+    return it->second;
+  }
+
+  void writeNumber(uint64_t value) {
+    do {
+      uint8_t byte = value & 0x7f;
+      value >>= 7;
+      os() << (char)(byte | (value ? 0x80 : 0));
+    } while (value);
+  }
+
+  void writeString(llvm::StringRef str) {
+    writeNumber(str.size());
+    os() << str;
+  }
+
+  const llvm::Module &module;
+  llvm::ModuleSlotTracker slots;
+  std::unique_ptr<llvm::raw_fd_ostream> file;
+  std::unique_ptr<llvm::json::OStream> json;
+  const llvm::Function *current = nullptr;
+  llvm::DenseMap<const llvm::Value *, std::string> names;
+  llvm::DenseMap<const llvm::Value *, uint64_t> ids;
+  llvm::StringMap<unsigned> kinds;
+  std::vector<uint64_t> scratch;
+};
+
+} // namespace emit
@@ -0,0 +1,224 @@
+// Fits a CostModel (cost.h) to the CSVs written by the tools' CSV modes,
+// e.g.
+//   fitcost p2 big.ll.csv sqlite3.ll.csv
+// prints the model as a C++ initializer, followed by how well it ranks the
+// functions and the simulated LPT makespan it gives against block count.
+#include "cost.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+#ifndef RIDGE
+#define RIDGE 1e-3
+#endif
+
+struct Sample {
+  FuncFeatures features;
+  double time;
+};
+
+bool readCSV(const char *filename, std::vector<Sample> &samples) {
+  std::ifstream in(filename);
+  std::string line;
+  // Lines starting with # say how the times were taken.
+  do {
+    if (!std::getline(in, line))
+      return false;
+  } while (StringRef(line).startswith("#"));
+  SmallVector<StringRef, 16> header;
+  StringRef(line).split(header, ',');
+  int column[NumCostFeatures];
+  int timeColumn = -1;
+  for (int i = 0; i < NumCostFeatures; ++i) {
+    column[i] = -1;
+    for (size_t c = 0; c < header.size(); ++c) {
+      if (header[c] == costFeatureNames[i])
+        column[i] = c;
+    }
+    if (column[i] < 0) {
+      errs() << filename << ": no " << costFeatureNames[i] << " column\n";
+      return false;
+    }
+  }
+  for (size_t c = 0; c < header.size(); ++c) {
+    if (header[c] == "time(us)")
+      timeColumn = c;
+  }
+  if (timeColumn < 0) {
+    errs() << filename << ": no time(us) column\n";
+    return false;
+  }
+
+  while (std::getline(in, line)) {
+    SmallVector<StringRef, 16> fields;
+    StringRef(line).split(fields, ',');
+    if (fields.size() != header.size())
+      continue;
+    Sample sample;
+    bool ok = !fields[timeColumn].getAsDouble(sample.time);
+    for (int i = 0; i < NumCostFeatures; ++i) {
+      ok &= !fields[column[i]].getAsDouble(sample.features.values[i]);
+    }
+    if (ok)
+      samples.push_back(sample);
+  }
+  return true;
+}
+
+// Least squares of log(1 + time) on log(1 + features) with a small ridge
+// term. The weights are kept non-negative (cost.h requires a monotone
+// model), so the normal equations are solved by projected coordinate
+// descent, with the intercept left free.
+CostModel fit(const std::vector<Sample> &samples) {
+  const int n = NumCostFeatures + 1;
+  std::vector<std::vector<double>> A(n, std::vector<double>(n, 0));
+  std::vector<double> b(n, 0);
+  for (auto &sample : samples) {
+    double x[n];
+    x[0] = 1;
+    for (int i = 0; i < NumCostFeatures; ++i) {
+      x[i + 1] = std::log1p(sample.features.values[i]);
+    }
+    double y = std::log1p(sample.time);
+    for (int r = 0; r < n; ++r) {
+      for (int c = 0; c < n; ++c) {
+        A[r][c] += x[r] * x[c];
+      }
+      b[r] += x[r] * y;
+    }
+  }
+  for (int r = 1; r < n; ++r) {
+    A[r][r] += RIDGE * samples.size();
+  }
+  std::vector<double> w(n, 0);
+  for (int sweep = 0; sweep < 100000; ++sweep) {
+    double change = 0;
+    for (int r = 0; r < n; ++r) {
+      double rest = b[r];
+      for (int c = 0; c < n; ++c) {
+        if (c != r)
+          rest -= A[r][c] * w[c];
+      }
+      double next = rest / A[r][r];
+      if (r > 0)
+        next = std::max(next, 0.0);
+      change = std::max(change, std::fabs(next - w[r]));
+      w[r] = next;
+    }
+    if (change < 1e-12)
+      break;
+  }
+  CostModel model;
+  model.intercept = w[0];
+  for (int i = 0; i < NumCostFeatures; ++i) {
+    model.weights[i] = w[i + 1];
+  }
+  return model;
+}
+
+std::vector<double> ranks(const std::vector<double> &values) {
+  std::vector<size_t> order(values.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return values[a] < values[b]; });
+  std::vector<double> rank(values.size());
+  for (size_t i = 0; i < order.size();) {
+    size_t j = i;
+    while (j < order.size() && values[order[j]] == values[order[i]])
+      ++j;
+    for (size_t k = i; k < j; ++k) {
+      rank[order[k]] = (i + j - 1) / 2.0;
+    }
+    i = j;
+  }
+  return rank;
+}
+
+double spearman(const std::vector<double> &a, const std::vector<double> &b) {
+  auto ra = ranks(a), rb = ranks(b);
+  double n = a.size(), mean = (n - 1) / 2;
+  double cov = 0, va = 0, vb = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    cov += (ra[i] - mean) * (rb[i] - mean);
+    va += (ra[i] - mean) * (ra[i] - mean);
+    vb += (rb[i] - mean) * (rb[i] - mean);
+  }
+  return va && vb ? cov / std::sqrt(va * vb) : 0;
+}
+
+// Greedy list scheduling of the measured times onto nthreads workers, in
+// descending order of key.
+double makespan(const std::vector<Sample> &samples,
+                const std::vector<double> &key, int nthreads) {
+  std::vector<size_t> order(samples.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t a, size_t b) { return key[a] > key[b]; });
+  std::priority_queue<double, std::vector<double>, std::greater<double>> load;
+  for (int t = 0; t < nthreads; ++t) {
+    load.push(0);
+  }
+  double end = 0;
+  for (size_t i : order) {
+    double t = load.top() + samples[i].time;
+    load.pop();
+    load.push(t);
+    end = std::max(end, t);
+  }
+  return end;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    errs() << "Usage: fitcost <model name> <csv>...\n";
+    return 1;
+  }
+  std::vector<Sample> samples;
+  for (int i = 2; i < argc; ++i) {
+    if (!readCSV(argv[i], samples))
+      return 1;
+  }
+  if (samples.size() < NumCostFeatures + 1) {
+    errs() << "Too few samples: " << samples.size() << "\n";
+    return 1;
+  }
+  CostModel model = fit(samples);
+
+  outs() << "constexpr CostModel " << argv[1] << "Cost = {"
+         << format("%.4f", model.intercept) << ", {";
+  for (int i = 0; i < NumCostFeatures; ++i) {
+    outs() << (i ? ", " : "") << format("%.4f", model.weights[i]);
+  }
+  outs() << "}};\n";
+
+  std::vector<double> times, blocks, predicted;
+  for (auto &sample : samples) {
+    times.push_back(sample.time);
+    blocks.push_back(sample.features.values[Blocks]);
+    predicted.push_back(model.predict(sample.features));
+  }
+  outs() << samples.size() << " function(s)\n";
+  outs() << "Spearman rank correlation with time: blocks "
+         << format("%.3f", spearman(blocks, times)) << ", model "
+         << format("%.3f", spearman(predicted, times)) << "\n";
+  for (int nthreads : {4, 16}) {
+    double byTime = makespan(samples, times, nthreads);
+    outs() << "LPT makespan on " << nthreads << " threads (us): by blocks "
+           << format("%.0f", makespan(samples, blocks, nthreads))
+           << ", by model "
+           << format("%.0f", makespan(samples, predicted, nthreads))
+           << ", by measured time " << format("%.0f", byTime) << "\n";
+  }
+}
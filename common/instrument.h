@@ -0,0 +1,535 @@
+// Runtime instrumentation shared by the tools. It is off unless the tool is
+// run with --stats[=<file>]; then every thread records per-phase times
+// (parse, init, solve, output), task times and sizes, worklist pops, set
+// unions and the largest set built, plus cycles, instructions, LLC misses
+// and branch misses where perf_event_open is permitted. report() writes
+// everything as JSON to <file>, or to stderr without one.
+//
+// --trace[=<file>] independently logs every task into a per-thread ring
+// buffer of TRACE_BUFFER events, and report() dumps them as a Chrome trace
+// (trace.json by default) for chrome://tracing or ui.perfetto.dev, one
+// slice per task on the row of the thread that ran it.
+//
+// When disabled, each hook is a single predictable branch.
+#pragma once
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/IR/Function.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef TRACE_BUFFER
+#define TRACE_BUFFER 65536
+#endif
+
+namespace instrument {
+
+enum Phase { Parse, Init, Solve, Output, NumPhases };
+constexpr const char *phaseNames[NumPhases] = {"parse", "init", "solve",
+                                               "output"};
+
+enum HWCounter { Cycles, Instructions, LLCMisses, BranchMisses, NumHWCounters };
+constexpr const char *hwNames[NumHWCounters] = {"cycles", "instructions",
+                                                "llc_misses", "branch_misses"};
+
+struct ThreadStats {
+  std::string name;
+  uint64_t wallNs = 0;
+  uint64_t phaseNs[NumPhases] = {};
+  uint64_t worklistPops = 0;
+  uint64_t setUnions = 0;
+  uint64_t peakSetSize = 0;
+  // Task statistics are kept in doubles; squared sums overflow integers.
+  uint64_t tasks = 0;
+  double sizeSum = 0, sizeSumSq = 0;
+  double timeSum = 0, timeSumSq = 0; // us
+  double maxTaskTime = 0;
+  uint64_t maxTaskSize = 0;
+  // Negative while a counter could not be opened.
+  int64_t hw[NumHWCounters] = {-1, -1, -1, -1};
+};
+
+// One task in the trace, named after func or, for a snapshot function,
+// name (both outlive the report) when it has one. Trivial, so a fresh
+// buffer is neither zeroed nor touched before it is written.
+struct TraceEvent {
+  const llvm::Function *func;
+  const char *name;
+  uint64_t start, duration; // ns
+  uint64_t size;
+  uint32_t blocks, insts;
+};
+
+// Keeps the newest TRACE_BUFFER events of one thread. Only that thread
+// writes, so recording takes no lock.
+struct TraceBuffer {
+  std::unique_ptr<TraceEvent[]> events;
+  uint64_t written = 0;
+
+  void push(const TraceEvent &event) {
+    if (!events)
+      events.reset(new TraceEvent[TRACE_BUFFER]);
+    events[written++ % TRACE_BUFFER] = event;
+  }
+
+  uint64_t dropped() const {
+    return written > TRACE_BUFFER ? written - TRACE_BUFFER : 0;
+  }
+
+  // Calls visit() on the kept events, oldest first.
+  template <typename Visit> void forEach(Visit &&visit) const {
+    for (uint64_t i = dropped(); i < written; ++i) {
+      visit(events[i % TRACE_BUFFER]);
+    }
+  }
+};
+
+struct ThreadState {
+  ThreadStats stats;
+  TraceBuffer trace;
+};
+
+inline bool enabled = false;
+inline bool tracing = false;
+inline std::string outputPath;
+inline std::string tracePath = "trace.json";
+inline std::chrono::steady_clock::time_point startTime;
+inline std::mutex registryMutex;
+inline std::vector<std::unique_ptr<ThreadState>> registry;
+inline thread_local ThreadState *current = nullptr;
+
+inline uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Returns the state named name, creating it on first use, so a thread that
+// is started once per round keeps accumulating into the same entry.
+inline ThreadState *registerThread(llvm::StringRef name) {
+  std::lock_guard<std::mutex> lock(registryMutex);
+  for (auto &state : registry) {
+    if (state->stats.name == name)
+      return state.get();
+  }
+  registry.push_back(std::make_unique<ThreadState>());
+  registry.back()->stats.name = name.str();
+  return registry.back().get();
+}
+
+inline ThreadState &localState() {
+  if (!current)
+    current = registerThread("thread");
+  return *current;
+}
+
+inline ThreadStats &local() { return localState().stats; }
+
+// Hardware counters of the calling thread, user space only.
+class PerfCounters {
+public:
+  void open() {
+    static const std::pair<uint32_t, uint64_t> events[NumHWCounters] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                                 (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                 (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+    for (int i = 0; i < NumHWCounters; ++i) {
+      fds[i] = openEvent(events[i].first, events[i].second);
+      // Not every PMU exposes the LL cache event; the generic cache-miss
+      // event counts last-level misses on most of those that do not.
+      if (fds[i] < 0 && i == LLCMisses)
+        fds[i] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    }
+  }
+
+  // Adds the counts, scaled up if the kernel multiplexed the counter, to
+  // hw and closes the counters.
+  void close(int64_t *hw) {
+    for (int i = 0; i < NumHWCounters; ++i) {
+      if (fds[i] < 0)
+        continue;
+      ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+      uint64_t value[3];
+      if (::read(fds[i], value, sizeof(value)) == sizeof(value) && value[2]) {
+        int64_t count = value[0] * ((double)value[1] / value[2]);
+        hw[i] = std::max<int64_t>(hw[i], 0) + count;
+      }
+      ::close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+
+private:
+  int fds[NumHWCounters] = {-1, -1, -1, -1};
+
+  static int openEvent(uint32_t type, uint64_t config) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+};
+
+// Records the wall time and hardware counters of the calling thread under
+// name for its lifetime.
+class ThreadScope {
+public:
+  explicit ThreadScope(const std::string &name) {
+    if (!enabled && !tracing)
+      return;
+    state = current = registerThread(name);
+    if (enabled)
+      perf.open();
+    start = nowNs();
+  }
+
+  ~ThreadScope() {
+    if (!state)
+      return;
+    state->stats.wallNs += nowNs() - start;
+    perf.close(state->stats.hw);
+    current = nullptr;
+  }
+
+private:
+  ThreadState *state = nullptr;
+  PerfCounters perf;
+  uint64_t start = 0;
+};
+
+// Adds the lifetime of the scope to a phase of the calling thread.
+class PhaseTimer {
+public:
+  explicit PhaseTimer(Phase phase) : phase(phase) {
+    if (enabled)
+      start = nowNs();
+  }
+
+  ~PhaseTimer() { stop(); }
+
+  // Ends the phase early; later calls do nothing.
+  void stop() {
+    if (enabled && !stopped)
+      local().phaseNs[phase] += nowNs() - start;
+    stopped = true;
+  }
+
+private:
+  Phase phase;
+  uint64_t start = 0;
+  bool stopped = false;
+};
+
+// Records one task of the given size, timed over the lifetime of the scope.
+// The trace names the task after func and tags it with its block and
+// instruction counts; callers that already know them pass them in, anything
+// left zero is counted from func only while tracing.
+class TaskTimer {
+public:
+  explicit TaskTimer(size_t size, const llvm::Function *func = nullptr,
+                     size_t blocks = 0, size_t insts = 0)
+      : size(size), func(func), blocks(blocks), insts(insts) {
+    if (enabled || tracing)
+      start = nowNs();
+  }
+
+  // A function of a snapshot.h module, which has a name but no Function.
+  TaskTimer(size_t size, const std::string &name, size_t blocks, size_t insts)
+      : TaskTimer(size, nullptr, blocks, insts) {
+    this->name = name.c_str();
+  }
+
+  // For tasks whose size is only known once they are done.
+  void setSize(size_t newSize) { size = newSize; }
+
+  ~TaskTimer() {
+    if (!enabled && !tracing)
+      return;
+    uint64_t end = nowNs();
+    auto &state = localState();
+    if (tracing) {
+      TraceEvent event{func, name, start, end - start, size, 0, 0};
+      if (func) {
+        event.blocks = blocks ? blocks : func->size();
+        event.insts = insts ? insts : func->getInstructionCount();
+      } else {
+        event.blocks = blocks;
+        event.insts = insts;
+      }
+      state.trace.push(event);
+    }
+    if (!enabled)
+      return;
+    auto &stats = state.stats;
+    double time = (end - start) / 1000.0;
+    stats.tasks++;
+    stats.sizeSum += size;
+    stats.sizeSumSq += (double)size * size;
+    stats.timeSum += time;
+    stats.timeSumSq += time * time;
+    if (time > stats.maxTaskTime) {
+      stats.maxTaskTime = time;
+      stats.maxTaskSize = size;
+    }
+  }
+
+private:
+  size_t size;
+  const llvm::Function *func;
+  const char *name = nullptr;
+  size_t blocks, insts;
+  uint64_t start = 0;
+};
+
+inline void worklistPops(uint64_t count = 1) {
+  if (enabled)
+    local().worklistPops += count;
+}
+
+// Counts one set union whose result has size elements.
+inline void setUnion(size_t size) {
+  if (!enabled)
+    return;
+  auto &stats = local();
+  stats.setUnions++;
+  stats.peakSetSize = std::max<uint64_t>(stats.peakSetSize, size);
+}
+
+inline ThreadScope *mainScope = nullptr;
+
+// Removes --stats[=<file>] and --trace[=<file>] from argv and, if either is
+// present, starts the "main" thread scope.
+inline void init(int &argc, char **argv) {
+  int kept = 1;
+  for (int i = 1; i < argc; ++i) {
+    llvm::StringRef arg(argv[i]);
+    if (arg == "--stats") {
+      enabled = true;
+    } else if (arg.consume_front("--stats=")) {
+      enabled = true;
+      outputPath = arg.str();
+    } else if (arg == "--trace") {
+      tracing = true;
+    } else if (arg.consume_front("--trace=")) {
+      tracing = true;
+      tracePath = arg.str();
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  argc = kept;
+  argv[argc] = nullptr;
+  if (!enabled && !tracing)
+    return;
+  startTime = std::chrono::steady_clock::now();
+  mainScope = new ThreadScope("main");
+}
+
+inline double ms(uint64_t ns) { return ns / 1e6; }
+
+inline void writeHW(llvm::json::OStream &json, const int64_t *hw) {
+  json.attributeObject("hw", [&] {
+    for (int i = 0; i < NumHWCounters; ++i) {
+      if (hw[i] < 0)
+        json.attribute(hwNames[i], nullptr);
+      else
+        json.attribute(hwNames[i], hw[i]);
+    }
+    // Instructions per cycle and LLC misses per thousand instructions tell
+    // compute-bound (high IPC, low MPKI) from memory-bound runs.
+    if (hw[Cycles] > 0 && hw[Instructions] >= 0)
+      json.attribute("ipc", (double)hw[Instructions] / hw[Cycles]);
+    if (hw[Instructions] > 0 && hw[LLCMisses] >= 0)
+      json.attribute("llc_mpki", 1000.0 * hw[LLCMisses] / hw[Instructions]);
+  });
+}
+
+inline void writeThread(llvm::json::OStream &json, const ThreadStats &stats) {
+  json.object([&] {
+    json.attribute("name", stats.name);
+    json.attribute("wall_ms", ms(stats.wallNs));
+    json.attributeObject("phases_ms", [&] {
+      for (int p = 0; p < NumPhases; ++p) {
+        json.attribute(phaseNames[p], ms(stats.phaseNs[p]));
+      }
+    });
+    json.attribute("worklist_pops", (int64_t)stats.worklistPops);
+    json.attribute("set_unions", (int64_t)stats.setUnions);
+    json.attribute("peak_set_size", (int64_t)stats.peakSetSize);
+    json.attributeObject("tasks", [&] {
+      double n = std::max<double>(stats.tasks, 1);
+      double sizeMean = stats.sizeSum / n, timeMean = stats.timeSum / n;
+      json.attribute("count", (int64_t)stats.tasks);
+      json.attribute("size_mean", sizeMean);
+      json.attribute("size_stddev", std::sqrt(std::max(
+                                        0.0, stats.sizeSumSq / n -
+                                                 sizeMean * sizeMean)));
+      json.attribute("time_mean_us", timeMean);
+      json.attribute("time_stddev_us", std::sqrt(std::max(
+                                           0.0, stats.timeSumSq / n -
+                                                    timeMean * timeMean)));
+      json.attribute("max_time_us", stats.maxTaskTime);
+      json.attribute("max_time_size", (int64_t)stats.maxTaskSize);
+    });
+    writeHW(json, stats.hw);
+  });
+}
+
+inline void writeStats(llvm::StringRef tool, llvm::StringRef input,
+                       uint64_t wallNs) {
+  std::error_code ec;
+  std::unique_ptr<llvm::raw_fd_ostream> file;
+  if (!outputPath.empty()) {
+    file = std::make_unique<llvm::raw_fd_ostream>(outputPath, ec,
+                                                  llvm::sys::fs::OF_Text);
+    if (ec) {
+      llvm::errs() << "Cannot write " << outputPath << ": " << ec.message()
+                   << "\n";
+      return;
+    }
+  }
+  llvm::raw_ostream &os = file ? *file : llvm::errs();
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  ThreadStats total;
+  total.name = "total";
+  for (auto &state : registry) {
+    auto *stats = &state->stats;
+    total.wallNs = std::max(total.wallNs, stats->wallNs);
+    for (int p = 0; p < NumPhases; ++p) {
+      total.phaseNs[p] += stats->phaseNs[p];
+    }
+    total.worklistPops += stats->worklistPops;
+    total.setUnions += stats->setUnions;
+    total.peakSetSize = std::max(total.peakSetSize, stats->peakSetSize);
+    total.tasks += stats->tasks;
+    total.sizeSum += stats->sizeSum;
+    total.sizeSumSq += stats->sizeSumSq;
+    total.timeSum += stats->timeSum;
+    total.timeSumSq += stats->timeSumSq;
+    if (stats->maxTaskTime > total.maxTaskTime) {
+      total.maxTaskTime = stats->maxTaskTime;
+      total.maxTaskSize = stats->maxTaskSize;
+    }
+    for (int i = 0; i < NumHWCounters; ++i) {
+      if (stats->hw[i] >= 0)
+        total.hw[i] = std::max<int64_t>(total.hw[i], 0) + stats->hw[i];
+    }
+  }
+  total.wallNs = wallNs;
+
+  llvm::json::OStream json(os, 2);
+  json.object([&] {
+    json.attribute("tool", tool);
+    json.attribute("input", input);
+    json.attributeArray("threads", [&] {
+      for (auto &state : registry) {
+        writeThread(json, state->stats);
+      }
+    });
+    json.attributeBegin("total");
+    writeThread(json, total);
+    json.attributeEnd();
+  });
+  os << "\n";
+}
+
+// Chrome trace format: one complete ("X") event per task, timestamps in us
+// since init(), and a thread_name metadata event per thread.
+inline void writeTrace(llvm::StringRef tool) {
+  std::error_code ec;
+  llvm::raw_fd_ostream os(tracePath, ec, llvm::sys::fs::OF_Text);
+  if (ec) {
+    llvm::errs() << "Cannot write " << tracePath << ": " << ec.message()
+                 << "\n";
+    return;
+  }
+  uint64_t origin = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        startTime.time_since_epoch())
+                        .count();
+  uint64_t dropped = 0;
+  std::lock_guard<std::mutex> lock(registryMutex);
+  llvm::json::OStream json(os);
+  json.object([&] {
+    json.attributeArray("traceEvents", [&] {
+      for (size_t tid = 0; tid < registry.size(); ++tid) {
+        auto &state = registry[tid];
+        json.object([&] {
+          json.attribute("name", "thread_name");
+          json.attribute("ph", "M");
+          json.attribute("pid", 0);
+          json.attribute("tid", (int64_t)tid);
+          json.attributeObject(
+              "args", [&] { json.attribute("name", state->stats.name); });
+        });
+        state->trace.forEach([&](const TraceEvent &event) {
+          json.object([&] {
+            llvm::StringRef name = event.func   ? event.func->getName()
+                                   : event.name ? event.name
+                                                : "task";
+            json.attribute("name", name);
+            json.attribute("ph", "X");
+            json.attribute("pid", 0);
+            json.attribute("tid", (int64_t)tid);
+            json.attribute("ts", (event.start - origin) / 1000.0);
+            json.attribute("dur", event.duration / 1000.0);
+            json.attributeObject("args", [&] {
+              json.attribute("size", (int64_t)event.size);
+              if (event.blocks || event.insts) {
+                json.attribute("blocks", (int64_t)event.blocks);
+                json.attribute("insts", (int64_t)event.insts);
+              }
+            });
+          });
+        });
+        dropped += state->trace.dropped();
+      }
+    });
+    json.attributeObject("otherData", [&] {
+      json.attribute("tool", tool);
+      json.attribute("dropped_events", (int64_t)dropped);
+    });
+  });
+  os << "\n";
+}
+
+// Ends the main scope and writes the stats and the trace, whichever were
+// requested.
+inline void report(llvm::StringRef tool, llvm::StringRef input) {
+  if (!enabled && !tracing)
+    return;
+  auto wall = std::chrono::steady_clock::now() - startTime;
+  delete mainScope;
+  mainScope = nullptr;
+  if (enabled)
+    writeStats(tool, input,
+               std::chrono::duration_cast<std::chrono::nanoseconds>(wall)
+                   .count());
+  if (tracing)
+    writeTrace(tool);
+}
+
+} // namespace instrument
@@ -0,0 +1,243 @@
+// Pointer-relevance prefilter for the points-to tools. Only a value that can
+// hold an address ever needs a points-to set: a pointer (or a vector or
+// aggregate of pointers), or an integer that carries an address from a
+// ptrtoint to an inttoptr. Everything else (integer counters, floats, the
+// results of zext/sitofp/fptrunc...) is dropped from the constraint graph.
+//
+// An integer is relevant when it flows from a ptrtoint, or into an
+// inttoptr, through phis, selects and casts. A Filter built for a module
+// also follows direct calls to defined functions, from actual to formal
+// arguments and from returned values to the call. Without any ptrtoint or
+// inttoptr the classification is by type alone and costs one scan.
+//
+// The tools ask keep(src, dst) before adding a copy edge or a union and
+// count the answer in a Tally; report() prints how much was removed.
+#pragma once
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/IR/Argument.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ptrfilter {
+
+struct Totals {
+  std::atomic<size_t> values{0};
+  std::atomic<size_t> removedValues{0};
+  std::atomic<size_t> edges{0};
+  std::atomic<size_t> removedEdges{0};
+};
+
+inline Totals totals;
+
+inline bool mayHoldPointer(llvm::Type *type) {
+  if (type->isPtrOrPtrVectorTy())
+    return true;
+  if (auto *st = llvm::dyn_cast<llvm::StructType>(type)) {
+    for (llvm::Type *elem : st->elements()) {
+      if (mayHoldPointer(elem))
+        return true;
+    }
+    return false;
+  }
+  if (auto *at = llvm::dyn_cast<llvm::ArrayType>(type))
+    return mayHoldPointer(at->getElementType());
+  return false;
+}
+
+class Filter {
+public:
+  Filter() = default;
+
+  explicit Filter(const llvm::Function &func) {
+    const llvm::Function *funcs[] = {&func};
+    build(funcs, false);
+  }
+
+  explicit Filter(const llvm::Module &module) {
+    std::vector<const llvm::Function *> funcs;
+    for (auto &func : module) {
+      funcs.push_back(&func);
+    }
+    build(funcs, true);
+  }
+
+  bool relevant(const llvm::Value *val) const {
+    return mayHoldPointer(val->getType()) || ints.count(val);
+  }
+
+  bool keep(const llvm::Value *src, const llvm::Value *dst) const {
+    return relevant(src) && relevant(dst);
+  }
+
+private:
+  // Integer arguments and instructions that may carry an address.
+  llvm::DenseSet<const llvm::Value *> ints;
+  bool calls = false;
+
+  void build(llvm::ArrayRef<const llvm::Function *> funcs,
+             bool interprocedural) {
+    calls = interprocedural;
+    std::vector<const llvm::Value *> forward, backward;
+    size_t values = 0, pointers = 0;
+    auto countValue = [&](const llvm::Value &val) {
+      if (val.getType()->isVoidTy())
+        return;
+      values++;
+      pointers += mayHoldPointer(val.getType());
+    };
+    for (auto *func : funcs) {
+      for (auto &arg : func->args()) {
+        countValue(arg);
+      }
+      for (auto &BB : *func) {
+        for (auto &inst : BB) {
+          countValue(inst);
+          if (llvm::isa<llvm::PtrToIntInst>(inst))
+            forward.push_back(&inst);
+          else if (llvm::isa<llvm::IntToPtrInst>(inst))
+            backward.push_back(inst.getOperand(0));
+        }
+      }
+    }
+
+    llvm::DenseSet<const llvm::Value *> from, to;
+    propagate(forward, from, &Filter::successors);
+    propagate(backward, to, &Filter::predecessors);
+    ints = std::move(from);
+    ints.insert(to.begin(), to.end());
+    totals.values += values;
+    totals.removedValues += values - pointers - ints.size();
+  }
+
+  template <typename Next>
+  void propagate(std::vector<const llvm::Value *> &worklist,
+                 llvm::DenseSet<const llvm::Value *> &seen, Next next) {
+    std::vector<const llvm::Value *> found;
+    while (!worklist.empty()) {
+      const llvm::Value *val = worklist.back();
+      worklist.pop_back();
+      if (mayHoldPointer(val->getType()) ||
+          (!llvm::isa<llvm::Instruction>(val) &&
+           !llvm::isa<llvm::Argument>(val)) ||
+          !seen.insert(val).second)
+        continue;
+      found.clear();
+      (this->*next)(val, found);
+      worklist.insert(worklist.end(), found.begin(), found.end());
+    }
+  }
+
+  static const llvm::Function *directCallee(const llvm::Value *val) {
+    auto *call = llvm::dyn_cast<llvm::CallInst>(val);
+    if (!call)
+      return nullptr;
+    auto *callee = call->getCalledFunction();
+    return callee && !callee->isDeclaration() ? callee : nullptr;
+  }
+
+  template <typename Visit>
+  static void forEachCallSite(const llvm::Function *func, Visit visit) {
+    for (auto *user : func->users()) {
+      if (directCallee(user) == func)
+        visit(llvm::cast<llvm::CallInst>(user));
+    }
+  }
+
+  // Values an address in val is copied to.
+  void successors(const llvm::Value *val,
+                  std::vector<const llvm::Value *> &found) {
+    for (auto *user : val->users()) {
+      if (llvm::isa<llvm::PHINode>(user) || llvm::isa<llvm::CastInst>(user)) {
+        found.push_back(user);
+      } else if (auto *select = llvm::dyn_cast<llvm::SelectInst>(user)) {
+        if (select->getCondition() != val)
+          found.push_back(select);
+      } else if (!calls) {
+        continue;
+      } else if (auto *callee = directCallee(user)) {
+        auto *call = llvm::cast<llvm::CallInst>(user);
+        for (unsigned i = 0; i < call->arg_size() && i < callee->arg_size();
+             ++i) {
+          if (call->getArgOperand(i) == val)
+            found.push_back(callee->getArg(i));
+        }
+      } else if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(user)) {
+        forEachCallSite(ret->getFunction(),
+                        [&](const llvm::CallInst *call) {
+                          found.push_back(call);
+                        });
+      }
+    }
+  }
+
+  // Values that may copy an address into val.
+  void predecessors(const llvm::Value *val,
+                    std::vector<const llvm::Value *> &found) {
+    if (auto *phi = llvm::dyn_cast<llvm::PHINode>(val)) {
+      for (auto &in : phi->incoming_values()) {
+        found.push_back(in);
+      }
+    } else if (auto *select = llvm::dyn_cast<llvm::SelectInst>(val)) {
+      found.push_back(select->getTrueValue());
+      found.push_back(select->getFalseValue());
+    } else if (auto *cast = llvm::dyn_cast<llvm::CastInst>(val)) {
+      found.push_back(cast->getOperand(0));
+    } else if (!calls) {
+      return;
+    } else if (auto *arg = llvm::dyn_cast<llvm::Argument>(val)) {
+      forEachCallSite(arg->getParent(), [&](const llvm::CallInst *call) {
+        if (arg->getArgNo() < call->arg_size())
+          found.push_back(call->getArgOperand(arg->getArgNo()));
+      });
+    } else if (auto *callee = directCallee(val)) {
+      for (auto &BB : *callee) {
+        if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(BB.getTerminator())) {
+          if (ret->getReturnValue())
+            found.push_back(ret->getReturnValue());
+        }
+      }
+    }
+  }
+};
+
+// Edges kept and removed by one thread, added to the totals by flush() and
+// when destroyed.
+class Tally {
+public:
+  Tally() = default;
+  Tally(const Tally &) = delete;
+  Tally &operator=(const Tally &) = delete;
+  ~Tally() { flush(); }
+
+  bool operator()(bool keep) {
+    keep ? ++kept : ++removed;
+    return keep;
+  }
+
+  void flush() {
+    totals.edges += kept + removed;
+    totals.removedEdges += removed;
+    kept = removed = 0;
+  }
+
+private:
+  size_t kept = 0;
+  size_t removed = 0;
+};
+
+inline void report(llvm::raw_ostream &os) {
+  os << "Pointer filter: removed " << totals.removedValues << " of "
+     << totals.values << " values, " << totals.removedEdges << " of "
+     << totals.edges << " edges\n";
+}
+
+} // namespace ptrfilter
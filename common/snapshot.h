@@ -0,0 +1,374 @@
+// Flattened structure-of-arrays copy of a module for the analyses' hot
+// loops. Walking llvm::Value use lists, operand lists and block
+// predecessors chases a pointer per step; a snapshot lowers the module once
+// into dense uint32_t value IDs, per-value opcode and flag arrays, and CSR
+// (offset + target) arrays for operands, users, block instructions and
+// block successors and predecessors.
+//
+// Value IDs, in this order:
+//   globals, functions        module-level, so that they are stable
+//   arguments of all functions
+//   instructions of all functions, in layout order
+//   everything else an operand reaches: blocks, constant expressions and
+//   other constants, numbered at first use
+// The instructions of block b are [blockInsts[b], blockInsts[b + 1]), and
+// the blocks of function f are [funcBlocks[f], funcBlocks[f + 1]).
+//
+// Operands keep LLVM's order (a store is value then pointer, a call's
+// callee is last), except that a phi's incoming values are followed by its
+// incoming blocks. Only constant expressions and global initializers
+// contribute operands among the module-level values; aggregates are
+// leaves.
+//
+// Nothing in a snapshot refers to the module except source(), which maps
+// IDs back for output and is only valid while the module is alive. Tools
+// that do not print can drop the module right after lowering.
+#pragma once
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Sequence.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Value.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace snapshot {
+
+constexpr uint32_t None = ~0u;
+
+enum Kind : uint8_t {
+  Global,
+  Function,
+  Argument,
+  Instruction,
+  Block,
+  ConstantExpr,
+  // Any other value: constants, aliases, inline asm, metadata.
+  Other
+};
+
+enum Flag : uint8_t {
+  // Void type; for a function, a void return type.
+  Void = 1,
+  Pointer = 2,
+  Declaration = 4,
+  Initializer = 8,
+};
+
+class Module {
+public:
+  explicit Module(const llvm::Module &module) {
+    using namespace llvm;
+    size_t numInsts = 0, numBlocks = 0;
+    for (auto &func : module) {
+      numInsts += func.getInstructionCount();
+      numBlocks += func.size();
+    }
+    // Constants and blocks reached through operands come on top; this only
+    // avoids regrowing for the bulk of the values.
+    size_t numValues = module.global_size() + module.size() + numInsts;
+    ids.reserve(numValues);
+    blockIds.reserve(numBlocks);
+    kind.reserve(numValues);
+    opcode.reserve(numValues);
+    flags.reserve(numValues);
+    block.reserve(numValues);
+    sources.reserve(numValues);
+    operandList.reserve(2 * numInsts);
+
+    for (auto &global : module.globals()) {
+      add(&global, Global, 0,
+          Pointer | (global.hasInitializer() ? Initializer : 0));
+    }
+    functionBase = size();
+    for (auto &func : module) {
+      add(&func, Function, 0,
+          Pointer | (func.isDeclaration() ? Declaration : 0) |
+              (func.getReturnType()->isVoidTy() ? Void : 0));
+      names.push_back(func.getName().str());
+    }
+    for (auto &func : module) {
+      funcArgs.push_back(size());
+      for (auto &arg : func.args()) {
+        add(&arg, Argument, 0, typeFlags(arg.getType()));
+      }
+    }
+    funcArgs.push_back(size());
+    for (auto &func : module) {
+      funcBlocks.push_back(blockSources.size());
+      for (auto &BB : func) {
+        uint32_t b = blockSources.size();
+        blockIds[&BB] = b;
+        blockSources.push_back(&BB);
+        blockParent.push_back(funcBlocks.size() - 1);
+        blockInsts.push_back(size());
+        for (auto &inst : BB) {
+          add(&inst, Instruction, inst.getOpcode(),
+              typeFlags(inst.getType()));
+          block.back() = b;
+        }
+      }
+    }
+    funcBlocks.push_back(blockSources.size());
+    blockInsts.push_back(size());
+
+    // Operands; values appended on the way get theirs in the same loop.
+    operandStart.reserve(size() + 1);
+    for (uint32_t v = 0; v < size(); ++v) {
+      operandStart.push_back(operandList.size());
+      const Value *val = sources[v];
+      if (auto *global = dyn_cast<GlobalVariable>(val)) {
+        if (global->hasInitializer())
+          operandList.push_back(intern(global->getInitializer()));
+      } else if (auto *phi = dyn_cast<PHINode>(val)) {
+        for (const Value *in : phi->incoming_values()) {
+          operandList.push_back(intern(in));
+        }
+        for (const BasicBlock *in : phi->blocks()) {
+          operandList.push_back(intern(in));
+        }
+      } else if (isa<llvm::Instruction>(val) || isa<llvm::ConstantExpr>(val)) {
+        for (const Use &op : cast<User>(val)->operands()) {
+          operandList.push_back(intern(op.get()));
+        }
+      }
+    }
+    operandStart.push_back(operandList.size());
+
+    // Users, one entry per use like Value::users().
+    userStart.assign(size() + 1, 0);
+    for (uint32_t op : operandList) {
+      userStart[op + 1]++;
+    }
+    for (uint32_t v = 0; v < size(); ++v) {
+      userStart[v + 1] += userStart[v];
+    }
+    userList.resize(operandList.size());
+    std::vector<uint32_t> fill(userStart.begin(), userStart.end() - 1);
+    for (uint32_t v = 0; v < size(); ++v) {
+      for (uint32_t op : this->operands(v)) {
+        userList[fill[op]++] = v;
+      }
+    }
+
+    // Block successors from the terminators, predecessors reversed.
+    succStart.reserve(numBlocks + 1);
+    for (uint32_t b = 0; b < numBlocks; ++b) {
+      succStart.push_back(succList.size());
+      if (const auto *term = blockSources[b]->getTerminator()) {
+        for (const BasicBlock *succ : llvm::successors(term)) {
+          succList.push_back(blockIds[succ]);
+        }
+      }
+    }
+    succStart.push_back(succList.size());
+    predStart.assign(numBlocks + 1, 0);
+    for (uint32_t s : succList) {
+      predStart[s + 1]++;
+    }
+    for (uint32_t b = 0; b < numBlocks; ++b) {
+      predStart[b + 1] += predStart[b];
+    }
+    predList.resize(succList.size());
+    fill.assign(predStart.begin(), predStart.end() - 1);
+    for (uint32_t b = 0; b < numBlocks; ++b) {
+      for (uint32_t s : successors(b)) {
+        predList[fill[s]++] = b;
+      }
+    }
+
+    decltype(ids)().swap(ids);
+    decltype(blockIds)().swap(blockIds);
+  }
+
+  size_t size() const { return kind.size(); }
+  size_t numFunctions() const { return funcBlocks.size() - 1; }
+  size_t numBlocks() const { return blockParent.size(); }
+
+  bool isLocal(uint32_t v) const {
+    return kind[v] == Argument || kind[v] == Instruction;
+  }
+  bool isInst(uint32_t v, unsigned op) const {
+    return kind[v] == Instruction && opcode[v] == op;
+  }
+  bool is(uint32_t v, Flag flag) const { return flags[v] & flag; }
+  // A call or an invoke, the CallBase instructions calledOperand handles.
+  bool isCall(uint32_t v) const {
+    return isInst(v, llvm::Instruction::Call) ||
+           isInst(v, llvm::Instruction::Invoke);
+  }
+
+  llvm::ArrayRef<uint32_t> operands(uint32_t v) const {
+    return range(operandList, operandStart, v);
+  }
+  uint32_t operand(uint32_t v, unsigned i) const {
+    return operandList[operandStart[v] + i];
+  }
+  llvm::ArrayRef<uint32_t> users(uint32_t v) const {
+    return range(userList, userStart, v);
+  }
+
+  unsigned numIncoming(uint32_t phi) const {
+    return operands(phi).size() / 2;
+  }
+  uint32_t incomingValue(uint32_t phi, unsigned i) const {
+    return operand(phi, i);
+  }
+  uint32_t incomingBlock(uint32_t phi, unsigned i) const {
+    return block[operand(phi, numIncoming(phi) + i)];
+  }
+
+  // For stores and loads, after LLVM's operand order.
+  uint32_t pointerOperand(uint32_t v) const {
+    return operand(v, opcode[v] == llvm::Instruction::Store ? 1 : 0);
+  }
+  uint32_t calledOperand(uint32_t call) const {
+    return operandList[operandStart[call + 1] - 1];
+  }
+
+  // Functions are numbered f in [0, numFunctions()); their value ID is
+  // functionBase + f.
+  uint32_t functionValue(uint32_t f) const { return functionBase + f; }
+  uint32_t functionIndex(uint32_t v) const { return v - functionBase; }
+  const std::string &name(uint32_t f) const { return names[f]; }
+
+  auto args(uint32_t f) const {
+    return llvm::seq(funcArgs[f], funcArgs[f + 1]);
+  }
+  auto blocks(uint32_t f) const {
+    return llvm::seq(funcBlocks[f], funcBlocks[f + 1]);
+  }
+  auto insts(uint32_t f) const {
+    return llvm::seq(blockInsts[funcBlocks[f]], blockInsts[funcBlocks[f + 1]]);
+  }
+  size_t numInsts(uint32_t f) const { return insts(f).size(); }
+  bool isDeclaration(uint32_t f) const {
+    return flags[functionValue(f)] & Declaration;
+  }
+
+  // Whether v is an argument or an instruction of f.
+  bool owns(uint32_t f, uint32_t v) const {
+    uint32_t first = blockInsts[funcBlocks[f]];
+    uint32_t last = blockInsts[funcBlocks[f + 1]];
+    return (v >= funcArgs[f] && v < funcArgs[f + 1]) ||
+           (v >= first && v < last);
+  }
+
+  // Local numbering of a function: arguments, then instructions.
+  size_t numLocals(uint32_t f) const { return args(f).size() + numInsts(f); }
+  uint32_t localIndex(uint32_t f, uint32_t v) const {
+    uint32_t numArgs = funcArgs[f + 1] - funcArgs[f];
+    return kind[v] == Argument ? v - funcArgs[f]
+                               : numArgs + v - blockInsts[funcBlocks[f]];
+  }
+  uint32_t localValue(uint32_t f, uint32_t i) const {
+    uint32_t numArgs = funcArgs[f + 1] - funcArgs[f];
+    return i < numArgs ? funcArgs[f] + i
+                       : blockInsts[funcBlocks[f]] + i - numArgs;
+  }
+
+  auto instsOf(uint32_t b) const {
+    return llvm::seq(blockInsts[b], blockInsts[b + 1]);
+  }
+  uint32_t terminator(uint32_t b) const { return blockInsts[b + 1] - 1; }
+  uint32_t parentOf(uint32_t b) const { return blockParent[b]; }
+  llvm::ArrayRef<uint32_t> successors(uint32_t b) const {
+    return range(succList, succStart, b);
+  }
+  llvm::ArrayRef<uint32_t> predecessors(uint32_t b) const {
+    return range(predList, predStart, b);
+  }
+
+  // Only while the module is alive.
+  llvm::Value *source(uint32_t v) const {
+    return const_cast<llvm::Value *>(sources[v]);
+  }
+  llvm::BasicBlock *blockSource(uint32_t b) const {
+    return const_cast<llvm::BasicBlock *>(blockSources[b]);
+  }
+
+  size_t bytes() const {
+    size_t total = 0;
+    auto add = [&](const auto &vec) {
+      total += vec.capacity() * sizeof(vec[0]);
+    };
+    add(kind), add(opcode), add(flags), add(block), add(sources);
+    add(operandStart), add(operandList), add(userStart), add(userList);
+    add(funcArgs), add(funcBlocks), add(blockInsts), add(blockParent);
+    add(blockSources), add(succStart), add(succList), add(predStart);
+    add(predList);
+    for (auto &name : names) {
+      total += sizeof(name) + name.capacity();
+    }
+    return total;
+  }
+
+  // Per value.
+  std::vector<Kind> kind;
+  std::vector<uint8_t> opcode, flags;
+  // Block of an instruction, or the block a Block value stands for.
+  std::vector<uint32_t> block;
+
+private:
+  static uint8_t typeFlags(llvm::Type *type) {
+    return (type->isVoidTy() ? Void : 0) | (type->isPointerTy() ? Pointer : 0);
+  }
+
+  static llvm::ArrayRef<uint32_t> range(const std::vector<uint32_t> &targets,
+                                        const std::vector<uint32_t> &start,
+                                        uint32_t i) {
+    return llvm::ArrayRef<uint32_t>(targets.data() + start[i],
+                                    targets.data() + start[i + 1]);
+  }
+  uint32_t add(const llvm::Value *val, Kind k, unsigned op, uint8_t flag) {
+    uint32_t v = size();
+    ids[val] = v;
+    kind.push_back(k);
+    opcode.push_back(op);
+    flags.push_back(flag);
+    block.push_back(None);
+    sources.push_back(val);
+    return v;
+  }
+
+  uint32_t intern(const llvm::Value *val) {
+    using namespace llvm;
+    auto it = ids.find(val);
+    if (it != ids.end())
+      return it->second;
+    if (auto *BB = dyn_cast<BasicBlock>(val)) {
+      uint32_t v = add(val, Block, 0, 0);
+      block[v] = blockIds[BB];
+      return v;
+    }
+    if (auto *cexpr = dyn_cast<llvm::ConstantExpr>(val))
+      return add(val, ConstantExpr, cexpr->getOpcode(),
+                 typeFlags(val->getType()));
+    return add(val, Other, 0, typeFlags(val->getType()));
+  }
+
+  std::vector<const llvm::Value *> sources;
+  std::vector<uint32_t> operandStart, operandList, userStart, userList;
+  uint32_t functionBase = 0;
+  std::vector<std::string> names;
+  std::vector<uint32_t> funcArgs, funcBlocks;
+  // Per block.
+  std::vector<uint32_t> blockInsts, blockParent;
+  std::vector<const llvm::BasicBlock *> blockSources;
+  std::vector<uint32_t> succStart, succList, predStart, predList;
+
+  // Only used while lowering.
+  llvm::DenseMap<const llvm::Value *, uint32_t> ids;
+  llvm::DenseMap<const llvm::BasicBlock *, uint32_t> blockIds;
+};
+
+} // namespace snapshot
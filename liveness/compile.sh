@@ -1,3 +1,11 @@
 clang++ -O3 live.cpp -DNO_OUTPUT -DRUN_COUNT=3 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o live
 
-clang++ -O3 live.cpp -DNO_OUTPUT -DLIVE_CONCURRENT -DPSTATS `llvm-config --cxxflags --ldflags --system-libs --libs core` -o live-c
+clang++ -O3 live.cpp -DNO_OUTPUT -DLIVE_CONCURRENT `llvm-config --cxxflags --ldflags --system-libs --libs core` -o live-c
+
+clang++ -O3 live.cpp -DNO_OUTPUT -DLIVE_CONCURRENT -DSNAPSHOT `llvm-config --cxxflags --ldflags --system-libs --libs core` -o live-snapshot-c
+
+clang++ -O3 live.cpp -DNO_OUTPUT -DLIVE_CONCURRENT -DREACHING_DEFS `llvm-config --cxxflags --ldflags --system-libs --libs core` -o reaching-defs-c
+
+clang++ -O3 live.cpp -DNO_OUTPUT -DLIVE_CONCURRENT -DAVAILABLE_EXPRS `llvm-config --cxxflags --ldflags --system-libs --libs core` -o available-exprs-c
+
+clang++ -O3 live.cpp -DNO_OUTPUT -DLIVE_CONCURRENT -DVERY_BUSY_EXPRS `llvm-config --cxxflags --ldflags --system-libs --libs core` -o very-busy-exprs-c
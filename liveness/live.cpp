@@ -23,22 +23,41 @@
 #include <unordered_set>
 #include <vector>
 
+#include "../common/arena.h"
+#include "../common/cost.h"
+#include "../common/dataflow.h"
+#include "../common/emit.h"
+#include "../common/instrument.h"
+#include "../common/snapshot.h"
+
 #ifndef NTHREADS
 #define NTHREADS 16
 #endif
 
 using namespace llvm;
 
-std::mutex outsmtx;
-
 struct TaskInfo {
   Function *func;
   size_t size;
+  // Predicted time (cost.h); the queue pops the most expensive task first.
+  double cost;
   int index;
 
-  bool operator<(const TaskInfo &rhs) const { return size < rhs.size; }
+  bool operator<(const TaskInfo &rhs) const { return cost < rhs.cost; }
 };
 
+// -DREACHING_DEFS, -DAVAILABLE_EXPRS or -DVERY_BUSY_EXPRS run another problem
+// of the dataflow framework through the same scheduler and output.
+#if defined(REACHING_DEFS)
+using Analysis = dataflow::ReachingDefs;
+#elif defined(AVAILABLE_EXPRS)
+using Analysis = dataflow::AvailableExprs;
+#elif defined(VERY_BUSY_EXPRS)
+using Analysis = dataflow::VeryBusyExprs;
+#else
+using Analysis = dataflow::Liveness;
+#endif
+
 std::set<BasicBlock *> findExitBBs(Function &func) {
   std::set<BasicBlock *> exitBBs;
   for (auto &BB : func) {
@@ -50,52 +69,34 @@ std::set<BasicBlock *> findExitBBs(Function &func) {
   return exitBBs;
 }
 
-// PhiDefs(B) the variables defined by φ-functions at the entry of block B
-// PhiUses(B) the set of variables used in a φ-function at the entry of a
-// successor of the block B
-void findUSEsDEFs(
-    Function &func, std::unordered_map<BasicBlock *, std::set<Value *>> &USEs,
-    std::unordered_map<BasicBlock *, std::set<Value *>> &DEFs,
-    std::unordered_map<BasicBlock *, std::set<Value *>> &phiUSEs,
-    std::unordered_map<BasicBlock *, std::set<Value *>> &phiDEFs) {
-  for (auto &BB : func) {
-    auto &DEF = DEFs[&BB];
-    auto &USE = USEs[&BB];
-    auto &pDEF = phiDEFs[&BB];
-
-    auto iter = BB.begin();
-    for (; iter != BB.end(); ++iter) {
-      if (!isa<PHINode>(*iter))
-        break;
-      auto phi = dyn_cast<PHINode>(&*iter);
-      pDEF.insert(phi);
-      int numIncoming = phi->getNumIncomingValues();
-      for (int i = 0; i < numIncoming; ++i) {
+// Solves Problem on func and stores the facts at the entry (INs) and the
+// exit (OUTs) of every block.
+template <typename Problem>
+void findFacts(Function &func,
+               std::unordered_map<BasicBlock *, std::set<Value *>> &INs,
+               std::unordered_map<BasicBlock *, std::set<Value *>> &OUTs) {
+  if (func.isDeclaration())
+    return;
 
-        Value *inVal = phi->getIncomingValue(i);
-        BasicBlock *inBB = phi->getIncomingBlock(i);
-        if (!isa<Instruction>(inVal) && !isa<Argument>(inVal))
-          continue;
-        phiUSEs[inBB].insert(inVal);
-      }
+  // The problem and the solver come from this thread's arena and are
+  // released in one step on return; INs and OUTs stay in std containers.
+  arena::Scope scope;
+  instrument::PhaseTimer initTimer(instrument::Init);
+  Problem problem(func);
+  dataflow::Solver<Problem> solver(problem);
+  initTimer.stop();
+
+  instrument::PhaseTimer timer(instrument::Solve);
+  solver.solve(problem.universe());
+  for (unsigned b = 0; b < problem.graph.size(); ++b) {
+    BasicBlock *BB = problem.graph.blocks[b];
+    auto &IN = INs[BB];
+    for (unsigned id : solver.entry(b).set_bits()) {
+      IN.insert(problem.fact(id));
     }
-
-    for (; iter != BB.end(); ++iter) {
-      auto &inst = *iter;
-      // if (inst.mayHaveSideEffects())
-      //   sideBBs.insert(&BB);
-
-      for (auto &oprand : inst.operands()) {
-        Value *val = oprand.get();
-        if (isa<Instruction>(val) || isa<Argument>(val)) {
-          if (DEF.find(val) == DEF.end()) {
-            USE.insert(val); // use without def
-          }
-        }
-      }
-      if (!inst.getType()->isVoidTy()) {
-        DEF.insert(&inst);
-      }
+    auto &OUT = OUTs[BB];
+    for (unsigned id : solver.exit(b).set_bits()) {
+      OUT.insert(problem.fact(id));
     }
   }
 }
@@ -103,141 +104,81 @@ void findUSEsDEFs(
 void findLiveVars(Function &func,
                   std::unordered_map<BasicBlock *, std::set<Value *>> &INs,
                   std::unordered_map<BasicBlock *, std::set<Value *>> &OUTs) {
-  if (func.isDeclaration())
-    return;
-
-  std::unordered_map<BasicBlock *, std::set<Value *>> USEs, DEFs, phiUSEs,
-      phiDEFs;
-  std::set<BasicBlock *> sideBBs;
-  findUSEsDEFs(func, USEs, DEFs, phiUSEs, phiDEFs);
-  std::queue<BasicBlock *> worklist;
-  std::unordered_set<BasicBlock *> hashWL;
-  // auto exitBBs = findExitBBs(func);
-  // for (BasicBlock *eBB : exitBBs) {
-  //   if (hashWL.insert(eBB).second)
-  //     worklist.push(eBB);
-  // }
-  // for (BasicBlock *sBB : sideBBs) {
-  //   if (hashWL.insert(sBB).second)
-  //     worklist.push(sBB);
-  // }
-  ReversePostOrderTraversal<Function *> RPOT(&func);
-  for (BasicBlock *BB : RPOT) {
-    if (hashWL.insert(BB).second)
-      worklist.push(BB);
-  }
-
-  // std::unordered_map<BasicBlock *, std::set<Value *>> INs, OUTs;
-  while (!worklist.empty()) {
-    BasicBlock *BB = worklist.front();
-    worklist.pop();
-    hashWL.erase(BB);
+  findFacts<Analysis>(func, INs, OUTs);
+}
 
-    // LiveOut(B) = ⋃_S∈succs(B) (LiveIn(S) \ PhiDefs(S)) ∪ PhiUses(B)
-    // LiveIn(B) = PhiDefs(B) ∪ UpwardExposed(B) ∪ (LiveOut(B) \ Defs(B))
-    // std::set<Value *> oldIN = INs[BB], oldOUT = OUTs[BB];
-    bool changed = false;
-    std::set<Value *> liveIN, liveOUT;
-    liveOUT = phiUSEs[BB];
-    for (BasicBlock *succ : successors(BB)) {
-      std::set_difference(INs[succ].begin(), INs[succ].end(),
-                          phiDEFs[succ].begin(), phiDEFs[succ].end(),
-                          std::inserter(liveOUT, liveOUT.end()));
-    }
-    changed |= (OUTs[BB] != liveOUT);
-    OUTs[BB] = liveOUT;
+// -DSNAPSHOT lowers the module into a snapshot.h copy once and runs
+// liveness on that. Concurrent NO_OUTPUT builds drop the module right
+// after lowering; otherwise it stays for the CSV features and the output.
+#ifdef SNAPSHOT
+#if defined(REACHING_DEFS) || defined(AVAILABLE_EXPRS) ||                     \
+    defined(VERY_BUSY_EXPRS)
+#error "-DSNAPSHOT only runs liveness"
+#endif
+const snapshot::Module *ir = nullptr;
+// Facts at the entry and the exit of every snapshot block, as local indices
+// of its function.
+std::vector<dataflow::Facts> blockINs, blockOUTs;
 
-    liveIN = phiDEFs[BB];
-    std::set_difference(OUTs[BB].begin(), OUTs[BB].end(), DEFs[BB].begin(),
-                        DEFs[BB].end(), std::inserter(liveIN, liveIN.end()));
-    liveIN.insert(USEs[BB].begin(), USEs[BB].end());
-    changed |= (INs[BB] != liveIN);
-    INs[BB] = liveIN;
+void findLiveVars(uint32_t func) {
+  if (ir->isDeclaration(func))
+    return;
 
-    if (changed) {
-      for (BasicBlock *pred : predecessors(BB)) {
-        if (hashWL.insert(pred).second)
-          worklist.push(pred);
-      }
-    }
+  arena::Scope scope;
+  instrument::PhaseTimer initTimer(instrument::Init);
+  dataflow::SnapshotLiveness problem(*ir, func);
+  dataflow::Solver<dataflow::SnapshotLiveness> solver(problem);
+  initTimer.stop();
+
+  instrument::PhaseTimer timer(instrument::Solve);
+  solver.solve(problem.universe());
+  for (unsigned b = 0; b < problem.graph.size(); ++b) {
+    blockINs[problem.graph.ids[b]] = solver.entry(b);
+    blockOUTs[problem.graph.ids[b]] = solver.exit(b);
   }
 }
+#endif
 
 void threadedLiveVars(
     std::mutex &Qmutex, std::priority_queue<TaskInfo> &taskQ,
-    std::vector<std::unordered_map<BasicBlock *, std::set<Value *>>> &funcINs,
-    std::vector<std::unordered_map<BasicBlock *, std::set<Value *>>> &funcOUTs,
+    [[maybe_unused]] std::vector<
+        std::unordered_map<BasicBlock *, std::set<Value *>>> &funcINs,
+    [[maybe_unused]] std::vector<
+        std::unordered_map<BasicBlock *, std::set<Value *>>> &funcOUTs,
     int tid) {
-  auto start = std::chrono::high_resolution_clock::now();
-  int max_time = 0;
-  int max_size = 0;
-  int task_count = 0;
-  int total_size = 0;
-  int total_size_sq = 0;
-  int total_time = 0;
-  int total_time_sq = 0;
-
+  instrument::ThreadScope scope("worker " + std::to_string(tid));
   while (true) {
     int index;
+#ifndef SNAPSHOT
     Function *func;
+#endif
     int size;
     {
       std::lock_guard<std::mutex> lock(Qmutex);
       if (taskQ.empty())
         break;
       index = taskQ.top().index;
+#ifndef SNAPSHOT
       func = taskQ.top().func;
+#endif
       size = taskQ.top().size;
       taskQ.pop();
     }
-#ifdef PSTATS
-    auto sub_start = std::chrono::high_resolution_clock::now();
-#endif
+#ifdef SNAPSHOT
+    instrument::TaskTimer task(size, ir->name(index), size,
+                               ir->numInsts(index));
+    findLiveVars(index);
+#else
+    instrument::TaskTimer task(size, func);
     findLiveVars(*func, funcINs[index], funcOUTs[index]);
-#ifdef PSTATS
-    auto sub_end = std::chrono::high_resolution_clock::now();
-    auto sub_duration =
-        std::chrono::duration_cast<std::chrono::milliseconds>(sub_end -
-        sub_start);
-    int time = sub_duration.count();
-    if (time > max_time){
-      max_time = time;
-      max_size = size;
-    }
-    task_count++;
-    total_size += size;
-    total_size_sq += size * size;
-    total_time += time;
-    total_time_sq += time * time;
 #endif
   }
-
-#ifdef PSTATS
-  auto end = std::chrono::high_resolution_clock::now();
-  auto duration =
-      std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-
-  int mean_size = total_size / task_count;
-  int var_size = (total_size_sq / task_count) - (mean_size * mean_size);
-  int mean_time = total_time / task_count;
-  int var_time = (total_time_sq / task_count) - (mean_time * mean_time);
-
-  {
-    std::lock_guard<std::mutex> lock(outsmtx);
-    outs() << "\nThread " << tid << "\ttime:\t" << duration.count() << " ms\n";
-    outs() << "Max task time :\t " << max_time << " ms with\t " << max_size
-           << " BBs\n";
-    outs() << "Tasks processed:\t" << task_count << "\n";
-    outs() << "Task size mean:\t" << mean_size << ", var:\t" << var_size
-           << ", std dev:\t" << (int)std::sqrt(var_size) << "\n";
-    outs() << "Task time mean:\t" << mean_time << ", var:\t" << var_time
-           << ", std dev:\t" << (int)std::sqrt(var_time) << "\n";
-  }
-#endif
 }
 
 int main(int argc, char *argv[]) {
   InitLLVM X(argc, argv);
+  instrument::init(argc, argv);
+  emit::init(argc, argv);
   if (argc < 2) {
     errs() << "Expect IR filename\n";
     exit(1);
@@ -245,7 +186,11 @@ int main(int argc, char *argv[]) {
   LLVMContext context;
   SMDiagnostic smd;
   char *filename = argv[1];
-  std::unique_ptr<Module> module = parseIRFile(filename, smd, context);
+  std::unique_ptr<Module> module;
+  {
+    instrument::PhaseTimer timer(instrument::Parse);
+    module = parseIRFile(filename, smd, context);
+  }
   if (!module) {
     errs() << "Cannot parse IR file\n";
     smd.print(filename, errs());
@@ -254,6 +199,19 @@ int main(int argc, char *argv[]) {
 
   auto start = std::chrono::high_resolution_clock::now();
 
+#ifdef SNAPSHOT
+  std::unique_ptr<snapshot::Module> lowered;
+  {
+    instrument::PhaseTimer timer(instrument::Init);
+    lowered = std::make_unique<snapshot::Module>(*module);
+  }
+  ir = lowered.get();
+  blockINs.resize(ir->numBlocks());
+  blockOUTs.resize(ir->numBlocks());
+  outs() << "Snapshot: " << ir->size() << " values, " << ir->bytes() / 1024
+         << " KiB\n";
+#endif
+
   std::vector<std::unordered_map<BasicBlock *, std::set<Value *>>> funcINs(
       module->size()),
       funcOUTs(module->size());
@@ -266,8 +224,11 @@ int main(int argc, char *argv[]) {
   for (auto [i, func] : enumerate(*module)) {
     if (func.isDeclaration())
       continue;
-    taskQ.push({&func, func.size(), (int)i});
+    taskQ.push({&func, func.size(), liveCost.predict(func), (int)i});
   }
+#if defined(SNAPSHOT) && defined(NO_OUTPUT)
+  module.reset();
+#endif
 
   std::mutex Qmutex;
   std::vector<std::thread> threads;
@@ -284,26 +245,30 @@ int main(int argc, char *argv[]) {
   outs() << "sequential mode\n";
   std::string csvname = std::string(argv[1]) + ".csv";
   std::ofstream csv(csvname);
-  csv << "name,size,time(us)\n";
+  csv << "name," << FuncFeatures::csvHeader() << ",time(us)\n";
 #ifndef RUN_COUNT
 #define RUN_COUNT 1
 #endif
 
   for (auto [i, func] : enumerate(*module)) {
     std::string fname = func.getName().str();
-    size_t fsize = func.size();
-    int tftime = 0;
+    FuncFeatures features(func);
+    double tftime = 0;
     for (int r = 0; r < RUN_COUNT; ++r) {
       auto fstart = std::chrono::high_resolution_clock::now();
+#ifdef SNAPSHOT
+      findLiveVars(i);
+#else
       findLiveVars(func, funcINs[i], funcOUTs[i]);
+#endif
       auto fend = std::chrono::high_resolution_clock::now();
       auto ftime =
-          std::chrono::duration_cast<std::chrono::microseconds>(fend - fstart)
+          std::chrono::duration_cast<std::chrono::nanoseconds>(fend - fstart)
               .count();
-      tftime += ftime;
+      tftime += ftime / 1000.0;
     }
     tftime /= RUN_COUNT;
-    csv << fname << "," << fsize << "," << tftime << "\n";
+    csv << fname << "," << features.csvRow() << "," << tftime << "\n";
   }
 #endif
 
@@ -315,20 +280,45 @@ int main(int argc, char *argv[]) {
   outs() << "Analysis time: " << duration.count() << " ms\n";
 
 #ifndef NO_OUTPUT
+  instrument::PhaseTimer outputTimer(instrument::Output);
+#ifdef SNAPSHOT
+  for (uint32_t b = 0; b < ir->numBlocks(); ++b) {
+    uint32_t f = ir->parentOf(b);
+    BasicBlock *BB = ir->blockSource(b);
+    for (unsigned id : blockINs[b].set_bits()) {
+      funcINs[f][BB].insert(ir->source(ir->localValue(f, id)));
+    }
+    for (unsigned id : blockOUTs[b].set_bits()) {
+      funcOUTs[f][BB].insert(ir->source(ir->localValue(f, id)));
+    }
+  }
+#endif
+  emit::Writer writer(*module, "live");
+  auto &os = writer.os();
   for (auto [i, func] : enumerate(*module)) {
-    outs() << "\nFunction: " << func.getName().data() << "\n";
+    if (emit::format != emit::Full) {
+      if (func.isDeclaration())
+        continue;
+      writer.beginFunction(func);
+      for (auto &BB : func) {
+        writer.record("in", &BB, funcINs[i][&BB]);
+        writer.record("out", &BB, funcOUTs[i][&BB]);
+      }
+      continue;
+    }
+    os << "\nFunction: " << func.getName().data() << "\n";
     for (auto &BB : func) {
-      outs() << BB;
-      outs() << "IN set: ----------------\n";
+      os << writer.full(BB);
+      os << "IN set: ----------------\n";
       for (auto in : funcINs[i][&BB]) {
-        outs() << *in << "\n";
+        os << writer.full(*in) << "\n";
       }
-      outs() << "---------------- :IN set\n";
-      outs() << "OUT set: ++++++++++++++++\n";
+      os << "---------------- :IN set\n";
+      os << "OUT set: ++++++++++++++++\n";
       for (auto out : funcOUTs[i][&BB]) {
-        outs() << *out << "\n";
+        os << writer.full(*out) << "\n";
       }
-      outs() << "++++++++++++++++ :OUT set\n";
+      os << "++++++++++++++++ :OUT set\n";
       // outs() << "DEF set: ****************\n";
       // for (auto def : DEFs[&BB]) {
       //   outs() << *def << "\n";
@@ -350,8 +340,13 @@ int main(int argc, char *argv[]) {
       // }
       // outs() << "**************** :phiUSE\n";
     }
-    outs() << "******************************** " << func.getName().data()
-           << "\n";
+    os << "******************************** " << func.getName().data()
+       << "\n";
   }
+  writer.finish();
+  outputTimer.stop();
 #endif
-}
\ No newline at end of file
+
+  instrument::report("live", filename);
+  return 0;
+}
@@ -1,11 +1,35 @@
 # clang++ -O3 p2-steensgaard.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-steensgaard
 
+# clang++ -O3 p2-steensgaard.cpp -DPTR_FILTER `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-steensgaard-filter
+
+# clang++ -O3 p2-steensgaard.cpp -DPARALLEL -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-steensgaard-parallel
+
+# clang++ -O3 p2-steensgaard.cpp -DSTREAMING `llvm-config --cxxflags --ldflags --system-libs --libs core irreader bitreader` -o p2-steensgaard-stream
+
+# clang++ -O3 p2-onelevel.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-onelevel
+
 # clang++ -O3 -g p2-inter-dense.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-dense
 
 # clang++ -O3 -g p2-inter.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter
 
+# clang++ -O3 -g p2-inter.cpp -DCSR_GRAPH -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-csr
+
+# clang++ -O3 -g p2-inter.cpp -DCSR_GRAPH -DPARTITION -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-partition
+
+# clang++ -O3 -g p2-inter.cpp -DCSR_GRAPH -DSFS -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-sfs
+
+# clang++ -O3 -g p2-inter.cpp -DCSR_GRAPH -DPARTITION -DSFS -DANDERSEN_AUX -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-sfs-andersen
+
+# clang++ -O3 -g p2-inter.cpp -DCSR_GRAPH -DNTHREADS=4 -DPTR_FILTER `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-csr-filter
+
+# clang++ -O3 -g p2-inter.cpp -DDEMAND -DQUERY_BUDGET=100000 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-inter-demand
+
 clang++ -O3 p2.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2
 
-clang++ -O3 p2.cpp -DCONCURRENT -DNTHREADS=4 -DPRINT_STATS `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-c
+clang++ -O3 p2.cpp -DCONCURRENT -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-c
+
+clang++ -O3 p2.cpp -DCONCURRENT -DNTHREADS=4 -DPTR_FILTER `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-filter-c
+
+clang++ -O3 p2.cpp -DCONCURRENT -DNTHREADS=4 -DSNAPSHOT `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-snapshot-c
 
 clang++ -O3 p2.cpp -DCSV -DRUN_COUNT=3 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o p2-csv
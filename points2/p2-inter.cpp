@@ -1,8 +1,14 @@
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/SparseBitVector.h"
+#include "llvm/Analysis/IteratedDominanceFrontier.h"
 #include "llvm/IR/Argument.h"
 #include "llvm/IR/CFG.h"
+#include "llvm/IR/Dominators.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
@@ -10,14 +16,28 @@
 #include "llvm/IR/User.h"
 #include "llvm/IR/Value.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <queue>
 #include <set>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../common/avgpts.h"
+#include "../common/ptrfilter.h"
 
 using namespace llvm;
 
@@ -27,6 +47,22 @@ DenseMap<Value *, std::set<Value *>> WLMap;
 std::unordered_map<Value *, std::set<Value *>> PFG;
 std::unordered_set<Value *> RM;
 
+// -DPTR_FILTER leaves values that cannot hold an address (ptrfilter.h) out
+// of the pointer flow graph. The filter follows direct calls, so integers
+// that carry an address into a callee are kept.
+#ifdef PTR_FILTER
+ptrfilter::Filter pointerFilter;
+ptrfilter::Tally tally;
+
+bool keepEdge(Value *s, Value *t) { return tally(pointerFilter.keep(s, t)); }
+
+bool relevant(Value *val) { return pointerFilter.relevant(val); }
+#else
+bool keepEdge(Value *, Value *) { return true; }
+
+bool relevant(Value *) { return true; }
+#endif
+
 void worklistPush(Value *key, const std::set<Value *> &sset) {
   auto it = WLMap.find(key);
   if (it != WLMap.end()) {
@@ -68,7 +104,8 @@ void initialize(Function &func) {
       } else if (auto *phi = dyn_cast<PHINode>(&inst)) {
         for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
           Value *val = phi->getIncomingValue(i);
-          if (isa<Instruction>(val) || isa<Argument>(val)) {
+          if ((isa<Instruction>(val) || isa<Argument>(val)) &&
+              keepEdge(val, phi)) {
             addEdge(val, phi);
           }
         }
@@ -76,16 +113,19 @@ void initialize(Function &func) {
       } else if (auto *select = dyn_cast<SelectInst>(&inst)) {
         Value *tval = select->getTrueValue();
         Value *fval = select->getFalseValue();
-        if (isa<Instruction>(tval) || isa<Argument>(tval)) {
+        if ((isa<Instruction>(tval) || isa<Argument>(tval)) &&
+            keepEdge(tval, select)) {
           addEdge(tval, select);
         }
-        if (isa<Instruction>(fval) || isa<Argument>(fval)) {
+        if ((isa<Instruction>(fval) || isa<Argument>(fval)) &&
+            keepEdge(fval, select)) {
           addEdge(fval, select);
         }
 
       } else if (auto *cast = dyn_cast<CastInst>(&inst)) {
         Value *src = cast->getOperand(0);
-        addEdge(src, cast);
+        if (keepEdge(src, cast))
+          addEdge(src, cast);
       }
 
       else if (auto *call = dyn_cast<CallInst>(&inst)) {
@@ -93,11 +133,12 @@ void initialize(Function &func) {
         if (!cf || cf->isDeclaration())
           continue;
         for (int i = 0; i < call->arg_size(); ++i) {
-          if (i < cf->arg_size()) {
+          if (i < cf->arg_size() &&
+              keepEdge(call->getArgOperand(i), cf->getArg(i))) {
             addEdge(call->getArgOperand(i), cf->getArg(i));
           }
         }
-        if (!cf->getReturnType()->isVoidTy()) {
+        if (!cf->getReturnType()->isVoidTy() && relevant(call)) {
           for (auto &cfBB : *cf) {
             for (auto &cfinst : cfBB) {
               if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(&cfinst)) {
@@ -146,7 +187,7 @@ void solve() {
         // *x = y (store y -> ptr x)
         if (store->getPointerOperand() == n) {
           Value *y = store->getValueOperand();
-          if (isa<Instruction>(y) || isa<Argument>(y)) {
+          if ((isa<Instruction>(y) || isa<Argument>(y)) && relevant(y)) {
             for (Value *oi : delta) {
               addEdge(y, oi);
             }
@@ -155,7 +196,7 @@ void solve() {
 
       } else if (LoadInst *load = dyn_cast<LoadInst>(user)) {
         // y = *x (load ptr x -> y)
-        if (load->getPointerOperand() == n) {
+        if (load->getPointerOperand() == n && relevant(load)) {
           Value *y = load;
           for (Value *oi : delta) {
             addEdge(oi, y);
@@ -192,6 +233,1577 @@ void print() {
   // }
 }
 
+#ifdef DEMAND
+#ifndef QUERY_BUDGET
+#define QUERY_BUDGET 100000
+#endif
+
+// Demand-driven queries over the pointer flow graph built by initialize, with
+// the same rules as solve. pointsTo(v) only solves what v depends on: the copy
+// predecessors of a demanded node, the pointer of a demanded load and the
+// objects it loads from, and the stores that may write to a demanded object.
+// An object whose address is never stored can only be written through the
+// pointers it flows to, so only their stores are demanded; every store is a
+// candidate for an escaped object.
+//
+// Solved nodes stay cached, so later queries only pay for what they add. A
+// query that runs out of steps answers with every allocation, which is sound,
+// and its unfinished work is resumed by the next query.
+class DemandPointsTo {
+public:
+  size_t queries = 0;
+  size_t precise = 0;
+  size_t fallbacks = 0;
+  size_t cacheHits = 0;
+  size_t steps = 0;
+
+  explicit DemandPointsTo(Module &module) {
+    for (auto &[src, dsts] : PFG) {
+      for (auto *dst : dsts) {
+        preds[dst].push_back(src);
+      }
+    }
+    for (auto &[key, pts] : WLMap) {
+      if (pts.count(key))
+        allocs.insert(key);
+    }
+    for (auto &func : module) {
+      if (!RM.count(&func))
+        continue;
+      for (auto &BB : func) {
+        for (auto &inst : BB) {
+          if (auto *store = dyn_cast<StoreInst>(&inst))
+            stores.push_back(store);
+        }
+      }
+    }
+  }
+
+  size_t demanded() const { return nodes.size(); }
+
+  // Fills result with the points-to set of val. Returns false if the query
+  // ran out of budget and result is the fallback.
+  bool pointsTo(Value *val, std::set<Value *> &result) {
+    queries++;
+    result.clear();
+    unsigned n = id(val);
+    if (nodes[n].demanded && demandQueue.empty() && worklist.empty()) {
+      cacheHits++;
+    }
+    demand(n);
+    size_t budget = steps + QUERY_BUDGET;
+    while (!demandQueue.empty() || !worklist.empty()) {
+      if (steps > budget) {
+        fallbacks++;
+        result = allocs;
+        return false;
+      }
+      if (!demandQueue.empty()) {
+        unsigned d = demandQueue.front();
+        demandQueue.pop_front();
+        expand(d);
+      } else {
+        unsigned x = worklist.front();
+        worklist.pop_front();
+        nodes[x].queued = false;
+        propagateDelta(x);
+      }
+    }
+    precise++;
+    for (unsigned obj : nodes[n].pts) {
+      result.insert(vals[obj]);
+    }
+    return true;
+  }
+
+private:
+  struct Node {
+    SparseBitVector<> pts;
+    SparseBitVector<> done;
+    std::vector<unsigned> succs;
+    bool demanded = false;
+    bool queued = false;
+  };
+
+  std::unordered_map<Value *, std::vector<Value *>> preds;
+  std::set<Value *> allocs;
+  std::vector<StoreInst *> stores;
+
+  DenseMap<Value *, unsigned> ids;
+  std::vector<Value *> vals;
+  std::vector<Node> nodes;
+  DenseSet<std::pair<unsigned, unsigned>> edges;
+  std::deque<unsigned> demandQueue;
+  std::deque<unsigned> worklist;
+
+  unsigned id(Value *val) {
+    auto [it, inserted] = ids.try_emplace(val, vals.size());
+    if (inserted) {
+      vals.push_back(val);
+      nodes.emplace_back();
+    }
+    return it->second;
+  }
+
+  void demand(unsigned n) {
+    if (nodes[n].demanded)
+      return;
+    nodes[n].demanded = true;
+    demandQueue.push_back(n);
+  }
+
+  void enqueue(unsigned n) {
+    if (!nodes[n].queued) {
+      nodes[n].queued = true;
+      worklist.push_back(n);
+    }
+  }
+
+  void addEdge(unsigned src, unsigned dst) {
+    steps++;
+    if (!edges.insert({src, dst}).second)
+      return;
+    nodes[src].succs.push_back(dst);
+    demand(src);
+    if (nodes[dst].pts |= nodes[src].done)
+      enqueue(dst);
+  }
+
+  void expand(unsigned n) {
+    steps++;
+    Value *val = vals[n];
+    if (allocs.count(val)) {
+      if (nodes[n].pts.test_and_set(n))
+        enqueue(n);
+      demandStores(n);
+    }
+    auto it = preds.find(val);
+    if (it != preds.end()) {
+      for (auto *src : it->second) {
+        addEdge(id(src), n);
+      }
+    }
+    if (auto *load = dyn_cast<LoadInst>(val)) {
+      unsigned x = id(load->getPointerOperand());
+      demand(x);
+      for (unsigned obj : SparseBitVector<>(nodes[x].done)) {
+        addEdge(obj, n);
+      }
+    }
+  }
+
+  // Demands the pointers of the stores that may write to obj.
+  void demandStores(unsigned obj) {
+    std::vector<Value *> flows{vals[obj]};
+    std::unordered_set<Value *> seen{vals[obj]};
+    bool escaped = false;
+    for (size_t i = 0; i < flows.size() && !escaped; ++i) {
+      steps++;
+      Value *ptr = flows[i];
+      auto next = [&](Value *v) {
+        if (seen.insert(v).second)
+          flows.push_back(v);
+      };
+      auto it = PFG.find(ptr);
+      if (it != PFG.end()) {
+        for (auto *dst : it->second) {
+          next(dst);
+        }
+      }
+      for (auto *user : ptr->users()) {
+        if (auto *store = dyn_cast<StoreInst>(user)) {
+          escaped |= store->getValueOperand() == ptr;
+        } else if (auto *load = dyn_cast<LoadInst>(user)) {
+          next(load);
+        }
+      }
+    }
+    auto candidate = [&](StoreInst *store) {
+      Value *y = store->getValueOperand();
+      if (!isa<Instruction>(y) && !isa<Argument>(y))
+        return;
+      unsigned x = id(store->getPointerOperand());
+      demand(x);
+      if (nodes[x].done.test(obj))
+        addEdge(id(y), obj);
+    };
+    if (escaped) {
+      for (auto *store : stores) {
+        candidate(store);
+      }
+      return;
+    }
+    for (auto *ptr : flows) {
+      for (auto *user : ptr->users()) {
+        auto *store = dyn_cast<StoreInst>(user);
+        if (store && store->getPointerOperand() == ptr)
+          candidate(store);
+      }
+    }
+  }
+
+  void propagateDelta(unsigned x) {
+    SparseBitVector<> delta;
+    delta.intersectWithComplement(nodes[x].pts, nodes[x].done);
+    if (delta.empty())
+      return;
+    nodes[x].done |= delta;
+    for (size_t i = 0; i < nodes[x].succs.size(); ++i) {
+      steps++;
+      unsigned succ = nodes[x].succs[i];
+      if (nodes[succ].pts |= delta)
+        enqueue(succ);
+    }
+    for (auto *user : vals[x]->users()) {
+      if (auto *store = dyn_cast<StoreInst>(user)) {
+        Value *y = store->getValueOperand();
+        if (store->getPointerOperand() != vals[x] ||
+            (!isa<Instruction>(y) && !isa<Argument>(y)))
+          continue;
+        for (unsigned obj : delta) {
+          if (nodes[obj].demanded)
+            addEdge(id(y), obj);
+        }
+      } else if (auto *load = dyn_cast<LoadInst>(user)) {
+        auto it = ids.find(load);
+        if (load->getPointerOperand() != vals[x] || it == ids.end() ||
+            !nodes[it->second].demanded)
+          continue;
+        for (unsigned obj : delta) {
+          addEdge(obj, it->second);
+        }
+      }
+    }
+  }
+};
+#endif
+
+#if defined(PARTITION) && !defined(CSR_GRAPH)
+#error "-DPARTITION splits the constraint graph of -DCSR_GRAPH"
+#endif
+#if defined(SFS) && !defined(CSR_GRAPH)
+#error "-DSFS builds on the solver of -DCSR_GRAPH"
+#endif
+#if defined(ANDERSEN_AUX) && !defined(SFS)
+#error "-DANDERSEN_AUX picks the auxiliary analysis of -DSFS"
+#endif
+
+#ifdef CSR_GRAPH
+#ifdef DEMAND
+#error "-DCSR_GRAPH replaces the exhaustive solver and cannot take -DDEMAND"
+#endif
+#ifndef NTHREADS
+#define NTHREADS 16
+#endif
+
+// -DCSR_GRAPH splits the analysis into three phases. Extraction summarizes
+// every defined function in parallel into flat constraint arrays. Assembly
+// links the summaries of the functions reachable from main into a CSR
+// constraint graph over dense node IDs; a call site costs its arguments and
+// the callee's returned values instead of a rescan of the callee body. The
+// solver then propagates differences over the graph with bit-vector sets.
+//
+// The rules are those of initialize and solve. Only arguments and
+// instructions can ever point to something, so constraints whose source or
+// pointer is another value are dropped while extracting.
+
+constexpr unsigned NoNode = ~0u;
+
+// Constraints of one function. Nodes are local numbers: the arguments, then
+// the instructions in layout order.
+struct Summary {
+  std::vector<Value *> values;
+  unsigned numArgs = 0;
+  // o = &o, for allocas and GEPs.
+  std::vector<unsigned> allocs;
+  // {src, dst} for dst = src.
+  std::vector<std::pair<unsigned, unsigned>> copies;
+  // {ptr, dst} for dst = *ptr.
+  std::vector<std::pair<unsigned, unsigned>> loads;
+  // {ptr, src} for *ptr = src.
+  std::vector<std::pair<unsigned, unsigned>> stores;
+  std::vector<unsigned> returns;
+  // {call, callee index} of direct calls to defined functions. The actual
+  // arguments of call c are callArgs[argStart[c]..argStart[c + 1]), NoNode
+  // where the argument is not local.
+  std::vector<std::pair<unsigned, unsigned>> calls;
+  std::vector<unsigned> argStart{0};
+  std::vector<unsigned> callArgs;
+};
+
+void summarize(Function &func, const DenseMap<Function *, unsigned> &funcIndex,
+               DenseMap<Value *, unsigned> &local, Summary &sum) {
+  local.clear();
+  for (auto &arg : func.args()) {
+    local[&arg] = sum.values.size();
+    sum.values.push_back(&arg);
+  }
+  sum.numArgs = sum.values.size();
+  for (auto &BB : func) {
+    for (auto &inst : BB) {
+      local[&inst] = sum.values.size();
+      sum.values.push_back(&inst);
+    }
+  }
+  auto node = [&](Value *val) {
+    auto it = local.find(val);
+    return it == local.end() ? NoNode : it->second;
+  };
+#ifdef PTR_FILTER
+  ptrfilter::Tally edges;
+  auto keep = [&](Value *src, Value *dst) {
+    return edges(pointerFilter.keep(src, dst));
+  };
+#else
+  auto keep = [](Value *, Value *) { return true; };
+#endif
+  auto copy = [&](Value *src, unsigned dst) {
+    unsigned n = node(src);
+    if (n != NoNode && keep(src, sum.values[dst]))
+      sum.copies.push_back({n, dst});
+  };
+
+  for (unsigned n = sum.numArgs; n < sum.values.size(); ++n) {
+    auto *inst = cast<Instruction>(sum.values[n]);
+    if (isa<AllocaInst>(inst) || isa<GetElementPtrInst>(inst)) {
+      sum.allocs.push_back(n);
+
+    } else if (auto *phi = dyn_cast<PHINode>(inst)) {
+      for (Value *val : phi->incoming_values()) {
+        copy(val, n);
+      }
+
+    } else if (auto *select = dyn_cast<SelectInst>(inst)) {
+      copy(select->getTrueValue(), n);
+      copy(select->getFalseValue(), n);
+
+    } else if (auto *cast = dyn_cast<CastInst>(inst)) {
+      copy(cast->getOperand(0), n);
+
+    } else if (auto *call = dyn_cast<CallInst>(inst)) {
+      auto *cf = call->getCalledFunction();
+      if (!cf || cf->isDeclaration())
+        continue;
+      sum.calls.push_back({n, funcIndex.lookup(cf)});
+      for (unsigned i = 0; i < call->arg_size() && i < cf->arg_size(); ++i) {
+        Value *arg = call->getArgOperand(i);
+        bool kept = node(arg) != NoNode && keep(arg, cf->getArg(i));
+        sum.callArgs.push_back(kept ? node(arg) : NoNode);
+      }
+      sum.argStart.push_back(sum.callArgs.size());
+
+    } else if (auto *load = dyn_cast<LoadInst>(inst)) {
+      unsigned ptr = node(load->getPointerOperand());
+      if (ptr != NoNode && relevant(load))
+        sum.loads.push_back({ptr, n});
+
+    } else if (auto *store = dyn_cast<StoreInst>(inst)) {
+      unsigned ptr = node(store->getPointerOperand());
+      unsigned src = node(store->getValueOperand());
+      if (ptr != NoNode && src != NoNode && relevant(sum.values[src]))
+        sum.stores.push_back({ptr, src});
+
+    } else if (auto *ret = dyn_cast<ReturnInst>(inst)) {
+      if (Value *retVal = ret->getReturnValue()) {
+        unsigned src = node(retVal);
+        if (src != NoNode && relevant(retVal))
+          sum.returns.push_back(src);
+      }
+    }
+  }
+}
+
+// Runs worker on up to NTHREADS threads, one per minTasks of tasks. The
+// calling thread works too, so small inputs start no threads.
+template <typename Worker>
+void runWorkers(size_t tasks, size_t minTasks, Worker worker) {
+  size_t helpers = std::min<size_t>(NTHREADS, tasks / minTasks + 1) - 1;
+  std::vector<std::thread> threads;
+  threads.reserve(helpers);
+  for (size_t i = 0; i < helpers; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &t : threads) {
+    t.join();
+  }
+}
+
+// Summaries of the defined functions of module, indexed like funcs.
+std::vector<Summary> extractConstraints(Module &module,
+                                        std::vector<Function *> &funcs) {
+  DenseMap<Function *, unsigned> funcIndex;
+  for (auto &func : module) {
+    if (func.isDeclaration())
+      continue;
+    funcIndex[&func] = funcs.size();
+    funcs.push_back(&func);
+  }
+  std::vector<Summary> summaries(funcs.size());
+  std::atomic<size_t> next(0);
+  auto worker = [&] {
+    DenseMap<Value *, unsigned> local;
+    for (size_t f; (f = next++) < funcs.size();) {
+      summarize(*funcs[f], funcIndex, local, summaries[f]);
+    }
+  };
+  runWorkers(funcs.size(), 8, worker);
+  return summaries;
+}
+
+// Constraints of the reachable functions over dense node IDs, with the copy,
+// load and store constraints grouped by source and pointer node.
+struct ConstraintGraph {
+  std::vector<Value *> values;
+  std::vector<unsigned> allocs;
+  std::vector<unsigned> copyStart, copyList;
+  std::vector<unsigned> loadStart, loadList;
+  std::vector<unsigned> storeStart, storeList;
+  size_t reachable = 0;
+  // Nodes of the i-th reachable function are [funcStart[i], funcStart[i + 1]).
+  std::vector<unsigned> funcStart;
+
+  size_t size() const { return values.size(); }
+  size_t numEdges() const {
+    return copyList.size() + loadList.size() + storeList.size();
+  }
+
+  ArrayRef<unsigned> copies(unsigned n) const {
+    return range(copyStart, copyList, n);
+  }
+  ArrayRef<unsigned> loads(unsigned n) const {
+    return range(loadStart, loadList, n);
+  }
+  ArrayRef<unsigned> stores(unsigned n) const {
+    return range(storeStart, storeList, n);
+  }
+
+private:
+  static ArrayRef<unsigned> range(const std::vector<unsigned> &start,
+                                  const std::vector<unsigned> &list,
+                                  unsigned n) {
+    return ArrayRef<unsigned>(list).slice(start[n], start[n + 1] - start[n]);
+  }
+};
+
+// Counting sort of edges by their first node into start/list.
+void toCSR(size_t numNodes,
+           const std::vector<std::pair<unsigned, unsigned>> &edges,
+           std::vector<unsigned> &start, std::vector<unsigned> &list) {
+  start.assign(numNodes + 1, 0);
+  for (auto &edge : edges) {
+    start[edge.first + 1]++;
+  }
+  for (size_t n = 0; n < numNodes; ++n) {
+    start[n + 1] += start[n];
+  }
+  list.resize(edges.size());
+  std::vector<unsigned> fill(start.begin(), start.end() - 1);
+  for (auto &edge : edges) {
+    list[fill[edge.first]++] = edge.second;
+  }
+}
+
+ConstraintGraph assemble(const std::vector<Summary> &summaries,
+                         unsigned mainIndex) {
+  // Functions reachable through direct calls, numbered in discovery order.
+  std::vector<unsigned> base(summaries.size(), NoNode);
+  std::vector<unsigned> order{mainIndex};
+  base[mainIndex] = 0;
+  unsigned numNodes = summaries[mainIndex].values.size();
+  for (size_t i = 0; i < order.size(); ++i) {
+    for (auto &call : summaries[order[i]].calls) {
+      if (base[call.second] != NoNode)
+        continue;
+      base[call.second] = numNodes;
+      numNodes += summaries[call.second].values.size();
+      order.push_back(call.second);
+    }
+  }
+
+  ConstraintGraph graph;
+  graph.reachable = order.size();
+  graph.values.reserve(numNodes);
+  std::vector<std::pair<unsigned, unsigned>> copies, loads, stores;
+  for (unsigned f : order) {
+    const Summary &sum = summaries[f];
+    unsigned b = base[f];
+    graph.funcStart.push_back(b);
+    graph.values.insert(graph.values.end(), sum.values.begin(),
+                        sum.values.end());
+    for (unsigned o : sum.allocs) {
+      graph.allocs.push_back(b + o);
+    }
+    for (auto [src, dst] : sum.copies) {
+      copies.push_back({b + src, b + dst});
+    }
+    for (auto [ptr, dst] : sum.loads) {
+      loads.push_back({b + ptr, b + dst});
+    }
+    for (auto [ptr, src] : sum.stores) {
+      stores.push_back({b + ptr, b + src});
+    }
+    for (auto [c, call] : enumerate(sum.calls)) {
+      auto [node, callee] = call;
+      unsigned calleeBase = base[callee];
+      ArrayRef<unsigned> args(sum.callArgs);
+      args = args.slice(sum.argStart[c], sum.argStart[c + 1] - sum.argStart[c]);
+      for (auto [i, arg] : enumerate(args)) {
+        if (arg != NoNode)
+          copies.push_back({b + arg, calleeBase + (unsigned)i});
+      }
+      for (unsigned ret : summaries[callee].returns) {
+        copies.push_back({calleeBase + ret, b + node});
+      }
+    }
+  }
+  graph.funcStart.push_back(numNodes);
+  toCSR(numNodes, copies, graph.copyStart, graph.copyList);
+  toCSR(numNodes, loads, graph.loadStart, graph.loadList);
+  toCSR(numNodes, stores, graph.storeStart, graph.storeList);
+  return graph;
+}
+
+// Difference propagation over a ConstraintGraph. Load and store constraints
+// add copy edges as the pointer's set grows; those live beside the CSR.
+// An object's node also holds its contents, unless separateContents gives
+// the contents of object o a node of their own, graph.size() + o.
+class CSRSolver {
+public:
+  explicit CSRSolver(const ConstraintGraph &graph,
+                     bool separateContents = false)
+      : graph(graph), contents(separateContents ? graph.size() : 0),
+        pts(graph.size() + contents), done(pts.size()), added(pts.size()),
+        queued(pts.size()) {}
+
+  void solve() {
+    for (unsigned o : graph.allocs) {
+      pts[o].set(o);
+      enqueue(o);
+    }
+    while (!worklist.empty()) {
+      unsigned x = worklist.front();
+      worklist.pop_front();
+      queued[x] = false;
+      SparseBitVector<> delta;
+      delta.intersectWithComplement(pts[x], done[x]);
+      if (delta.empty())
+        continue;
+      done[x] |= delta;
+      if (x < graph.size()) {
+        for (unsigned dst : graph.loads(x)) {
+          for (unsigned o : delta) {
+            addEdge(contents + o, dst);
+          }
+        }
+        for (unsigned src : graph.stores(x)) {
+          for (unsigned o : delta) {
+            addEdge(src, contents + o);
+          }
+        }
+        for (unsigned succ : graph.copies(x)) {
+          if (pts[succ] |= delta)
+            enqueue(succ);
+        }
+      }
+      for (unsigned succ : added[x]) {
+        if (pts[succ] |= delta)
+          enqueue(succ);
+      }
+    }
+  }
+
+  const SparseBitVector<> &pointsTo(unsigned n) const { return pts[n]; }
+
+  void print() const {
+    outs() << "Points-to Set:\n";
+    outs() << "=================\n";
+    for (unsigned n = 0; n < graph.size(); ++n) {
+      if (pts[n].empty())
+        continue;
+      outs() << "\n" << *graph.values[n] << "\n->";
+      for (unsigned o : pts[n]) {
+        outs() << "\t" << *graph.values[o] << "\n";
+      }
+    }
+  }
+
+private:
+  const ConstraintGraph &graph;
+  // Offset from an object to the node of its contents.
+  size_t contents;
+  std::vector<SparseBitVector<>> pts;
+  // Part of pts already propagated.
+  std::vector<SparseBitVector<>> done;
+  std::vector<std::vector<unsigned>> added;
+  DenseSet<std::pair<unsigned, unsigned>> addedSet;
+  std::vector<bool> queued;
+  std::deque<unsigned> worklist;
+
+  void enqueue(unsigned n) {
+    if (!queued[n]) {
+      queued[n] = true;
+      worklist.push_back(n);
+    }
+  }
+
+  void addEdge(unsigned src, unsigned dst) {
+    if (!addedSet.insert({src, dst}).second)
+      return;
+    added[src].push_back(dst);
+    if (pts[dst] |= done[src])
+      enqueue(dst);
+  }
+};
+
+#if defined(PARTITION) || defined(SFS)
+// -DPARTITION runs Steensgaard's unification over the constraint graph
+// first. Its alias classes over-approximate Andersen's sets, and every
+// constraint only relates a class to the class it points to: copies, loads
+// and stores unify pointee classes, and an allocation puts the object into
+// its pointer's pointee class. The classes linked through pointees thus
+// split the constraints into independent partitions, which also hold the
+// edges that loads and stores add while solving. Each partition is solved
+// as its own ConstraintGraph by its own CSRSolver, largest first on NTHREADS
+// workers, so a solver only allocates sets for the nodes of its partition.
+// Partitions without an allocation are skipped; their sets stay empty.
+
+// Union-find with one pointee class per class. Pointees that are not nodes
+// of the graph are placeholders numbered after them.
+class Unification {
+public:
+  explicit Unification(size_t size)
+      : parent(size), rank(size, 0), pointee(size, NoNode) {
+    for (unsigned x = 0; x < size; ++x) {
+      parent[x] = x;
+    }
+  }
+
+  size_t size() const { return parent.size(); }
+
+  unsigned find(unsigned x) {
+    while (parent[x] != x) {
+      parent[x] = parent[parent[x]];
+      x = parent[x];
+    }
+    return x;
+  }
+
+  // Pointee class of x, or NoNode.
+  unsigned pointeeOf(unsigned x) { return pointee[find(x)]; }
+
+  // Pointee class of x, created if x has none yet.
+  unsigned deref(unsigned x) {
+    x = find(x);
+    if (pointee[x] == NoNode) {
+      pointee[x] = parent.size();
+      parent.push_back(parent.size());
+      rank.push_back(0);
+      pointee.push_back(NoNode);
+    }
+    return pointee[x];
+  }
+
+  // Joins the classes of a and b, and then their pointees.
+  void join(unsigned a, unsigned b) {
+    pending.push_back({a, b});
+    while (!pending.empty()) {
+      auto [x, y] = pending.back();
+      pending.pop_back();
+      x = find(x);
+      y = find(y);
+      if (x == y)
+        continue;
+      if (rank[x] < rank[y])
+        std::swap(x, y);
+      rank[x] += rank[x] == rank[y];
+      parent[y] = x;
+      if (pointee[x] == NoNode)
+        pointee[x] = pointee[y];
+      else if (pointee[y] != NoNode)
+        pending.push_back({pointee[x], pointee[y]});
+    }
+  }
+
+private:
+  std::vector<unsigned> parent, rank, pointee;
+  std::vector<std::pair<unsigned, unsigned>> pending;
+};
+
+// With separateContents, as in CSRSolver, object o is graph.size() + o
+// rather than the node of its alloca, so classes must have room for both.
+void unify(const ConstraintGraph &graph, Unification &classes,
+           bool separateContents = false) {
+  unsigned contents = separateContents ? graph.size() : 0;
+  for (unsigned o : graph.allocs) {
+    classes.join(classes.deref(o), contents + o);
+  }
+  for (unsigned n = 0; n < graph.size(); ++n) {
+    for (unsigned dst : graph.copies(n)) {
+      classes.join(classes.deref(n), classes.deref(dst));
+    }
+    for (unsigned dst : graph.loads(n)) {
+      classes.join(classes.deref(dst), classes.deref(classes.deref(n)));
+    }
+    for (unsigned src : graph.stores(n)) {
+      classes.join(classes.deref(classes.deref(n)), classes.deref(src));
+    }
+  }
+}
+#endif
+
+#ifdef PARTITION
+struct Partitions {
+  // Nodes of each partition, largest partition first.
+  std::vector<std::vector<unsigned>> nodes;
+  // Partition of each node of the graph and its number there, NoNode for
+  // nodes outside all partitions.
+  std::vector<unsigned> of, local;
+  size_t classes = 0;
+};
+
+Partitions partition(const ConstraintGraph &graph) {
+  Unification classes(graph.size());
+  unify(graph, classes);
+
+  // A partition is a class together with the classes it points to.
+  Unification parts(classes.size());
+  Partitions result;
+  for (unsigned x = 0; x < classes.size(); ++x) {
+    unsigned root = classes.find(x);
+    result.classes += root == x;
+    parts.join(x, root);
+    if (classes.pointeeOf(x) != NoNode)
+      parts.join(x, classes.pointeeOf(x));
+  }
+
+  std::vector<unsigned> index(parts.size(), NoNode);
+  for (unsigned o : graph.allocs) {
+    unsigned root = parts.find(o);
+    if (index[root] == NoNode) {
+      index[root] = result.nodes.size();
+      result.nodes.emplace_back();
+    }
+  }
+  for (unsigned n = 0; n < graph.size(); ++n) {
+    unsigned p = index[parts.find(n)];
+    if (p != NoNode)
+      result.nodes[p].push_back(n);
+  }
+  std::sort(result.nodes.begin(), result.nodes.end(),
+            [](const auto &a, const auto &b) { return a.size() > b.size(); });
+  result.of.assign(graph.size(), NoNode);
+  result.local.assign(graph.size(), NoNode);
+  for (auto [p, nodes] : enumerate(result.nodes)) {
+    for (auto [i, n] : enumerate(nodes)) {
+      result.of[n] = p;
+      result.local[n] = i;
+    }
+  }
+  return result;
+}
+
+// The constraints of partition p of graph, over its local numbers.
+ConstraintGraph subgraph(const ConstraintGraph &graph, const Partitions &parts,
+                         unsigned p) {
+  const auto &nodes = parts.nodes[p];
+  ConstraintGraph sub;
+  sub.values.reserve(nodes.size());
+  std::vector<std::pair<unsigned, unsigned>> copies, loads, stores;
+  for (auto [i, n] : enumerate(nodes)) {
+    sub.values.push_back(graph.values[n]);
+    for (unsigned dst : graph.copies(n)) {
+      copies.push_back({(unsigned)i, parts.local[dst]});
+    }
+    for (unsigned dst : graph.loads(n)) {
+      loads.push_back({(unsigned)i, parts.local[dst]});
+    }
+    for (unsigned src : graph.stores(n)) {
+      stores.push_back({(unsigned)i, parts.local[src]});
+    }
+  }
+  for (unsigned o : graph.allocs) {
+    if (parts.of[o] == p)
+      sub.allocs.push_back(parts.local[o]);
+  }
+  toCSR(nodes.size(), copies, sub.copyStart, sub.copyList);
+  toCSR(nodes.size(), loads, sub.loadStart, sub.loadList);
+  toCSR(nodes.size(), stores, sub.storeStart, sub.storeList);
+  return sub;
+}
+
+class PartitionedSolver {
+public:
+  explicit PartitionedSolver(const ConstraintGraph &graph)
+      : graph(graph), parts(partition(graph)), graphs(parts.nodes.size()),
+        solvers(parts.nodes.size()) {}
+
+  size_t numClasses() const { return parts.classes; }
+  size_t numPartitions() const { return parts.nodes.size(); }
+  size_t largest() const {
+    return parts.nodes.empty() ? 0 : parts.nodes[0].size();
+  }
+
+  void solve() {
+    std::atomic<size_t> next(0);
+    runWorkers(parts.nodes.size(), 1, [&] {
+      for (size_t p; (p = next++) < parts.nodes.size();) {
+        graphs[p] = subgraph(graph, parts, p);
+        solvers[p] = std::make_unique<CSRSolver>(graphs[p]);
+        solvers[p]->solve();
+      }
+    });
+  }
+
+  // Points-to set of node n of the graph, as nodes of the graph.
+  void pointsTo(unsigned n, std::vector<unsigned> &result) const {
+    result.clear();
+    unsigned p = parts.of[n];
+    if (p == NoNode)
+      return;
+    for (unsigned o : solvers[p]->pointsTo(parts.local[n])) {
+      result.push_back(parts.nodes[p][o]);
+    }
+  }
+
+  SparseBitVector<> pointsTo(unsigned n) const {
+    SparseBitVector<> result;
+    unsigned p = parts.of[n];
+    if (p == NoNode)
+      return result;
+    for (unsigned o : solvers[p]->pointsTo(parts.local[n])) {
+      result.set(parts.nodes[p][o]);
+    }
+    return result;
+  }
+
+  void print() const {
+    outs() << "Points-to Set:\n";
+    outs() << "=================\n";
+    std::vector<unsigned> points2;
+    for (unsigned n = 0; n < graph.size(); ++n) {
+      pointsTo(n, points2);
+      if (points2.empty())
+        continue;
+      outs() << "\n" << *graph.values[n] << "\n->";
+      for (unsigned o : points2) {
+        outs() << "\t" << *graph.values[o] << "\n";
+      }
+    }
+  }
+
+private:
+  const ConstraintGraph &graph;
+  Partitions parts;
+  std::vector<ConstraintGraph> graphs;
+  std::vector<std::unique_ptr<CSRSolver>> solvers;
+};
+#endif
+
+#ifdef SFS
+// -DSFS runs a staged sparse flow-sensitive analysis (Hardekopf and Lin, CGO
+// 2011). The auxiliary analysis is Steensgaard's unification over the
+// constraint graph (UnificationSolver), which takes near-linear time where an
+// Andersen solve may not finish. With -DANDERSEN_AUX it is the CSR solver
+// instead, or the partitioned one with -DPARTITION. Those keep an object's
+// contents in its node, as above, which the unification keeps apart, so their
+// sets are not always the smaller ones. The auxiliary sets tell which objects a
+// load, a store or a call may touch, which is enough to put the memory of every
+// reachable function in SSA form. Objects that every load and store touches
+// together form a region, one SSA variable: a store defines a new version of
+// each region its pointer may point into, a call one of each region the callee
+// may modify, and phis go to the iterated dominance frontiers of those blocks.
+// Loads, calls and returns use the reaching versions. Calls feed the entry
+// versions of the callee, and the versions reaching its returns flow back into
+// the definitions at the call, context-insensitively.
+//
+// The solver then propagates along these def-use edges only. A version
+// holds a set per object of its region, and a load or a store is evaluated
+// again when the set of its pointer grows. A store whose pointer points to
+// exactly one object replaces the old contents if that object is a
+// singleton, a static alloca in the entry block of a function outside any
+// call-graph cycle; a GEP may be any element of an array and is always
+// updated weakly. Until its pointer points somewhere, a store lets nothing
+// through.
+//
+// Unlike above, an object's node does not stand for its contents here: an
+// alloca points to itself and the versions hold what was stored, so every
+// set is a subset of the auxiliary one. Sizes are also compared against a
+// CSRSolver with separateContents, timed on its own, which models memory
+// the same way, so that the difference comes from flow-sensitivity alone.
+
+// avgpts of solver over the nodes of graph, the arguments and instructions
+// of the reachable functions.
+template <typename Solver>
+double averagePointsTo(const ConstraintGraph &graph, const Solver &solver) {
+  avgpts::Mean mean;
+  for (unsigned n = 0; n < graph.size(); ++n) {
+    mean.add(graph.values[n], solver.pointsTo(n).count());
+  }
+  return mean.get();
+}
+
+// Steensgaard's classes as an auxiliary analysis: a node points to the
+// objects in the pointee class of its class. Objects are kept apart from
+// their alloca's node, as the flow-sensitive solver models them; sharing
+// the node would put an alloca into its own pointee class and fold every
+// class that reaches memory into one.
+class UnificationSolver {
+public:
+  explicit UnificationSolver(const ConstraintGraph &graph)
+      : graph(graph), classes(2 * graph.size()) {}
+
+  void solve() {
+    unify(graph, classes, true);
+    for (unsigned o : graph.allocs) {
+      objects[classes.find(graph.size() + o)].set(o);
+    }
+    pointee.resize(graph.size());
+    for (unsigned n = 0; n < graph.size(); ++n) {
+      unsigned cls = classes.pointeeOf(n);
+      pointee[n] = cls == NoNode ? NoNode : classes.find(cls);
+    }
+  }
+
+  size_t numObjectClasses() const { return objects.size(); }
+
+  const SparseBitVector<> &pointsTo(unsigned n) const {
+    if (pointee[n] == NoNode)
+      return none;
+    auto it = objects.find(pointee[n]);
+    return it == objects.end() ? none : it->second;
+  }
+
+private:
+  const ConstraintGraph &graph;
+  Unification classes;
+  // Objects of each class that has any, by root.
+  DenseMap<unsigned, SparseBitVector<>> objects;
+  // Root of the pointee class of each node, or NoNode.
+  std::vector<unsigned> pointee;
+  SparseBitVector<> none;
+};
+
+template <typename Aux> class FlowSensitiveSolver {
+public:
+  FlowSensitiveSolver(const ConstraintGraph &graph, const Aux &aux)
+      : graph(graph), aux(aux), pts(graph.size()), done(graph.size()) {}
+
+  // Builds the memory SSA of the reachable functions and its def-use edges.
+  void build() {
+    size_t numFuncs = graph.funcStart.size() - 1;
+    funcs.resize(numFuncs);
+    for (unsigned f = 0; f < numFuncs; ++f) {
+      Value *first = graph.values[graph.funcStart[f]];
+      auto *arg = dyn_cast<Argument>(first);
+      funcs[f] =
+          arg ? arg->getParent() : cast<Instruction>(first)->getFunction();
+      funcIndex[funcs[f]] = f;
+    }
+    findRegions();
+    findModRef();
+    findSingletons();
+    for (unsigned f = 0; f < numFuncs; ++f) {
+      rename(f);
+    }
+
+    // Calls into the entry versions of the callee, its returns back into the
+    // definitions at the call.
+    for (auto [callee, region, version] : callUses) {
+      auto it = entries.find({callee, region});
+      if (it != entries.end())
+        copies.push_back({version, it->second});
+    }
+    for (auto [callee, region, version] : callDefs) {
+      auto it = exits.find({callee, region});
+      if (it == exits.end())
+        continue;
+      for (unsigned ret : it->second) {
+        copies.push_back({ret, version});
+      }
+    }
+
+    std::vector<std::pair<unsigned, unsigned>> uses, defs, loadsAt, storesAt;
+    for (auto [s, site] : enumerate(loads)) {
+      loadsAt.push_back({site.ptr, (unsigned)s});
+      for (unsigned k = site.start; k < site.end; ++k) {
+        uses.push_back({muVersion[k], (unsigned)s});
+      }
+    }
+    for (auto [s, site] : enumerate(stores)) {
+      storesAt.push_back({site.ptr, (unsigned)s});
+      if (site.value != site.ptr)
+        storesAt.push_back({site.value, (unsigned)s});
+      for (unsigned k = site.start; k < site.end; ++k) {
+        defs.push_back({chiIn[k], k});
+      }
+    }
+    toCSR(numVersions(), copies, copyStart, copyList);
+    toCSR(numVersions(), uses, useStart, useList);
+    toCSR(numVersions(), defs, defStart, defList);
+    toCSR(graph.size(), loadsAt, loadStart, loadList);
+    toCSR(graph.size(), storesAt, storeStart, storeList);
+    copies.clear();
+    std::vector<std::pair<unsigned, unsigned>> members;
+    for (auto [obj, r] : enumerate(regionOf)) {
+      if (r != NoNode)
+        members.push_back({r, (unsigned)obj});
+    }
+    toCSR(regions, members, memberStart, memberList);
+    queued.assign(graph.size(), false);
+  }
+
+  void solve() {
+    for (auto [obj, o] : enumerate(graph.allocs)) {
+      pts[o].set(obj);
+      enqueue(o);
+    }
+    // Pointer sets first: every object they gain may add to many versions.
+    while (!worklist.empty() || !updates.empty()) {
+      if (worklist.empty()) {
+        auto [version, obj] = updates.front();
+        updates.pop_front();
+        propagate(version, obj);
+        continue;
+      }
+      unsigned x = worklist.front();
+      worklist.pop_front();
+      queued[x] = false;
+      SparseBitVector<> delta;
+      delta.intersectWithComplement(pts[x], done[x]);
+      if (delta.empty())
+        continue;
+      done[x] |= delta;
+      for (unsigned succ : graph.copies(x)) {
+        if (pts[succ] |= delta)
+          enqueue(succ);
+      }
+      for (unsigned s : range(loadStart, loadList, x)) {
+        evaluateLoad(loads[s]);
+      }
+      for (unsigned s : range(storeStart, storeList, x)) {
+        evaluateStore(stores[s], stores[s].ptr == x);
+      }
+    }
+  }
+
+  const SparseBitVector<> &pointsTo(unsigned n) const { return pts[n]; }
+
+  size_t numRegions() const { return regions; }
+  size_t numVersions() const { return versionRegion.size(); }
+  size_t numPhis() const { return phis; }
+  size_t numLoads() const { return loads.size(); }
+  size_t numStores() const { return stores.size(); }
+
+  // Stores that replace the contents of their object.
+  size_t strongUpdates() const {
+    size_t strong = 0;
+    for (const Site &site : stores) {
+      strong += isStrong(pts[site.ptr]);
+    }
+    return strong;
+  }
+
+  void print() const {
+    outs() << "Points-to Set:\n";
+    outs() << "=================\n";
+    for (unsigned n = 0; n < graph.size(); ++n) {
+      if (pts[n].empty())
+        continue;
+      outs() << "\n" << *graph.values[n] << "\n->";
+      for (unsigned obj : pts[n]) {
+        outs() << "\t" << *graph.values[graph.allocs[obj]] << "\n";
+      }
+    }
+  }
+
+private:
+  // A load or a store: the pointer, the loaded or stored node, and its uses
+  // (loads) or definitions (stores) [start, end) of region versions.
+  struct Site {
+    unsigned ptr, value, start, end;
+  };
+
+  const ConstraintGraph &graph;
+  const Aux &aux;
+  std::vector<Function *> funcs;
+  DenseMap<Function *, unsigned> funcIndex;
+  // Objects are numbered in the order of graph.allocs, densely so that sets
+  // of them stay short. Region of each object, NoNode for objects no load or
+  // store touches, and the regions each pointer of a load or a store may
+  // point into.
+  std::vector<unsigned> regionOf;
+  std::vector<SparseBitVector<>> regionsAt;
+  size_t regions = 0;
+  // Objects of each region.
+  std::vector<unsigned> memberStart, memberList;
+  // Per reachable function: the regions it and its callees may store to,
+  // and those they may load from or store to.
+  std::vector<SparseBitVector<>> mod, accessed;
+  std::vector<bool> recursive, singleton;
+
+  std::vector<unsigned> versionRegion;
+  size_t phis = 0;
+  std::vector<Site> loads, stores;
+  // Per use k of a load: the region and the version read.
+  std::vector<unsigned> muRegion, muVersion;
+  // Per definition k of a store: the region, the versions before and after,
+  // and the store.
+  std::vector<unsigned> chiRegion, chiIn, chiOut, chiSite;
+  // {callee, region, version} of the uses and the definitions at calls.
+  std::vector<std::tuple<unsigned, unsigned, unsigned>> callUses, callDefs;
+  // Entry version and versions reaching the returns, by {function, region}.
+  DenseMap<std::pair<unsigned, unsigned>, unsigned> entries;
+  DenseMap<std::pair<unsigned, unsigned>, SmallVector<unsigned, 2>> exits;
+  // {src, dst} versions of phi operands and calls; the CSR after build.
+  std::vector<std::pair<unsigned, unsigned>> copies;
+  std::vector<unsigned> copyStart, copyList;
+  // Loads reading and definitions k carrying over each version, and the
+  // loads and the stores of each node.
+  std::vector<unsigned> useStart, useList, defStart, defList;
+  std::vector<unsigned> loadStart, loadList, storeStart, storeList;
+
+  std::vector<SparseBitVector<>> pts, done;
+  // The set of an object at a version, and what it still has to propagate,
+  // by {version, object}: one map for all versions, as most versions only
+  // ever hold a few objects. updates holds the keys of pending in order.
+  DenseMap<std::pair<unsigned, unsigned>, SparseBitVector<>> contents,
+      pending;
+  std::deque<std::pair<unsigned, unsigned>> updates;
+  std::vector<bool> queued;
+  std::deque<unsigned> worklist;
+
+  static ArrayRef<unsigned> range(const std::vector<unsigned> &start,
+                                  const std::vector<unsigned> &list,
+                                  unsigned n) {
+    return ArrayRef<unsigned>(list).slice(start[n], start[n + 1] - start[n]);
+  }
+
+  void enqueue(unsigned x) {
+    if (!queued[x]) {
+      queued[x] = true;
+      worklist.push_back(x);
+    }
+  }
+
+  unsigned newVersion(unsigned region) {
+    versionRegion.push_back(region);
+    return versionRegion.size() - 1;
+  }
+
+  // Local numbering of func as in summarize.
+  void number(unsigned f, DenseMap<Value *, unsigned> &local) const {
+    local.clear();
+    unsigned n = graph.funcStart[f];
+    for (auto &arg : funcs[f]->args()) {
+      local[&arg] = n++;
+    }
+    for (auto &BB : *funcs[f]) {
+      for (auto &inst : BB) {
+        local[&inst] = n++;
+      }
+    }
+  }
+
+  // {pointer, loaded or stored node} of a load or a store the auxiliary
+  // analysis has a constraint for, {NoNode, NoNode} otherwise.
+  std::pair<unsigned, unsigned>
+  access(Instruction &inst, const DenseMap<Value *, unsigned> &local) const {
+    auto node = [&](Value *val) {
+      auto it = local.find(val);
+      return it == local.end() ? NoNode : it->second;
+    };
+    unsigned ptr = NoNode, value = NoNode;
+    if (auto *load = dyn_cast<LoadInst>(&inst)) {
+      ptr = node(load->getPointerOperand());
+      value = relevant(load) ? node(load) : NoNode;
+    } else if (auto *store = dyn_cast<StoreInst>(&inst)) {
+      ptr = node(store->getPointerOperand());
+      if (relevant(store->getValueOperand()))
+        value = node(store->getValueOperand());
+    }
+    if (ptr == NoNode || value == NoNode)
+      return {NoNode, NoNode};
+    return {ptr, value};
+  }
+
+  unsigned callee(Instruction &inst) const {
+    auto *call = dyn_cast<CallInst>(&inst);
+    if (!call || !call->getCalledFunction())
+      return NoNode;
+    auto it = funcIndex.find(call->getCalledFunction());
+    return it == funcIndex.end() ? NoNode : it->second;
+  }
+
+  // Access equivalence: objects pointed to by the same pointers of loads
+  // and stores share a region. Each object hashes the pointers it is in.
+  void findRegions() {
+    std::vector<unsigned> objectOf(graph.size(), NoNode);
+    for (auto [obj, o] : enumerate(graph.allocs)) {
+      objectOf[o] = obj;
+    }
+    std::vector<uint64_t> signature(graph.allocs.size(), 0);
+    DenseMap<unsigned, SparseBitVector<>> auxPts;
+    std::vector<unsigned> pointers;
+    std::vector<bool> seen(graph.size(), false);
+    DenseMap<Value *, unsigned> local;
+    for (unsigned f = 0; f < funcs.size(); ++f) {
+      number(f, local);
+      for (auto &BB : *funcs[f]) {
+        for (auto &inst : BB) {
+          unsigned ptr = access(inst, local).first;
+          if (ptr == NoNode || seen[ptr])
+            continue;
+          seen[ptr] = true;
+          pointers.push_back(ptr);
+          for (unsigned o : aux.pointsTo(ptr)) {
+            auxPts[ptr].set(objectOf[o]);
+          }
+          for (unsigned obj : auxPts[ptr]) {
+            signature[obj] = hash_combine(signature[obj], ptr);
+          }
+        }
+      }
+    }
+    DenseMap<uint64_t, unsigned> regionIndex;
+    regionOf.assign(graph.allocs.size(), NoNode);
+    regionsAt.resize(graph.size());
+    for (unsigned ptr : pointers) {
+      for (unsigned obj : auxPts[ptr]) {
+        if (regionOf[obj] == NoNode)
+          regionOf[obj] = regionIndex
+                              .try_emplace(signature[obj], regionIndex.size())
+                              .first->second;
+        regionsAt[ptr].set(regionOf[obj]);
+      }
+    }
+    regions = regionIndex.size();
+  }
+
+  // Mod and ref sets over the strongly connected components of the call
+  // graph, callees first (Tarjan). Also marks the recursive functions.
+  void findModRef() {
+    size_t numFuncs = funcs.size();
+    std::vector<std::vector<unsigned>> callees(numFuncs);
+    mod.resize(numFuncs);
+    accessed.resize(numFuncs);
+    recursive.assign(numFuncs, false);
+    DenseMap<Value *, unsigned> local;
+    for (unsigned f = 0; f < numFuncs; ++f) {
+      number(f, local);
+      for (auto &BB : *funcs[f]) {
+        for (auto &inst : BB) {
+          unsigned ptr = access(inst, local).first;
+          if (ptr != NoNode) {
+            if (isa<StoreInst>(inst))
+              mod[f] |= regionsAt[ptr];
+            accessed[f] |= regionsAt[ptr];
+          } else if (unsigned g = callee(inst); g != NoNode) {
+            callees[f].push_back(g);
+            recursive[f] = recursive[f] || g == f;
+          }
+        }
+      }
+    }
+
+    std::vector<unsigned> index(numFuncs, NoNode), low(numFuncs);
+    std::vector<unsigned> component(numFuncs), stack, members;
+    std::vector<bool> onStack(numFuncs, false);
+    std::vector<std::pair<unsigned, unsigned>> frames;
+    unsigned counter = 0, components = 0;
+    auto visit = [&](unsigned f) {
+      index[f] = low[f] = counter++;
+      stack.push_back(f);
+      onStack[f] = true;
+      frames.push_back({f, 0});
+    };
+    for (unsigned root = 0; root < numFuncs; ++root) {
+      if (index[root] != NoNode)
+        continue;
+      visit(root);
+      while (!frames.empty()) {
+        unsigned f = frames.back().first;
+        if (frames.back().second < callees[f].size()) {
+          unsigned g = callees[f][frames.back().second++];
+          if (index[g] == NoNode)
+            visit(g);
+          else if (onStack[g])
+            low[f] = std::min(low[f], index[g]);
+          continue;
+        }
+        frames.pop_back();
+        if (!frames.empty()) {
+          unsigned caller = frames.back().first;
+          low[caller] = std::min(low[caller], low[f]);
+        }
+        if (low[f] != index[f])
+          continue;
+        members.clear();
+        unsigned g;
+        do {
+          g = stack.back();
+          stack.pop_back();
+          onStack[g] = false;
+          component[g] = components;
+          members.push_back(g);
+        } while (g != f);
+        components++;
+        SparseBitVector<> modified, touched;
+        for (unsigned m : members) {
+          modified |= mod[m];
+          touched |= accessed[m];
+          for (unsigned c : callees[m]) {
+            if (component[c] != component[m]) {
+              modified |= mod[c];
+              touched |= accessed[c];
+            }
+          }
+        }
+        for (unsigned m : members) {
+          mod[m] = modified;
+          accessed[m] = touched;
+          recursive[m] = recursive[m] || members.size() > 1;
+        }
+      }
+    }
+  }
+
+  void findSingletons() {
+    singleton.assign(graph.size(), false);
+    for (unsigned f = 0; f < funcs.size(); ++f) {
+      if (recursive[f])
+        continue;
+      // The entry block comes first, after the arguments.
+      unsigned n = graph.funcStart[f] + funcs[f]->arg_size();
+      for (auto &inst : funcs[f]->getEntryBlock()) {
+        auto *alloca = dyn_cast<AllocaInst>(&inst);
+        singleton[n++] = alloca && alloca->isStaticAlloca() &&
+                         !alloca->isArrayAllocation();
+      }
+    }
+  }
+
+  bool isStrong(const SparseBitVector<> &ptrPts) const {
+    return !ptrPts.empty() && ptrPts.find_first() == ptrPts.find_last() &&
+           singleton[graph.allocs[ptrPts.find_first()]];
+  }
+
+  // Whether a store through site keeps what obj held before.
+  bool passes(const Site &site, unsigned obj) const {
+    const SparseBitVector<> &ptrPts = pts[site.ptr];
+    return !ptrPts.empty() && !(ptrPts.test(obj) && isStrong(ptrPts));
+  }
+
+  void add(unsigned version, unsigned obj, const SparseBitVector<> &set) {
+    if (set.empty())
+      return;
+    auto [it, inserted] = pending.try_emplace({version, obj});
+    if (inserted)
+      updates.push_back({version, obj});
+    it->second |= set;
+  }
+
+  void evaluateLoad(const Site &site) {
+    const SparseBitVector<> &ptrPts = pts[site.ptr];
+    bool changed = false;
+    for (unsigned k = site.start; k < site.end; ++k) {
+      for (unsigned o : ptrPts) {
+        if (regionOf[o] != muRegion[k])
+          continue;
+        auto it = contents.find({muVersion[k], o});
+        if (it != contents.end())
+          changed |= pts[site.value] |= it->second;
+      }
+    }
+    if (changed)
+      enqueue(site.value);
+  }
+
+  // Adds the stored set to the objects the pointer points to and, when the
+  // pointer grew, what each object keeps.
+  void evaluateStore(const Site &site, bool ptrGrew) {
+    const SparseBitVector<> &ptrPts = pts[site.ptr];
+    if (ptrPts.empty())
+      return;
+    for (unsigned k = site.start; k < site.end; ++k) {
+      for (unsigned o : ptrPts) {
+        if (regionOf[o] == chiRegion[k])
+          add(chiOut[k], o, pts[site.value]);
+      }
+      if (!ptrGrew)
+        continue;
+      for (unsigned o : range(memberStart, memberList, chiRegion[k])) {
+        auto it = contents.find({chiIn[k], o});
+        if (it != contents.end() && passes(site, o))
+          add(chiOut[k], o, it->second);
+      }
+    }
+  }
+
+  // Keeps the part of the pending set of obj that is new to version, then
+  // passes it on along the copies, to the loads whose pointer points to obj
+  // and through the stores that let it through.
+  void propagate(unsigned version, unsigned obj) {
+    auto it = pending.find({version, obj});
+    SparseBitVector<> delta = std::move(it->second);
+    pending.erase(it);
+    SparseBitVector<> &held = contents[{version, obj}];
+    delta.intersectWithComplement(held);
+    if (delta.empty())
+      return;
+    held |= delta;
+    for (unsigned succ : range(copyStart, copyList, version)) {
+      add(succ, obj, delta);
+    }
+    for (unsigned s : range(useStart, useList, version)) {
+      const Site &site = loads[s];
+      if (pts[site.ptr].test(obj) && (pts[site.value] |= delta))
+        enqueue(site.value);
+    }
+    for (unsigned k : range(defStart, defList, version)) {
+      if (passes(stores[chiSite[k]], obj))
+        add(chiOut[k], obj, delta);
+    }
+  }
+
+  // Memory SSA of function f: phis at the iterated dominance frontiers of
+  // the definitions of each region, then versions renamed along the
+  // dominator tree. Entry versions are made on the first use that needs
+  // one. Blocks unreachable from the entry are left out, and so are
+  // functions that touch no region.
+  void rename(unsigned f) {
+    if (accessed[f].empty())
+      return;
+    Function &func = *funcs[f];
+    DenseMap<Value *, unsigned> local;
+    number(f, local);
+    DominatorTree DT(func);
+
+    DenseMap<unsigned, SmallPtrSet<BasicBlock *, 8>> defBlocks;
+    for (auto &BB : func) {
+      if (!DT.isReachableFromEntry(&BB))
+        continue;
+      for (auto &inst : BB) {
+        unsigned ptr = access(inst, local).first;
+        unsigned g = ptr == NoNode ? callee(inst) : NoNode;
+        if (ptr != NoNode && isa<StoreInst>(inst)) {
+          for (unsigned r : regionsAt[ptr]) {
+            defBlocks[r].insert(&BB);
+          }
+        } else if (g != NoNode) {
+          for (unsigned r : mod[g]) {
+            defBlocks[r].insert(&BB);
+          }
+        }
+      }
+    }
+    DenseMap<BasicBlock *, SmallVector<std::pair<unsigned, unsigned>, 4>>
+        phisAt;
+    ForwardIDFCalculator IDF(DT);
+    SmallVector<BasicBlock *, 16> frontier;
+    for (auto &[r, blocks] : defBlocks) {
+      IDF.setDefiningBlocks(blocks);
+      frontier.clear();
+      IDF.calculate(frontier);
+      for (BasicBlock *BB : frontier) {
+        phisAt[BB].push_back({r, newVersion(r)});
+        phis++;
+      }
+    }
+
+    // Reaching version of each region, and the regions each block defined.
+    DenseMap<unsigned, SmallVector<unsigned, 4>> reaching;
+    std::vector<unsigned> pushed;
+    auto current = [&](unsigned r) {
+      auto &versions = reaching[r];
+      if (versions.empty()) {
+        unsigned entry = newVersion(r);
+        entries[{f, r}] = entry;
+        versions.push_back(entry);
+      }
+      return versions.back();
+    };
+    auto define = [&](unsigned r, unsigned version) {
+      reaching[r].push_back(version);
+      pushed.push_back(r);
+    };
+
+    // {dominator tree node, next child, size of pushed on entry}.
+    std::vector<std::tuple<DomTreeNode *, unsigned, size_t>> frames;
+    auto enter = [&](DomTreeNode *node) {
+      frames.push_back({node, 0, pushed.size()});
+      BasicBlock *BB = node->getBlock();
+      auto phiIt = phisAt.find(BB);
+      if (phiIt != phisAt.end()) {
+        for (auto [r, version] : phiIt->second) {
+          define(r, version);
+        }
+      }
+      for (auto &inst : *BB) {
+        auto [ptr, value] = access(inst, local);
+        if (ptr != NoNode && regionsAt[ptr].empty())
+          continue;
+        if (ptr != NoNode && isa<LoadInst>(inst)) {
+          unsigned start = muRegion.size();
+          for (unsigned r : regionsAt[ptr]) {
+            muRegion.push_back(r);
+            muVersion.push_back(current(r));
+          }
+          loads.push_back({ptr, value, start, (unsigned)muRegion.size()});
+        } else if (ptr != NoNode) {
+          unsigned start = chiRegion.size();
+          for (unsigned r : regionsAt[ptr]) {
+            chiRegion.push_back(r);
+            chiIn.push_back(current(r));
+            chiOut.push_back(newVersion(r));
+            chiSite.push_back(stores.size());
+            define(r, chiOut.back());
+          }
+          stores.push_back({ptr, value, start, (unsigned)chiRegion.size()});
+        } else if (unsigned g = callee(inst); g != NoNode) {
+          for (unsigned r : accessed[g]) {
+            callUses.push_back({g, r, current(r)});
+          }
+          for (unsigned r : mod[g]) {
+            unsigned version = newVersion(r);
+            callDefs.push_back({g, r, version});
+            define(r, version);
+          }
+        } else if (isa<ReturnInst>(inst)) {
+          for (unsigned r : mod[f]) {
+            exits[{f, r}].push_back(current(r));
+          }
+        }
+      }
+      for (BasicBlock *succ : successors(BB)) {
+        auto it = phisAt.find(succ);
+        if (it == phisAt.end())
+          continue;
+        for (auto [r, version] : it->second) {
+          copies.push_back({current(r), version});
+        }
+      }
+    };
+
+    enter(DT.getRootNode());
+    while (!frames.empty()) {
+      auto &[node, child, mark] = frames.back();
+      if (child < node->getNumChildren()) {
+        DomTreeNode *next = node->begin()[child++];
+        enter(next);
+        continue;
+      }
+      for (size_t i = pushed.size(); i > mark; --i) {
+        reaching[pushed[i - 1]].pop_back();
+      }
+      pushed.resize(mark);
+      frames.pop_back();
+    }
+  }
+};
+#endif
+#endif
+
 int main(int argc, char *argv[]) {
   InitLLVM X(argc, argv);
   if (argc < 2) {
@@ -216,8 +1828,134 @@ int main(int argc, char *argv[]) {
 
   outs() << "Inter-Procedural Analysis" << "\n";
   errs() << module->getFunctionList().size() << " function(s)\n";
+#ifdef PTR_FILTER
+  auto filterStart = std::chrono::high_resolution_clock::now();
+  pointerFilter = ptrfilter::Filter(*module);
+  errs() << "Filter time: "
+         << std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - filterStart)
+                .count()
+         << " us\n";
+#endif
+#ifdef CSR_GRAPH
+  auto elapsed = [](auto from, auto to) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from)
+        .count();
+  };
+  auto start = std::chrono::high_resolution_clock::now();
+  std::vector<Function *> funcs;
+  std::vector<Summary> summaries = extractConstraints(*module, funcs);
+  auto extracted = std::chrono::high_resolution_clock::now();
+  unsigned mainIndex = find(funcs, mainFunc) - funcs.begin();
+  ConstraintGraph graph = assemble(summaries, mainIndex);
+  summaries.clear();
+  auto assembled = std::chrono::high_resolution_clock::now();
+  errs() << graph.reachable << " reachable function(s), " << graph.size()
+         << " nodes, " << graph.numEdges() << " constraints\n";
+#if defined(SFS) && !defined(ANDERSEN_AUX)
+  // Only the auxiliary analysis of the flow-sensitive run below.
+  auto partitioned = assembled;
+  UnificationSolver solver(graph);
+#elif defined(PARTITION)
+  PartitionedSolver solver(graph);
+  auto partitioned = std::chrono::high_resolution_clock::now();
+  errs() << solver.numClasses() << " alias classes, "
+         << solver.numPartitions() << " partition(s), largest "
+         << solver.largest() << " nodes\n";
+  errs() << "Partition time: " << elapsed(assembled, partitioned) << " us\n";
+#else
+  auto partitioned = assembled;
+  CSRSolver solver(graph);
+#endif
+  errs() << "Solving...\n";
+  solver.solve();
+  auto end = std::chrono::high_resolution_clock::now();
+  errs() << "Extraction time: " << elapsed(start, extracted) << " us\n";
+  errs() << "Assembly time: " << elapsed(extracted, assembled) << " us\n";
+  errs() << "Solve time: " << elapsed(partitioned, end) << " us\n";
+#ifdef SFS
+  FlowSensitiveSolver sfs(graph, solver);
+  sfs.build();
+  auto built = std::chrono::high_resolution_clock::now();
+  errs() << sfs.numRegions() << " memory regions, " << sfs.numVersions()
+         << " versions (" << sfs.numPhis() << " phis), " << sfs.numLoads()
+         << " loads, " << sfs.numStores() << " stores\n";
+  errs() << "Flow-sensitive solving...\n";
+  sfs.solve();
+  auto sfsEnd = std::chrono::high_resolution_clock::now();
+  errs() << "Memory SSA time: " << elapsed(end, built) << " us\n";
+  errs() << "Flow-sensitive solve time: " << elapsed(built, sfsEnd) << " us\n";
+  errs() << "Strong updates: " << sfs.strongUpdates() << " of "
+         << sfs.numStores() << " stores\n";
+  CSRSolver baseline(graph, true);
+  baseline.solve();
+  auto baselineEnd = std::chrono::high_resolution_clock::now();
+  errs() << "Flow-insensitive solve time: " << elapsed(sfsEnd, baselineEnd)
+         << " us\n";
+  errs() << "Average points-to set size: "
+         << format("%.2f", averagePointsTo(graph, solver)) << " auxiliary, "
+         << format("%.2f", averagePointsTo(graph, baseline))
+         << " flow-insensitive, " << format("%.2f", averagePointsTo(graph, sfs))
+         << " flow-sensitive\n";
+#endif
+#ifdef PRINT_RESULTS
+#ifdef SFS
+  sfs.print();
+#else
+  solver.print();
+#endif
+#endif
+#else
   addReachable(mainFunc);
+#ifdef DEMAND
+  // Queries every load and store pointer of the reachable functions.
+  auto start = std::chrono::high_resolution_clock::now();
+  DemandPointsTo demand(*module);
+  std::set<Value *> result;
+  for (auto &func : *module) {
+    if (!RM.count(&func))
+      continue;
+    for (auto &BB : func) {
+      for (auto &inst : BB) {
+        Value *ptr = nullptr;
+        if (auto *load = dyn_cast<LoadInst>(&inst)) {
+          ptr = load->getPointerOperand();
+        } else if (auto *store = dyn_cast<StoreInst>(&inst)) {
+          ptr = store->getPointerOperand();
+        }
+        if (!ptr)
+          continue;
+        bool precise = demand.pointsTo(ptr, result);
+#ifdef PRINT_RESULTS
+        outs() << "\n" << *ptr << "\n->" << (precise ? "" : "\t(fallback)\n");
+        for (Value *v : result) {
+          outs() << "\t" << *v << "\n";
+        }
+#else
+        (void)precise;
+#endif
+      }
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  errs() << demand.queries << " queries, " << demand.precise << " precise, "
+         << demand.fallbacks << " over budget, " << demand.cacheHits
+         << " cache hits\n";
+  errs() << demand.demanded() << " nodes demanded, " << demand.steps
+         << " steps\n";
+  errs() << "Query time: "
+         << std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+                .count()
+         << " us\n";
+#else
   errs() << "Solving...\n";
   solve();
   // print();
-}
\ No newline at end of file
+#endif
+#endif
+#ifdef PTR_FILTER
+  tally.flush();
+  ptrfilter::report(errs());
+#endif
+  return 0;
+}
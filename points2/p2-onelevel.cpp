@@ -0,0 +1,362 @@
+// One-level flow points-to analysis (Das, PLDI 2000), between Steensgaard
+// (p2-steensgaard.cpp) and Andersen (p2-inter-dense.cpp) in cost and
+// precision. The input handling is p2-inter-dense.cpp's: whole program from
+// main, allocas and GEPs are their own objects, and phis, selects, casts,
+// arguments and returns copy.
+//
+// Top-level values keep directional inclusion edges, as in Andersen, but
+// their sets hold classes of objects instead of objects. Below the top
+// level everything is unified, as in Steensgaard: each class has a single
+// pointee class holding what its objects contain. A store *x = y joins the
+// pointee class of every class in pts(x) with every class in pts(y), and a
+// load y = *x adds those pointee classes to pts(y). The sets of a value are
+// read through find, so later joins widen them without re-propagation.
+//
+// As in the other two engines, an object's node also stands for what it
+// holds: p2-inter-dense.cpp adds stored sets to the object's own set and
+// p2-steensgaard.cpp makes an alloca point to itself. Here the class of an
+// object is its own pointee class, so the result covers Andersen's.
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SparseBitVector.h"
+#include "llvm/IR/Argument.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Value.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <chrono>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../common/avgpts.h"
+
+using namespace llvm;
+
+constexpr unsigned NoClass = ~0u;
+
+// Union-find over objects, with one pointee class per class. Every node has
+// a class slot, so an object's class starts as its node number; pointees of
+// classes without an object are placeholders numbered after the nodes.
+class Classes {
+public:
+  unsigned add() {
+    parent.push_back(parent.size());
+    rank.push_back(0);
+    pointee.push_back(NoClass);
+    return parent.size() - 1;
+  }
+
+  size_t size() const { return parent.size(); }
+
+  unsigned find(unsigned x) {
+    while (parent[x] != x) {
+      parent[x] = parent[parent[x]];
+      x = parent[x];
+    }
+    return x;
+  }
+
+  void pointToSelf(unsigned x) { pointee[x] = x; }
+
+  // Pointee class of x, created if x has none yet.
+  unsigned deref(unsigned x) {
+    x = find(x);
+    if (pointee[x] == NoClass) {
+      unsigned p = add();
+      pointee[x] = p;
+    }
+    return pointee[x];
+  }
+
+  // Joins the classes of a and b, and then their pointees.
+  void join(unsigned a, unsigned b) {
+    pending.push_back({a, b});
+    while (!pending.empty()) {
+      auto [x, y] = pending.back();
+      pending.pop_back();
+      x = find(x);
+      y = find(y);
+      if (x == y)
+        continue;
+      if (rank[x] < rank[y])
+        std::swap(x, y);
+      rank[x] += rank[x] == rank[y];
+      parent[y] = x;
+      joins++;
+      if (pointee[x] == NoClass)
+        pointee[x] = pointee[y];
+      else if (pointee[y] != NoClass)
+        pending.push_back({pointee[x], pointee[y]});
+    }
+  }
+
+  size_t joins = 0;
+
+private:
+  std::vector<unsigned> parent, rank, pointee;
+  std::vector<std::pair<unsigned, unsigned>> pending;
+};
+
+DenseMap<Value *, unsigned> ids;
+std::vector<Value *> values;
+// Per node: copy targets, loads through it and values stored through it.
+std::vector<std::vector<unsigned>> copies, loads, stores;
+// Per node: the pointers it is stored through.
+std::vector<std::vector<unsigned>> storedAt;
+// Classes each node points to, and what it still has to propagate.
+std::vector<SparseBitVector<>> pts, added;
+std::vector<bool> queued;
+std::vector<unsigned> worklist;
+Classes classes;
+std::unordered_set<Function *> RM;
+
+unsigned node(Value *val) {
+  auto [it, inserted] = ids.try_emplace(val, values.size());
+  if (inserted) {
+    values.push_back(val);
+    copies.emplace_back();
+    loads.emplace_back();
+    stores.emplace_back();
+    storedAt.emplace_back();
+    pts.emplace_back();
+    added.emplace_back();
+    queued.push_back(false);
+    classes.add();
+  }
+  return it->second;
+}
+
+void push(unsigned n, unsigned cls) {
+  if (!added[n].test_and_set(cls))
+    return;
+  if (!queued[n]) {
+    queued[n] = true;
+    worklist.push_back(n);
+  }
+}
+
+void addCopy(Value *s, Value *t) {
+  unsigned src = node(s), dst = node(t);
+  copies[src].push_back(dst);
+}
+
+void addReachable(Function *func);
+void initialize(Function &func) {
+  for (auto &BB : func) {
+    for (auto &inst : BB) {
+
+      if (isa<AllocaInst>(inst) || isa<GetElementPtrInst>(inst)) {
+        unsigned obj = node(&inst);
+        classes.pointToSelf(obj);
+        push(obj, obj);
+
+      } else if (auto *phi = dyn_cast<PHINode>(&inst)) {
+        for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
+          Value *val = phi->getIncomingValue(i);
+          if (isa<Instruction>(val) || isa<Argument>(val)) {
+            addCopy(val, phi);
+          }
+        }
+
+      } else if (auto *select = dyn_cast<SelectInst>(&inst)) {
+        Value *tval = select->getTrueValue();
+        Value *fval = select->getFalseValue();
+        if (isa<Instruction>(tval) || isa<Argument>(tval)) {
+          addCopy(tval, select);
+        }
+        if (isa<Instruction>(fval) || isa<Argument>(fval)) {
+          addCopy(fval, select);
+        }
+
+      } else if (auto *cast = dyn_cast<CastInst>(&inst)) {
+        addCopy(cast->getOperand(0), cast);
+
+      } else if (auto *load = dyn_cast<LoadInst>(&inst)) {
+        // y = *x
+        unsigned x = node(load->getPointerOperand());
+        unsigned y = node(load);
+        loads[x].push_back(y);
+
+      } else if (auto *store = dyn_cast<StoreInst>(&inst)) {
+        // *x = y
+        Value *val = store->getValueOperand();
+        if (!isa<Instruction>(val) && !isa<Argument>(val))
+          continue;
+        unsigned x = node(store->getPointerOperand());
+        unsigned y = node(val);
+        stores[x].push_back(y);
+        storedAt[y].push_back(x);
+
+      } else if (auto *call = dyn_cast<CallInst>(&inst)) {
+        auto *cf = call->getCalledFunction();
+        if (!cf || cf->isDeclaration())
+          continue;
+        for (int i = 0; i < call->arg_size(); ++i) {
+          if (i < cf->arg_size()) {
+            addCopy(call->getArgOperand(i), cf->getArg(i));
+          }
+        }
+        if (!cf->getReturnType()->isVoidTy()) {
+          for (auto &cfBB : *cf) {
+            if (auto *ret = dyn_cast<ReturnInst>(cfBB.getTerminator())) {
+              if (Value *retVal = ret->getReturnValue())
+                addCopy(retVal, call);
+            }
+          }
+        }
+        addReachable(cf);
+      }
+    }
+  }
+}
+
+void addReachable(Function *func) {
+  if (!RM.insert(func).second)
+    return;
+  initialize(*func);
+}
+
+void solve() {
+  SparseBitVector<> delta;
+  while (!worklist.empty()) {
+    unsigned n = worklist.back();
+    worklist.pop_back();
+    queued[n] = false;
+    delta.clear();
+    std::swap(delta, added[n]);
+    delta.intersectWithComplement(pts[n]);
+    if (delta.empty())
+      continue;
+    pts[n] |= delta;
+
+    for (unsigned dst : copies[n]) {
+      for (unsigned cls : delta) {
+        push(dst, cls);
+      }
+    }
+    for (unsigned y : loads[n]) {
+      for (unsigned cls : delta) {
+        push(y, classes.deref(cls));
+      }
+    }
+    for (unsigned y : stores[n]) {
+      for (unsigned cls : delta) {
+        for (unsigned target : pts[y]) {
+          classes.join(classes.deref(cls), target);
+        }
+      }
+    }
+    for (unsigned x : storedAt[n]) {
+      for (unsigned cls : pts[x]) {
+        for (unsigned target : delta) {
+          classes.join(classes.deref(cls), target);
+        }
+      }
+    }
+  }
+}
+
+// Objects in each class, by class root.
+std::vector<std::vector<unsigned>> members() {
+  std::vector<std::vector<unsigned>> objects(classes.size());
+  for (unsigned n = 0; n < values.size(); ++n) {
+    if (avgpts::isObject(values[n]))
+      objects[classes.find(n)].push_back(n);
+  }
+  return objects;
+}
+
+// Objects n points to.
+std::set<Value *> pointsTo(unsigned n,
+                           const std::vector<std::vector<unsigned>> &objects) {
+  std::set<Value *> result;
+  for (unsigned cls : pts[n]) {
+    for (unsigned obj : objects[classes.find(cls)]) {
+      result.insert(values[obj]);
+    }
+  }
+  return result;
+}
+
+// avgpts over the reachable functions.
+double averagePointsTo() {
+  auto objects = members();
+  avgpts::Mean mean;
+  for (Function *func : RM) {
+    mean.add(*func, [&](Value *val) {
+      auto it = ids.find(val);
+      return it == ids.end() ? 0 : pointsTo(it->second, objects).size();
+    });
+  }
+  return mean.get();
+}
+
+void print() {
+  auto objects = members();
+  outs() << "Points-to Set:\n";
+  outs() << "=================\n";
+  for (unsigned n = 0; n < values.size(); ++n) {
+    if (pts[n].empty())
+      continue;
+    outs() << "\n" << *values[n] << "\n->";
+    for (Value *v : pointsTo(n, objects)) {
+      outs() << "\t" << *v << "\n";
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  InitLLVM X(argc, argv);
+  if (argc < 2) {
+    outs() << "Expect IR filename\n";
+    exit(1);
+  }
+  LLVMContext context;
+  SMDiagnostic smd;
+  char *filename = argv[1];
+  std::unique_ptr<Module> module = parseIRFile(filename, smd, context);
+  if (!module) {
+    outs() << "Cannot parse IR file\n";
+    smd.print(filename, outs());
+    exit(1);
+  }
+
+  Function *mainFunc = module->getFunction("main");
+  if (!mainFunc) {
+    outs() << "Cannot find main function.\n";
+    return 0;
+  }
+
+  outs() << "One-Level Flow Analysis" << "\n";
+  outs() << module->getFunctionList().size() << " function(s)\n";
+  auto start = std::chrono::high_resolution_clock::now();
+
+  addReachable(mainFunc);
+  auto checkpoint = std::chrono::high_resolution_clock::now();
+
+  solve();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  auto duration =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+  outs() << "Analysis time: " << duration.count() << " us\n";
+  duration =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - checkpoint);
+  outs() << "Solve time: " << duration.count() << " us\n";
+  outs() << values.size() << " nodes, " << classes.joins << " joins\n";
+  outs() << "Average points-to set size: "
+         << format("%.2f", averagePointsTo()) << "\n";
+
+#ifdef PRINT_RESULTS
+  print();
+#endif
+  return 0;
+}
@@ -1,25 +1,335 @@
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/IR/Argument.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSlotTracker.h"
 #include "llvm/IR/Value.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <atomic>
+#include <memory>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include <chrono>
 
+#include <sys/resource.h>
+
+#include "../common/avgpts.h"
+#include "../common/emit.h"
+#include "../common/ptrfilter.h"
+#include "../common/snapshot.h"
+
+#ifndef NTHREADS
+#define NTHREADS 16
+#endif
+
 using namespace llvm;
 
 std::unordered_map<Value *, Value *> ds_parent;
 std::unordered_map<Value *, int> ds_rank;
 std::unordered_map<Value *, Value *> points2;
 
+// -DPTR_FILTER skips the unions of values that cannot hold an address
+// (ptrfilter.h), so integer and floating-point values get no set at all.
+#ifdef PTR_FILTER
+ptrfilter::Filter pointerFilter;
+ptrfilter::Tally tally;
+
+bool keepUnion(Value *p, Value *q) { return tally(pointerFilter.keep(p, q)); }
+#else
+bool keepUnion(Value *, Value *) { return true; }
+#endif
+
+// -DSTREAMING materializes one function at a time from lazily loaded
+// bitcode, runs it through steensgaard() and frees its body before the
+// next. Textual IR cannot be loaded lazily; it is parsed whole and only
+// freed as it goes. The state is keyed by dense IDs: arguments, globals and
+// constants outlive the bodies and keep theirs in moduleIds, while
+// instructions are mapped only while their function is streamed. A call
+// joins the returned values of a callee streamed before it; calls to later
+// callees wait in pendingCalls until the callee's returns are known.
+// Without PRINT_RESULTS, finishFunction compacts the tables to one slot
+// per class whenever they have doubled, so memory follows the number of
+// classes rather than the values ever touched. PRINT_RESULTS keeps a slot
+// per member to list them and prints the --emit=text layout, with
+// instructions labelled while their body is alive and the rest (whose
+// argument names only load with the body) at the end.
+#ifdef STREAMING
+#if defined(PTR_FILTER) || defined(PARALLEL)
+#error "-DSTREAMING does not combine with -DPTR_FILTER or -DPARALLEL"
+#endif
+constexpr uint32_t NoID = ~0u;
+
+DenseMap<Value *, uint32_t> moduleIds, localIds;
+std::vector<uint32_t> parentIds, pointeeIds;
+std::vector<uint8_t> ranks;
+// Touched: a rule mentioned the ID, as the keys of ds_parent in the
+// sequential run.
+enum : uint8_t { Touched = 1 };
+std::vector<uint8_t> flags;
+// Kept at roots, like pointeeIds: the allocas and GEPs of a class and its
+// values in the domain of avgpts.
+std::vector<uint32_t> objects, pointers;
+// The values avgpts counts, taken as bodies are freed; their sizes are
+// only known at the end.
+avgpts::Mean domain;
+size_t peakIds = 0;
+DenseMap<Function *, std::vector<uint32_t>> returnIds, pendingCalls;
+DenseSet<Function *> streamed;
+#ifdef PRINT_RESULTS
+std::unique_ptr<ModuleSlotTracker> slots;
+std::vector<std::string> labels;
+
+// The name emit::Writer gives val in --emit=text.
+std::string label(Value *val) {
+  std::string text;
+  raw_string_ostream out(text);
+  if (auto *arg = dyn_cast<Argument>(val)) {
+    // Bodies are freed by now; unnamed arguments come first in the
+    // numbering of their function.
+    Function *func = arg->getParent();
+    func->printAsOperand(out, false, *slots);
+    out << ":%";
+    if (arg->hasName()) {
+      out << arg->getName();
+    } else {
+      unsigned slot = 0;
+      for (auto &prev : func->args()) {
+        if (&prev == arg)
+          break;
+        slot += !prev.hasName();
+      }
+      out << slot;
+    }
+    return out.str();
+  }
+  if (auto *inst = dyn_cast<Instruction>(val)) {
+    inst->getFunction()->printAsOperand(out, false, *slots);
+    out << ":";
+  }
+  val->printAsOperand(out, false, *slots);
+  return out.str();
+}
+#endif
+
+uint32_t idOf(Value *val) {
+  auto &ids = isa<Instruction>(val) ? localIds : moduleIds;
+  auto [it, inserted] = ids.try_emplace(val, parentIds.size());
+  if (inserted) {
+    parentIds.push_back(it->second);
+    pointeeIds.push_back(NoID);
+    ranks.push_back(0);
+    flags.push_back(0);
+    objects.push_back(0);
+    pointers.push_back(avgpts::counted(val));
+#ifdef PRINT_RESULTS
+    labels.push_back(isa<Instruction>(val) ? label(val) : "");
+#endif
+    peakIds = std::max(peakIds, parentIds.size());
+  }
+  return it->second;
+}
+
+uint32_t findID(uint32_t x) {
+  while (parentIds[x] != x) {
+    parentIds[x] = parentIds[parentIds[x]];
+    x = parentIds[x];
+  }
+  return x;
+}
+
+void joinPointeeIDs(uint32_t ptr, uint32_t val);
+
+void uniteIDs(uint32_t a, uint32_t b) {
+  flags[a] |= Touched;
+  flags[b] |= Touched;
+  a = findID(a);
+  b = findID(b);
+  if (a == b)
+    return;
+  if (ranks[a] < ranks[b])
+    std::swap(a, b);
+  ranks[a] += ranks[a] == ranks[b];
+  parentIds[b] = a;
+  objects[a] += objects[b];
+  pointers[a] += pointers[b];
+  uint32_t pointee = pointeeIds[b];
+  if (pointee != NoID) {
+    pointeeIds[b] = NoID;
+    joinPointeeIDs(a, pointee);
+  }
+}
+
+void joinPointeeIDs(uint32_t ptr, uint32_t val) {
+  flags[ptr] |= Touched;
+  flags[val] |= Touched;
+  ptr = findID(ptr);
+  if (pointeeIds[ptr] == NoID)
+    pointeeIds[ptr] = val;
+  else
+    uniteIDs(pointeeIds[ptr], val);
+}
+
+void unionDS(Value *p, Value *q) { uniteIDs(idOf(p), idOf(q)); }
+
+void joinPointee(Value *q, Value *x) { joinPointeeIDs(idOf(q), idOf(x)); }
+
+void pointToSelf(Value *ac) {
+  uint32_t id = idOf(ac);
+  ++objects[findID(id)];
+  joinPointeeIDs(id, id);
+}
+
+// Bodies streamed so far are freed, which makes their functions look like
+// declarations.
+bool isDefined(Function *func) {
+  return !func->isDeclaration() || streamed.count(func);
+}
+
+void unionReturns(Function *cf, CallInst *call) {
+  uint32_t id = idOf(call);
+  if (!streamed.count(cf)) {
+    pendingCalls[cf].push_back(id);
+    return;
+  }
+  for (uint32_t ret : returnIds[cf]) {
+    uniteIDs(ret, id);
+  }
+}
+
+void recordReturn(ReturnInst *ret) {
+  if (Value *retVal = ret->getReturnValue())
+    returnIds[ret->getFunction()].push_back(idOf(retVal));
+}
+
+#ifndef PRINT_RESULTS
+size_t compactedIds = 0;
+
+void remapIDs(std::vector<uint32_t> &ids,
+              const std::vector<uint32_t> &newIds) {
+  for (uint32_t &id : ids) {
+    id = newIds[id];
+  }
+  llvm::sort(ids);
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+// Renumbers the roots densely and drops every other slot. Once a body is
+// freed nothing names its instructions, and the module values, returns and
+// pending calls that still hold IDs only need their class.
+void compact() {
+  size_t size = parentIds.size();
+  std::vector<uint32_t> newIds(size);
+  uint32_t next = 0;
+  for (uint32_t id = 0; id < size; ++id) {
+    if (parentIds[id] == id)
+      newIds[id] = next++;
+  }
+  for (uint32_t id = 0; id < size; ++id) {
+    newIds[id] = newIds[findID(id)];
+  }
+  // A root only moves down, onto a slot already read.
+  for (uint32_t id = 0; id < size; ++id) {
+    if (parentIds[id] != id)
+      continue;
+    uint32_t to = newIds[id];
+    parentIds[to] = to;
+    pointeeIds[to] = pointeeIds[id] == NoID ? NoID : newIds[pointeeIds[id]];
+    ranks[to] = ranks[id];
+    flags[to] = flags[id];
+    objects[to] = objects[id];
+    pointers[to] = pointers[id];
+  }
+  parentIds.resize(next);
+  pointeeIds.resize(next);
+  ranks.resize(next);
+  flags.resize(next);
+  objects.resize(next);
+  pointers.resize(next);
+  for (auto &entry : moduleIds) {
+    entry.second = newIds[entry.second];
+  }
+  for (auto &entry : returnIds) {
+    remapIDs(entry.second, newIds);
+  }
+  for (auto &entry : pendingCalls) {
+    remapIDs(entry.second, newIds);
+  }
+  compactedIds = next;
+}
+#endif
+
+// After the last instruction of func: joins the calls that came before its
+// returns and frees the body.
+void finishFunction(Function &func) {
+  auto pending = pendingCalls.find(&func);
+  if (pending != pendingCalls.end()) {
+    for (uint32_t call : pending->second) {
+      for (uint32_t ret : returnIds[&func]) {
+        uniteIDs(ret, call);
+      }
+    }
+    pendingCalls.erase(pending);
+  }
+  streamed.insert(&func);
+  domain.add(func, [](Value *) { return 0; });
+  localIds.clear();
+  func.deleteBody();
+#ifndef PRINT_RESULTS
+  if (parentIds.size() > 2 * compactedIds)
+    compact();
+#endif
+}
+
+// avgpts over the streamed functions, whose values are counted in domain.
+double averagePointsTo(Module &) {
+  avgpts::Mean mean = domain;
+  for (uint32_t id = 0; id < parentIds.size(); ++id) {
+    if (parentIds[id] == id && pointeeIds[id] != NoID)
+      mean.total += (size_t)pointers[id] * objects[findID(pointeeIds[id])];
+  }
+  return mean.get();
+}
+
+#ifdef PRINT_RESULTS
+void printGroups(raw_ostream &os) {
+  for (auto [val, id] : moduleIds) {
+    labels[id] = label(val);
+  }
+  std::vector<std::vector<uint32_t>> groups(parentIds.size());
+  for (uint32_t id = 0; id < parentIds.size(); ++id) {
+    if (flags[id] & Touched)
+      groups[findID(id)].push_back(id);
+  }
+  for (uint32_t root = 0; root < groups.size(); ++root) {
+    if (groups[root].empty())
+      continue;
+    std::set<uint32_t> pointees;
+    os << "group " << labels[root] << ":";
+    for (uint32_t id : groups[root]) {
+      os << " " << labels[id];
+      if (pointeeIds[id] != NoID)
+        pointees.insert(findID(pointeeIds[id]));
+    }
+    os << "\npoints-to " << labels[root] << ":";
+    for (uint32_t cls : pointees) {
+      os << " " << labels[cls];
+    }
+    os << "\n";
+  }
+}
+#endif
+#else
 Value *findDS(Value *x) {
   if (ds_parent.find(x) == ds_parent.end()) {
     ds_parent[x] = x;
@@ -32,22 +342,56 @@ Value *findDS(Value *x) {
   return ds_parent[x];
 }
 
+void joinPointee(Value *q, Value *x);
+
+// A class has one pointee class, kept in points2 under its root, so
+// uniting two classes unites their pointees as well.
 void unionDS(Value *p, Value *q) {
   Value *x = findDS(p);
   Value *y = findDS(q);
   if (x == y)
     return;
-  if (ds_rank[x] < ds_rank[y]) {
-    ds_parent[x] = y;
-  } else if (ds_rank[x] > ds_rank[y]) {
-    ds_parent[y] = x;
-  } else {
-    ds_parent[y] = x;
+  if (ds_rank[x] < ds_rank[y])
+    std::swap(x, y);
+  if (ds_rank[x] == ds_rank[y])
     ds_rank[x]++;
+  ds_parent[y] = x;
+  auto it = points2.find(y);
+  if (it != points2.end()) {
+    Value *pointee = it->second;
+    points2.erase(it);
+    joinPointee(x, pointee);
+  }
+}
+
+// [x := *q] and [*q := x]: x joins the pointee of q's class.
+void joinPointee(Value *q, Value *x) {
+  Value *root = findDS(q);
+  findDS(x);
+  auto [it, inserted] = points2.try_emplace(root, x);
+  if (!inserted) {
+    Value *pointee = it->second;
+    unionDS(pointee, x);
   }
 }
 
-void printGroups() {
+void pointToSelf(Value *ac) { joinPointee(ac, ac); }
+
+bool isDefined(Function *func) { return !func->isDeclaration(); }
+
+void unionReturns(Function *cf, CallInst *call) {
+  for (auto &cfBB : *cf) {
+    for (auto &cfinst : cfBB) {
+      if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(&cfinst)) {
+        Value *retVal = ret->getReturnValue();
+        if (retVal)
+          unionDS(retVal, call);
+      }
+    }
+  }
+}
+
+void printGroups(emit::Writer &writer) {
   std::unordered_map<Value *, std::vector<Value *>> groups;
   std::unordered_map<Value *, std::set<Value *>> gp2;
   for (auto [key, val] : ds_parent) {
@@ -61,54 +405,85 @@ void printGroups() {
       }
     }
   }
+  auto &os = writer.os();
   for (auto &[key, group] : groups) {
-    outs() << "\nGroup " << key << ": {";
+    if (emit::format != emit::Full) {
+      writer.record("group", key, group);
+      writer.record("points-to", key, gp2[key]);
+      continue;
+    }
+    os << "\nGroup " << key << ": {";
     for (auto val : group) {
-      outs() << "\n" << *val;
+      os << "\n" << writer.full(*val);
     }
-    outs() << "\n}\nPoints-to group(s): {";
+    os << "\n}\nPoints-to group(s): {";
     for (auto val : gp2[key]) {
-      outs() << " " << val;
+      os << " " << val;
     }
-    outs() << " }\n";
+    os << " }\n";
   }
 }
 
+// Number of objects each value may point to: the objects in the pointee
+// classes of its class.
+std::unordered_map<Value *, size_t> pointsToSizes() {
+  std::unordered_map<Value *, size_t> objects;
+  std::unordered_map<Value *, std::set<Value *>> pointees;
+  for (auto [key, parent] : ds_parent) {
+    Value *root = findDS(key);
+    objects[root] += avgpts::isObject(key);
+    auto it = points2.find(key);
+    if (it != points2.end())
+      pointees[root].insert(findDS(it->second));
+  }
+  std::unordered_map<Value *, size_t> sizes;
+  for (auto [key, parent] : ds_parent) {
+    size_t &size = sizes[key];
+    for (Value *cls : pointees[findDS(key)]) {
+      size += objects[cls];
+    }
+  }
+  return sizes;
+}
+
+// avgpts over the defined functions of module.
+double averagePointsTo(Module &module) {
+  auto sizes = pointsToSizes();
+  avgpts::Mean mean;
+  for (auto &func : module) {
+    mean.add(func, [&](Value *val) {
+      auto it = sizes.find(val);
+      return it == sizes.end() ? 0 : it->second;
+    });
+  }
+  return mean.get();
+}
+#endif
+
 void steensgaard(Instruction *inst) {
-  if (auto *ac = dyn_cast<AllocaInst>(inst)) {
-    findDS(ac);
-    points2[ac] = ac;
+  if (isa<AllocaInst>(inst) || isa<GetElementPtrInst>(inst)) {
+    // Allocas and GEPs are objects, as in the Andersen tools.
+    pointToSelf(inst);
 
   } else if (auto *ld = dyn_cast<LoadInst>(inst)) {
     // [p := *q] -> join(*p, **q)
     auto *q = ld->getPointerOperand();
-    if (points2.find(q) == points2.end()) {
-      findDS(q);
-      findDS(ld);
-      points2[q] = ld;
-    } else {
-      unionDS(points2[q], ld);
-    }
+    if (keepUnion(q, ld))
+      joinPointee(q, ld);
 
   } else if (auto *st = dyn_cast<StoreInst>(inst)) {
     // [*p := q] -> join(**p, *q)
     auto *p = st->getPointerOperand();
     auto *q = st->getValueOperand();
-    if (isa<Instruction>(q) || isa<Argument>(q)) {
-      if (points2.find(p) == points2.end()) {
-        findDS(p);
-        findDS(q);
-        points2[p] = q;
-      } else {
-        unionDS(points2[p], q);
-      }
-    }
+    if ((isa<Instruction>(q) || isa<Argument>(q)) && keepUnion(p, q))
+      joinPointee(p, q);
 
   } else if (PHINode *phi = dyn_cast<PHINode>(inst)) {
     // join incoming ptrs with phi var
     for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
       auto *val = phi->getIncomingValue(i);
-      if (isa<Instruction>(val) || isa<Argument>(val)) {
+      if ((isa<Instruction>(val) || isa<Argument>(val)) &&
+          keepUnion(val, phi)) {
         unionDS(phi, val);
       }
     }
@@ -116,42 +491,248 @@ void steensgaard(Instruction *inst) {
   } else if (auto *select = dyn_cast<SelectInst>(inst)) {
     Value *tval = select->getTrueValue();
     Value *fval = select->getFalseValue();
-    if (isa<Instruction>(tval) || isa<Argument>(tval)) {
+    if ((isa<Instruction>(tval) || isa<Argument>(tval)) &&
+        keepUnion(tval, select)) {
       unionDS(tval, select);
     }
-    if (isa<Instruction>(fval) || isa<Argument>(fval)) {
+    if ((isa<Instruction>(fval) || isa<Argument>(fval)) &&
+        keepUnion(fval, select)) {
       unionDS(fval, select);
     }
 
   } else if (auto *cast = dyn_cast<CastInst>(inst)) {
     Value *src = cast->getOperand(0);
-    unionDS(src, cast);
+    if (keepUnion(src, cast))
+      unionDS(src, cast);
 
   } else if (auto *call = dyn_cast<CallInst>(inst)) {
     auto *cf = call->getCalledFunction();
-    if (!cf || cf->isDeclaration())
+    if (!cf || !isDefined(cf))
       return;
     for (int i = 0; i < call->arg_size(); ++i) {
-      if (i < cf->arg_size()) {
+      if (i < cf->arg_size() &&
+          keepUnion(call->getArgOperand(i), cf->getArg(i))) {
         unionDS(call->getArgOperand(i), cf->getArg(i));
       }
     }
-    if (!cf->getReturnType()->isVoidTy()) {
-      for (auto &cfBB : *cf) {
-        for (auto &cfinst : cfBB) {
-          if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(&cfinst)) {
-            Value *retVal = ret->getReturnValue();
-            if (retVal)
-              unionDS(retVal, call);
-          }
-        }
+    if (!cf->getReturnType()->isVoidTy() && keepUnion(call, call))
+      unionReturns(cf, call);
+
+#ifdef STREAMING
+  } else if (auto *ret = dyn_cast<ReturnInst>(inst)) {
+    recordReturn(ret);
+#endif
+  }
+}
+
+// -DPARALLEL lowers the module into a snapshot.h copy and applies the same
+// rules on NTHREADS workers, one function at a time, over dense value IDs.
+// The union-find is lock-free: a root is linked by a CAS on its parent slot
+// (the higher ID under the lower, so concurrent links cannot form a cycle)
+// and finds halve the path. A value's pointee is an atomic slot as well;
+// the first writer sets it and later ones unite with what is there. Since
+// pointees belong to values, not classes, merging two classes never has to
+// merge their pointees while the workers run; unifyPointees does that after
+// them, so each class ends with one pointee class as in the other modes.
+#ifdef PARALLEL
+class ConcurrentUnionFind {
+public:
+  explicit ConcurrentUnionFind(size_t size)
+      : parent(new std::atomic<uint32_t>[size]),
+        pointee(new std::atomic<uint32_t>[size]),
+        touched(new std::atomic<bool>[size]), count(size) {
+    for (uint32_t v = 0; v < size; ++v) {
+      parent[v].store(v, std::memory_order_relaxed);
+      pointee[v].store(snapshot::None, std::memory_order_relaxed);
+      touched[v].store(false, std::memory_order_relaxed);
+    }
+  }
+
+  size_t size() const { return count; }
+
+  uint32_t find(uint32_t x) {
+    while (true) {
+      uint32_t p = parent[x].load(std::memory_order_relaxed);
+      if (p == x)
+        return x;
+      uint32_t gp = parent[p].load(std::memory_order_relaxed);
+      if (p != gp)
+        parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+      x = gp;
+    }
+  }
+
+  void unite(uint32_t a, uint32_t b) {
+    touch(a);
+    touch(b);
+    while (true) {
+      a = find(a);
+      b = find(b);
+      if (a == b)
+        return;
+      if (a < b)
+        std::swap(a, b);
+      // Fails if a stopped being a root meanwhile; retry from the roots.
+      uint32_t expected = a;
+      if (parent[a].compare_exchange_strong(expected, b,
+                                            std::memory_order_acq_rel))
+        return;
+    }
+  }
+
+  // [*q := v] and [v := *q]: v joins the pointee of q.
+  void joinPointee(uint32_t q, uint32_t v) {
+    touch(q);
+    touch(v);
+    uint32_t expected = snapshot::None;
+    if (!pointee[q].compare_exchange_strong(expected, v,
+                                            std::memory_order_acq_rel))
+      unite(expected, v);
+  }
+
+  void touch(uint32_t v) { touched[v].store(true, std::memory_order_relaxed); }
+  bool isTouched(uint32_t v) const {
+    return touched[v].load(std::memory_order_relaxed);
+  }
+  uint32_t pointeeOf(uint32_t v) const {
+    return pointee[v].load(std::memory_order_relaxed);
+  }
+
+private:
+  std::unique_ptr<std::atomic<uint32_t>[]> parent;
+  std::unique_ptr<std::atomic<uint32_t>[]> pointee;
+  // Values a rule mentioned, the keys of ds_parent in the sequential run.
+  std::unique_ptr<std::atomic<bool>[]> touched;
+  size_t count;
+};
+
+void steensgaard(const snapshot::Module &ir, uint32_t func,
+                 ConcurrentUnionFind &uf) {
+#ifdef PTR_FILTER
+  ptrfilter::Tally edges;
+  auto keep = [&](uint32_t p, uint32_t q) {
+    return edges(pointerFilter.keep(ir.source(p), ir.source(q)));
+  };
+#else
+  auto keep = [](uint32_t, uint32_t) { return true; };
+#endif
+  for (uint32_t v : ir.insts(func)) {
+    unsigned op = ir.opcode[v];
+    if (op == Instruction::Alloca || op == Instruction::GetElementPtr) {
+      uf.joinPointee(v, v);
+
+    } else if (op == Instruction::Load) {
+      uint32_t q = ir.pointerOperand(v);
+      if (keep(q, v))
+        uf.joinPointee(q, v);
+
+    } else if (op == Instruction::Store) {
+      uint32_t p = ir.pointerOperand(v);
+      uint32_t q = ir.operand(v, 0);
+      if (ir.isLocal(q) && keep(p, q))
+        uf.joinPointee(p, q);
+
+    } else if (op == Instruction::PHI) {
+      for (unsigned i = 0; i < ir.numIncoming(v); ++i) {
+        uint32_t val = ir.incomingValue(v, i);
+        if (ir.isLocal(val) && keep(val, v))
+          uf.unite(v, val);
+      }
+
+    } else if (op == Instruction::Select) {
+      for (unsigned i = 1; i < 3; ++i) {
+        uint32_t val = ir.operand(v, i);
+        if (ir.isLocal(val) && keep(val, v))
+          uf.unite(val, v);
+      }
+
+    } else if (Instruction::isCast(op)) {
+      uint32_t src = ir.operand(v, 0);
+      if (keep(src, v))
+        uf.unite(src, v);
+
+    } else if (op == Instruction::Call) {
+      uint32_t callee = ir.calledOperand(v);
+      if (ir.kind[callee] != snapshot::Function)
+        continue;
+      uint32_t cf = ir.functionIndex(callee);
+      if (ir.isDeclaration(cf))
+        continue;
+      auto formals = ir.args(cf);
+      size_t numArgs = ir.operands(v).size() - 1;
+      for (uint32_t i = 0; i < numArgs && i < formals.size(); ++i) {
+        uint32_t actual = ir.operand(v, i);
+        if (keep(actual, formals.begin()[i]))
+          uf.unite(actual, formals.begin()[i]);
+      }
+      if (ir.is(callee, snapshot::Void) || !keep(v, v))
+        continue;
+      for (uint32_t b : ir.blocks(cf)) {
+        uint32_t ret = ir.terminator(b);
+        if (ir.isInst(ret, Instruction::Ret) && !ir.operands(ret).empty())
+          uf.unite(ir.operand(ret, 0), v);
+      }
+    }
+  }
+}
+
+// Unites the pointees of the members of each class, repeating while a pass
+// unites anything, since each union can merge two more classes.
+void unifyPointees(ConcurrentUnionFind &uf) {
+  std::vector<uint32_t> classPointee(uf.size());
+  for (bool changed = true; changed;) {
+    changed = false;
+    std::fill(classPointee.begin(), classPointee.end(), snapshot::None);
+    for (uint32_t v = 0; v < uf.size(); ++v) {
+      uint32_t pointee = uf.pointeeOf(v);
+      if (pointee == snapshot::None)
+        continue;
+      uint32_t &first = classPointee[uf.find(v)];
+      if (first == snapshot::None) {
+        first = pointee;
+      } else if (uf.find(first) != uf.find(pointee)) {
+        uf.unite(first, pointee);
+        changed = true;
       }
     }
   }
 }
 
+void parallelSteensgaard(const snapshot::Module &ir, ConcurrentUnionFind &uf) {
+  std::atomic<uint32_t> next{0};
+  auto worker = [&] {
+    for (uint32_t f; (f = next++) < ir.numFunctions();) {
+      if (!ir.isDeclaration(f))
+        steensgaard(ir, f, uf);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < NTHREADS; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &t : threads) {
+    t.join();
+  }
+  unifyPointees(uf);
+}
+
+// Fills ds_parent and points2 from the result, for printGroups and
+// averagePointsTo.
+void exportGroups(const snapshot::Module &ir, ConcurrentUnionFind &uf) {
+  for (uint32_t v = 0; v < uf.size(); ++v) {
+    if (!uf.isTouched(v))
+      continue;
+    ds_parent[ir.source(v)] = ir.source(uf.find(v));
+    if (uf.pointeeOf(v) != snapshot::None)
+      points2[ir.source(v)] = ir.source(uf.pointeeOf(v));
+  }
+}
+#endif
+
 int main(int argc, char *argv[]) {
   InitLLVM X(argc, argv);
+  emit::init(argc, argv);
   if (argc < 2) {
     errs() << "Expect IR filename\n";
     exit(1);
@@ -159,7 +740,11 @@ int main(int argc, char *argv[]) {
   LLVMContext context;
   SMDiagnostic smd;
   char *filename = argv[1];
+#ifdef STREAMING
+  std::unique_ptr<Module> module = getLazyIRFileModule(filename, smd, context);
+#else
   std::unique_ptr<Module> module = parseIRFile(filename, smd, context);
+#endif
   if (!module) {
     errs() << "Cannot parse IR file\n";
     smd.print(filename, errs());
@@ -169,9 +754,37 @@ int main(int argc, char *argv[]) {
   outs() << "Steensgaard's Analysis\n";
   outs() << module->getFunctionList().size() << " function(s)\n";
   auto start = std::chrono::high_resolution_clock::now();
+#ifdef PTR_FILTER
+  pointerFilter = ptrfilter::Filter(*module);
+#endif
+#ifdef PARALLEL
+  auto lowering = std::chrono::high_resolution_clock::now();
+  snapshot::Module ir(*module);
+  auto lowered = std::chrono::high_resolution_clock::now();
+  ConcurrentUnionFind uf(ir.size());
+  parallelSteensgaard(ir, uf);
+  outs() << "Lowering time: "
+         << std::chrono::duration_cast<std::chrono::microseconds>(lowered -
+                                                                  lowering)
+                .count()
+         << " us\n";
+#else
+#if defined(STREAMING) && defined(PRINT_RESULTS)
+  slots = std::make_unique<ModuleSlotTracker>(module.get(), false);
+#endif
   for (auto &func : *module) {
     if (func.isDeclaration())
       continue;
+#ifdef STREAMING
+    if (Error err = func.materialize()) {
+      errs() << "Cannot materialize " << func.getName() << ": "
+             << toString(std::move(err)) << "\n";
+      exit(1);
+    }
+#if defined(PRINT_RESULTS)
+    slots->incorporateFunction(func);
+#endif
+#endif
 
     // ds_parent.clear();
     // ds_rank.clear();
@@ -185,12 +798,37 @@ int main(int argc, char *argv[]) {
     // outs() << "\nFunction: " << func.getName() << "\n";
     // printGroups();
     // outs() << "******************************** " << func.getName() << "\n";
+#ifdef STREAMING
+    finishFunction(func);
+#endif
   }
+#endif
   auto end = std::chrono::high_resolution_clock::now();
   auto duration =
       std::chrono::duration_cast<std::chrono::microseconds>(end - start);
   outs() << "Analysis time: " << duration.count() << " us\n";
+#ifdef PTR_FILTER
+  tally.flush();
+  ptrfilter::report(outs());
+#endif
+#ifdef PARALLEL
+  exportGroups(ir, uf);
+#endif
+  outs() << "Average points-to set size: "
+         << format("%.2f", averagePointsTo(*module)) << "\n";
+#ifdef STREAMING
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  outs() << parentIds.size() << " IDs (peak " << peakIds << "), peak RSS "
+         << usage.ru_maxrss << " KiB\n";
+#endif
 #ifdef PRINT_RESULTS
-  printGroups();
+#ifdef STREAMING
+  printGroups(outs());
+#else
+  emit::Writer writer(*module, "p2-steensgaard");
+  printGroups(writer);
 #endif
-}
\ No newline at end of file
+#endif
+  return 0;
+}
@@ -20,25 +20,60 @@
 #include <string>
 #include <fstream>
 
-using namespace llvm;
-
+#include "../common/arena.h"
+#include "../common/cost.h"
+#include "../common/emit.h"
+#include "../common/instrument.h"
+#include "../common/ptrfilter.h"
+#include "../common/snapshot.h"
 
-std::mutex outsmtx;
+using namespace llvm;
 
 struct TaskInfo {
   Function *func;
   size_t size;
+  // Predicted time (cost.h); the queue pops the most expensive task first.
+  double cost;
   int index;
 
-  bool operator<(const TaskInfo &rhs) const { return size < rhs.size; }
+  bool operator<(const TaskInfo &rhs) const { return cost < rhs.cost; }
 };
 
+using PtsSet = arena::Set<Value *>;
+
+// Allocated from the thread's arena; the scope is declared first so that it
+// is destroyed last and releases everything at once.
 struct LocalData {
-  std::unordered_map<Value *, std::set<Value *>> pt;
-  std::queue<std::pair<Value *, std::set<Value *>>> worklist;
-  std::unordered_map<Value *, std::set<Value *>> PFG;
+  arena::Scope scope;
+  arena::UnorderedMap<Value *, PtsSet> pt;
+  arena::Queue<std::pair<Value *, PtsSet>> worklist;
+  arena::UnorderedMap<Value *, PtsSet> PFG;
+#ifdef PTR_FILTER
+  ptrfilter::Filter filter;
+  ptrfilter::Tally tally;
+#endif
 };
 
+// -DPTR_FILTER leaves values that cannot hold an address (ptrfilter.h) out
+// of the pointer flow graph, e.g. integer phis and floating-point casts.
+#if defined(PTR_FILTER) && defined(SNAPSHOT)
+#error "-DPTR_FILTER classifies llvm::Values and cannot take -DSNAPSHOT"
+#endif
+
+#ifdef PTR_FILTER
+bool keepEdge(Value *s, Value *t, LocalData &localdata) {
+  return localdata.tally(localdata.filter.keep(s, t));
+}
+
+bool relevant(Value *val, LocalData &localdata) {
+  return localdata.filter.relevant(val);
+}
+#else
+bool keepEdge(Value *, Value *, LocalData &) { return true; }
+
+bool relevant(Value *, LocalData &) { return true; }
+#endif
+
 void addEdge(Value *s, Value *t, LocalData &localdata) {
   auto& pt = localdata.pt;
   auto &worklist = localdata.worklist;
@@ -51,12 +86,13 @@ void addEdge(Value *s, Value *t, LocalData &localdata) {
   }
 }
 
-void propagate(Value *n, const std::set<Value *> &pts, LocalData &localdata) {
+void propagate(Value *n, const PtsSet &pts, LocalData &localdata) {
   auto &pt = localdata.pt;
   auto &worklist = localdata.worklist;
   auto &PFG = localdata.PFG;
   if (!pts.empty()) {
     pt[n].insert(pts.begin(), pts.end());
+    instrument::setUnion(pt[n].size());
     for (auto *s : PFG[n]) {
       worklist.push({s, pts});
     }
@@ -64,7 +100,11 @@ void propagate(Value *n, const std::set<Value *> &pts, LocalData &localdata) {
 }
 
 void initialize(Function &func, LocalData& localdata) {
+  instrument::PhaseTimer timer(instrument::Init);
   auto &worklist = localdata.worklist;
+#ifdef PTR_FILTER
+  localdata.filter = ptrfilter::Filter(func);
+#endif
   for (auto &BB : func) {
     for (auto &inst : BB) {
 
@@ -77,7 +117,8 @@ void initialize(Function &func, LocalData& localdata) {
       } else if (auto *phi = dyn_cast<PHINode>(&inst)) {
         for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
           Value *val = phi->getIncomingValue(i);
-          if (isa<Instruction>(val) || isa<Argument>(val)) {
+          if ((isa<Instruction>(val) || isa<Argument>(val)) &&
+              keepEdge(val, phi, localdata)) {
             addEdge(val, phi, localdata);
           }
         }
@@ -85,16 +126,19 @@ void initialize(Function &func, LocalData& localdata) {
       } else if (auto *select = dyn_cast<SelectInst>(&inst)) {
         Value *tval = select->getTrueValue();
         Value *fval = select->getFalseValue();
-        if (isa<Instruction>(tval) || isa<Argument>(tval)) {
+        if ((isa<Instruction>(tval) || isa<Argument>(tval)) &&
+            keepEdge(tval, select, localdata)) {
           addEdge(tval, select, localdata);
         }
-        if (isa<Instruction>(fval) || isa<Argument>(fval)) {
+        if ((isa<Instruction>(fval) || isa<Argument>(fval)) &&
+            keepEdge(fval, select, localdata)) {
           addEdge(fval, select, localdata);
         }
 
       } else if (auto *cast = dyn_cast<CastInst>(&inst)) {
         Value *src = cast->getOperand(0);
-        addEdge(src, cast, localdata);
+        if (keepEdge(src, cast, localdata))
+          addEdge(src, cast, localdata);
       }
       // iter end
     }
@@ -102,14 +146,16 @@ void initialize(Function &func, LocalData& localdata) {
 }
 
 void solve(LocalData& localdata) {
+  instrument::PhaseTimer timer(instrument::Solve);
   auto &pt = localdata.pt;
   auto &worklist = localdata.worklist;
   // auto &PFG = localdata.PFG;
   while (!worklist.empty()) {
     auto [n, pts] = worklist.front();
     worklist.pop();
+    instrument::worklistPops();
 
-    std::set<Value *> delta;
+    PtsSet delta;
     std::set_difference(pts.begin(), pts.end(), pt[n].begin(), pt[n].end(),
                         std::inserter(delta, delta.begin()));
     propagate(n, delta, localdata);
@@ -119,7 +165,8 @@ void solve(LocalData& localdata) {
         // *x = y (store y -> ptr x)
         if (store->getPointerOperand() == n) {
           Value *y = store->getValueOperand();
-          if (isa<Instruction>(y) || isa<Argument>(y)) {
+          if ((isa<Instruction>(y) || isa<Argument>(y)) &&
+              relevant(y, localdata)) {
             for (Value *oi : delta) {
               addEdge(y, oi, localdata);
             }
@@ -128,7 +175,7 @@ void solve(LocalData& localdata) {
 
       } else if (LoadInst *load = dyn_cast<LoadInst>(user)) {
         // y = *x (load ptr x -> y)
-        if (load->getPointerOperand() == n) {
+        if (load->getPointerOperand() == n && relevant(load, localdata)) {
           Value *y = load;
           for (Value *oi : delta) {
             addEdge(oi, y, localdata);
@@ -140,18 +187,167 @@ void solve(LocalData& localdata) {
   }
 }
 
-void print(LocalData& localdata) {
+// -DSNAPSHOT runs the same propagation on a snapshot.h copy of the module.
+// Nodes are the local indices of the function, so the points-to sets and
+// the pointer flow graph are arrays instead of hash maps. Only locals ever
+// get a points-to set, so edges from constants and globals are dropped.
+// The concurrent build drops the module right after lowering.
+#ifdef SNAPSHOT
+const snapshot::Module *ir = nullptr;
+
+using LocalSet = arena::Set<uint32_t>;
+
+struct FlatData {
+  arena::Scope scope;
+  uint32_t func;
+  arena::Vector<LocalSet> pt;
+  arena::Queue<std::pair<uint32_t, LocalSet>> worklist;
+  arena::Vector<LocalSet> PFG;
+};
+
+void addEdge(uint32_t s, uint32_t t, FlatData &data) {
+  if (data.PFG[s].insert(t).second && !data.pt[s].empty()) {
+    data.worklist.push({t, data.pt[s]});
+  }
+}
+
+void propagate(uint32_t n, const LocalSet &pts, FlatData &data) {
+  if (!pts.empty()) {
+    data.pt[n].insert(pts.begin(), pts.end());
+    instrument::setUnion(data.pt[n].size());
+    for (uint32_t s : data.PFG[n]) {
+      data.worklist.push({s, pts});
+    }
+  }
+}
+
+void initialize(uint32_t func, FlatData &data) {
+  instrument::PhaseTimer timer(instrument::Init);
+  data.func = func;
+  data.pt.resize(ir->numLocals(func));
+  data.PFG.resize(ir->numLocals(func));
+  auto local = [&](uint32_t v) { return ir->localIndex(func, v); };
+  for (uint32_t v : ir->insts(func)) {
+    uint32_t n = local(v);
+    unsigned op = ir->opcode[v];
+    if (op == Instruction::Alloca || op == Instruction::GetElementPtr) {
+      data.worklist.push({n, {n}});
+
+    } else if (op == Instruction::PHI) {
+      for (unsigned i = 0; i < ir->numIncoming(v); ++i) {
+        uint32_t in = ir->incomingValue(v, i);
+        if (ir->isLocal(in))
+          addEdge(local(in), n, data);
+      }
+
+    } else if (op == Instruction::Select) {
+      for (unsigned i = 1; i <= 2; ++i) {
+        uint32_t in = ir->operand(v, i);
+        if (ir->isLocal(in))
+          addEdge(local(in), n, data);
+      }
+
+    } else if (Instruction::isCast(op)) {
+      uint32_t src = ir->operand(v, 0);
+      if (ir->isLocal(src))
+        addEdge(local(src), n, data);
+    }
+  }
+}
+
+void solve(FlatData &data) {
+  instrument::PhaseTimer timer(instrument::Solve);
+  uint32_t func = data.func;
+  while (!data.worklist.empty()) {
+    auto [n, pts] = data.worklist.front();
+    data.worklist.pop();
+    instrument::worklistPops();
+
+    LocalSet delta;
+    auto &cur = data.pt[n];
+    std::set_difference(pts.begin(), pts.end(), cur.begin(), cur.end(),
+                        std::inserter(delta, delta.begin()));
+    propagate(n, delta, data);
+
+    uint32_t v = ir->localValue(func, n);
+    for (uint32_t user : ir->users(v)) {
+      if (ir->isInst(user, Instruction::Store)) {
+        // *x = y (store y -> ptr x)
+        uint32_t y = ir->operand(user, 0);
+        if (ir->operand(user, 1) == v && ir->isLocal(y)) {
+          for (uint32_t oi : delta) {
+            addEdge(ir->localIndex(func, y), oi, data);
+          }
+        }
+
+      } else if (ir->isInst(user, Instruction::Load)) {
+        // y = *x (load ptr x -> y)
+        uint32_t y = ir->localIndex(func, user);
+        for (uint32_t oi : delta) {
+          addEdge(oi, y, data);
+        }
+      }
+    }
+  }
+}
+
+void print(Function &func, FlatData &data, emit::Writer &writer) {
+  auto value = [&](uint32_t n) {
+    return ir->source(ir->localValue(data.func, n));
+  };
+  std::vector<Value *> points2;
+  if (emit::format != emit::Full)
+    writer.beginFunction(func);
+  auto &os = writer.os();
+  if (emit::format == emit::Full) {
+    os << "\nFunction: " << func.getName() << "\n";
+    os << "Points-to Set:\n";
+    os << "=================\n";
+  }
+  for (uint32_t p = 0; p < data.pt.size(); ++p) {
+    if (data.pt[p].empty())
+      continue;
+    points2.clear();
+    for (uint32_t n : data.pt[p]) {
+      points2.push_back(value(n));
+    }
+    if (emit::format != emit::Full) {
+      writer.record("points-to", value(p), points2);
+      continue;
+    }
+    os << writer.full(*value(p)) << "\n->";
+    for (Value *v : points2) {
+      os << "\t" << writer.full(*v) << "\n";
+    }
+    os << "\n";
+  }
+  if (emit::format == emit::Full)
+    os << "******************************** " << func.getName() << "\n";
+}
+#endif
+
+void print(Function &func, LocalData &localdata, emit::Writer &writer) {
   auto &pt = localdata.pt;
   auto &PFG = localdata.PFG;
-  outs() << "Points-to Set:\n";
-  outs() << "=================\n";
+  if (emit::format != emit::Full) {
+    writer.beginFunction(func);
+    for (auto &[p, points2] : pt) {
+      writer.record("points-to", p, points2);
+    }
+    return;
+  }
+  auto &os = writer.os();
+  os << "\nFunction: " << func.getName() << "\n";
+  os << "Points-to Set:\n";
+  os << "=================\n";
   for (auto &[p, points2] : pt) {
-    outs() << *p << "\n->";
+    os << writer.full(*p) << "\n->";
     for (Value *v : points2) {
-      outs() << "\t" << *v << "\n";
+      os << "\t" << writer.full(*v) << "\n";
     }
-    outs() << "\n";
+    os << "\n";
   }
+  os << "******************************** " << func.getName() << "\n";
 
   // outs() << "Pointer Flow Graph:\n";
   // outs() << "=================\n";
@@ -166,80 +362,46 @@ void print(LocalData& localdata) {
 
 void threadedPoints2(std::mutex &Qmutex, std::priority_queue<TaskInfo> &taskQ,
                       int tid) {
-  auto start = std::chrono::high_resolution_clock::now();
-  int max_time = 0;
-  int max_size = 0;
-  int task_count = 0;
-  int total_size = 0;
-  int total_size_sq = 0;
-  int total_time = 0;
-  int total_time_sq = 0;
-
+  instrument::ThreadScope scope("worker " + std::to_string(tid));
   while (true) {
+#ifdef SNAPSHOT
     int index;
+#else
     Function *func;
+#endif
     int size;
     {
       std::lock_guard<std::mutex> lock(Qmutex);
       if (taskQ.empty())
         break;
+#ifdef SNAPSHOT
       index = taskQ.top().index;
+#else
       func = taskQ.top().func;
+#endif
       size = taskQ.top().size;
       taskQ.pop();
     }
-#ifdef PRINT_STATS
-    auto sub_start = std::chrono::high_resolution_clock::now();
-#endif
+#ifdef SNAPSHOT
+    instrument::TaskTimer task(size, ir->name(index), size,
+                               ir->numInsts(index));
+    FlatData data;
+    initialize(index, data);
+    solve(data);
+#else
+    instrument::TaskTimer task(size, func);
 
     LocalData localdata;
     initialize(*func, localdata);
     solve(localdata);
-
-#ifdef PRINT_STATS
-    auto sub_end = std::chrono::high_resolution_clock::now();
-    auto sub_duration =
-        std::chrono::duration_cast<std::chrono::milliseconds>(sub_end -
-        sub_start);
-    int time = sub_duration.count();
-    if (time > max_time){
-      max_time = time;
-      max_size = size;
-    }
-    task_count++;
-    total_size += size;
-    total_size_sq += size * size;
-    total_time += time;
-    total_time_sq += time * time;
 #endif
   }
-
-#ifdef PRINT_STATS
-  auto end = std::chrono::high_resolution_clock::now();
-  auto duration =
-      std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-
-  int mean_size = total_size / task_count;
-  int var_size = (total_size_sq / task_count) - (mean_size * mean_size);
-  int mean_time = total_time / task_count;
-  int var_time = (total_time_sq / task_count) - (mean_time * mean_time);
-
-  {
-    std::lock_guard<std::mutex> lock(outsmtx);
-    outs() << "\nThread " << tid << "\ttime:\t" << duration.count() << " ms\n";
-    outs() << "Max task time :\t " << max_time << " ms with\t " << max_size
-           << " BBs\n";
-    outs() << "Tasks processed:\t" << task_count << "\n";
-    outs() << "Task size mean:\t" << mean_size << ", var:\t" << var_size
-           << ", std dev:\t" << (int)std::sqrt(var_size) << "\n";
-    outs() << "Task time mean:\t" << mean_time << ", var:\t" << var_time
-           << ", std dev:\t" << (int)std::sqrt(var_time) << "\n";
-  }
-#endif
 }
 
 int main(int argc, char *argv[]) {
   InitLLVM X(argc, argv);
+  instrument::init(argc, argv);
+  emit::init(argc, argv);
   if (argc < 2) {
     outs() << "Expect IR filename\n";
     exit(1);
@@ -247,7 +409,11 @@ int main(int argc, char *argv[]) {
   LLVMContext context;
   SMDiagnostic smd;
   char *filename = argv[1];
-  std::unique_ptr<Module> module = parseIRFile(filename, smd, context);
+  std::unique_ptr<Module> module;
+  {
+    instrument::PhaseTimer timer(instrument::Parse);
+    module = parseIRFile(filename, smd, context);
+  }
   if (!module) {
     outs() << "Cannot parse IR file\n";
     smd.print(filename, outs());
@@ -257,6 +423,16 @@ int main(int argc, char *argv[]) {
   outs() << "Intra-Procedural Analysis" << "\n";
   outs() << module->getFunctionList().size() << " function(s)\n";
   auto start = std::chrono::high_resolution_clock::now();
+#ifdef SNAPSHOT
+  std::unique_ptr<snapshot::Module> lowered;
+  {
+    instrument::PhaseTimer timer(instrument::Init);
+    lowered = std::make_unique<snapshot::Module>(*module);
+  }
+  ir = lowered.get();
+  outs() << "Snapshot: " << ir->size() << " values, " << ir->bytes() / 1024
+         << " KiB\n";
+#endif
 
 #ifndef NTHREADS
 #define NTHREADS 16
@@ -269,8 +445,11 @@ int main(int argc, char *argv[]) {
   for (auto [i, func] : enumerate(*module)) {
     if (func.isDeclaration())
       continue;
-    taskQ.push({&func, func.size(), (int)i});
+    taskQ.push({&func, func.size(), points2Cost.predict(func), (int)i});
   }
+#ifdef SNAPSHOT
+  module.reset();
+#endif
   std::mutex Qmutex;
   std::vector<std::thread> threads;
   threads.reserve(NTHREADS);
@@ -288,50 +467,62 @@ int main(int argc, char *argv[]) {
 #ifdef CSV
   std::string csvname = std::string(argv[1]) + ".csv";
   std::ofstream csv(csvname);
-  csv << "name,size,inum,time(us)\n";
+  csv << "name," << FuncFeatures::csvHeader() << ",time(us)\n";
 #ifndef RUN_COUNT
 #define RUN_COUNT 1
 #endif
 #endif
 
-  for (auto &func : *module) {
+#ifdef PRINT_RESULTS
+  emit::Writer writer(*module, "p2");
+#endif
+  for (auto [i, func] : enumerate(*module)) {
     if (func.isDeclaration())
       continue;
 #ifdef CSV
     std::string fname = func.getName().str();
-    size_t fsize = func.size();
-    int instNum = 0;
-    for (BasicBlock &BB : func) {
-      instNum += BB.size();
-    }
-    int tftime = 0;
+    FuncFeatures features(func);
+    double tftime = 0;
     for (int r = 0; r < RUN_COUNT; ++r) {
       auto fstart = std::chrono::high_resolution_clock::now();
 #endif
+#ifdef SNAPSHOT
+      FlatData localdata;
+      initialize(i, localdata);
+#else
       LocalData localdata;
       initialize(func, localdata);
+#endif
       solve(localdata);
 #ifdef CSV
       auto fend = std::chrono::high_resolution_clock::now();
       auto ftime =
-          std::chrono::duration_cast<std::chrono::microseconds>(fend - fstart)
+          std::chrono::duration_cast<std::chrono::nanoseconds>(fend - fstart)
               .count();
-      tftime += ftime;
+      tftime += ftime / 1000.0;
     }
     tftime /= RUN_COUNT;
-    csv << fname << "," << fsize << "," << instNum << "," << tftime << "\n";
+    csv << fname << "," << features.csvRow() << "," << tftime << "\n";
 #endif
 
 #ifdef PRINT_RESULTS
-    outs() << "\nFunction: " << func.getName() << "\n";
-    print(localdata);
-    outs() << "******************************** " << func.getName() << "\n";
+    instrument::PhaseTimer timer(instrument::Output);
+    print(func, localdata, writer);
 #endif
   }
+#ifdef PRINT_RESULTS
+  writer.finish();
+#endif
 #endif
 
   auto end = std::chrono::high_resolution_clock::now();
   auto duration =
       std::chrono::duration_cast<std::chrono::microseconds>(end - start);
   outs() << "Analysis time: " << duration.count() << " us\n";
-}
\ No newline at end of file
+#ifdef PTR_FILTER
+  ptrfilter::report(outs());
+#endif
+
+  instrument::report("p2", filename);
+  return 0;
+}
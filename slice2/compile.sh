@@ -1,6 +1,16 @@
 
 clang++ -O3 slice.cpp `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice
 
-clang++ -O3 slice.cpp -DCONCURRENT -DPRINT_STATS -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-c
+clang++ -O3 slice.cpp -DCONCURRENT -DNTHREADS=4 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-c
+
+clang++ -O3 slice.cpp -DCONCURRENT -DNTHREADS=4 -DSNAPSHOT `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-snapshot-c
 
 clang++ -O3 slice.cpp -DCSV -DRUN_COUNT=3 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-csv
+
+clang++ -O3 -march=native slice.cpp -DMULTI_ROOT -DSLICE_BATCH=512 `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-multi
+
+clang++ -O3 slice.cpp -DTHIN_SLICE `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-thin
+
+clang++ -O3 slice.cpp -DCHOP -DTHIN_SLICE `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-chop
+
+clang++ -O3 slice.cpp -DSLICE_COMPARE `llvm-config --cxxflags --ldflags --system-libs --libs core` -o slice-compare
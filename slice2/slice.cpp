@@ -1,4 +1,6 @@
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/IR/Argument.h"
+#include "llvm/IR/CFG.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
@@ -9,30 +11,110 @@
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <queue>
 // #include <set>
 // #include <unordered_map>
 #include <cmath>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
 #include <vector>
 
-using namespace llvm;
+#include "../common/cost.h"
+#include "../common/instrument.h"
+#include "../common/snapshot.h"
 
-std::mutex outsmtx;
+using namespace llvm;
 
 struct TaskInfo {
   Function *func;
-  Value *val;
+  // Node ID of the slicing root in its FuncGraph.
+  unsigned root;
+  bool backward;
   size_t size;
+  // Predicted time (cost.h); the queue pops the most expensive task first.
+  double cost;
   int index;
 
-  bool operator<(const TaskInfo &rhs) const { return size < rhs.size; }
+  bool operator<(const TaskInfo &rhs) const { return cost < rhs.cost; }
 };
 
+// Calls visit() on every value the backward slice of val depends on.
+template <typename Visit> void forEachBackwardDep(Value *val, Visit &&visit) {
+  if (auto *phi = dyn_cast<PHINode>(val)) {
+    for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
+      auto *ival = phi->getIncomingValue(i);
+      if (auto *ivalInst = dyn_cast<Instruction>(ival)) {
+        visit(ivalInst);
+      }
+      auto *iBB = phi->getIncomingBlock(i);
+      Instruction *term = iBB->getTerminator();
+      visit(term);
+    }
+    return;
+
+  } else if (auto *select = dyn_cast<SelectInst>(val)) {
+    Value *tval = select->getTrueValue();
+    Value *fval = select->getFalseValue();
+    if (auto *tvalInst = dyn_cast<Instruction>(tval)) {
+      visit(tvalInst);
+    }
+    if (auto *fvalInst = dyn_cast<Instruction>(fval)) {
+      visit(fvalInst);
+    }
+
+  } else if (auto *cast = dyn_cast<CastInst>(val)) {
+    Value *src = cast->getOperand(0);
+    if (auto *srcInst = dyn_cast<Instruction>(src)) {
+      visit(srcInst);
+    }
+
+    // } else if (auto *call = dyn_cast<CallInst>(inst)) {
+    //   auto *cf = call->getCalledFunction();
+    //   if (cf && !cf->isDeclaration()) {
+    //     for (int i = 0; i < call->arg_size(); ++i) {
+    //       if (i < cf->arg_size()) {
+    //         auto *arg = cf->getArg(i);
+    //         if (auto *argInst = dyn_cast<Instruction>(arg)) {
+    //           visit(argInst);
+    //         }
+    //       }
+    //     }
+    //     if (!cf->getReturnType()->isVoidTy()) {
+    //       for (auto &cfBB : *cf) {
+    //         for (auto &cfinst : cfBB) {
+    //           if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(&cfinst)) {
+    //             visit(ret);
+    //           }
+    //         }
+    //       }
+    //     }
+    //   }
+
+  } else if (auto *inst = dyn_cast<Instruction>(val)) {
+    for (auto &use : inst->operands()) {
+      if (auto *op = dyn_cast<Instruction>(use)) {
+        visit(op);
+      }
+    }
+
+  } else {
+    visit(val);
+  }
+
+  if (auto *inst = dyn_cast<Instruction>(val)) {
+    for (BasicBlock *predBB : predecessors(inst->getParent())) {
+      auto *term = predBB->getTerminator();
+      visit(term);
+    }
+  }
+}
+
 void backwardSlice(Value *root, std::unordered_set<Value *> &slice) {
   std::queue<Value *> worklist;
 
@@ -45,101 +127,512 @@ void backwardSlice(Value *root, std::unordered_set<Value *> &slice) {
   slice.insert(root);
   worklist.push(root);
 
+  while (!worklist.empty()) {
+    auto *val = worklist.front();
+    worklist.pop();
+    forEachBackwardDep(val, add2Slice);
+  }
+}
+
+void forwardSlice(Value *root, std::unordered_set<Value *> &slice) {
+  std::queue<Value *> worklist;
+
+  auto add2Slice = [&](Value *i) {
+    if (slice.insert(i).second) {
+      worklist.push(i);
+    }
+  };
+
+  slice.insert(root);
+  worklist.push(root);
+
   while (!worklist.empty()) {
     auto *val = worklist.front();
     worklist.pop();
 
-    if (auto *phi = dyn_cast<PHINode>(val)) {
-      for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
-        auto *ival = phi->getIncomingValue(i);
-        if (auto *ivalInst = dyn_cast<Instruction>(ival)) {
-          add2Slice(ivalInst);
+    for (auto *user : val->users()) {
+      add2Slice(user);
+    }
+  }
+}
+
+// Calls visit() on the producers of val only: no control dependences, and no
+// base pointers of address computations. A load is produced by the stores to
+// the same pointer, and arguments count as producers.
+template <typename Visit> void forEachThinDep(Value *val, Visit &&visit) {
+  auto visitInst = [&](Value *op) {
+    if (isa<Instruction>(op) || isa<Argument>(op)) {
+      visit(op);
+    }
+  };
+
+  if (auto *phi = dyn_cast<PHINode>(val)) {
+    for (int i = 0; i < phi->getNumIncomingValues(); ++i) {
+      visitInst(phi->getIncomingValue(i));
+    }
+
+  } else if (auto *select = dyn_cast<SelectInst>(val)) {
+    visitInst(select->getTrueValue());
+    visitInst(select->getFalseValue());
+
+  } else if (auto *load = dyn_cast<LoadInst>(val)) {
+    auto *loadptr = load->getPointerOperand();
+    for (auto *user : loadptr->users()) {
+      if (auto *store = dyn_cast<StoreInst>(user)) {
+        if (store->getPointerOperand() == loadptr) {
+          visit(store);
         }
-        auto *iBB = phi->getIncomingBlock(i);
-        Instruction *term = iBB->getTerminator();
-        add2Slice(term);
       }
-      continue;
+    }
+
+  } else if (auto *store = dyn_cast<StoreInst>(val)) {
+    visitInst(store->getValueOperand());
+
+  } else if (auto *call = dyn_cast<CallInst>(val)) {
+    for (auto &arg : call->args()) {
+      visitInst(arg);
+    }
+
+  } else if (isa<GetElementPtrInst>(val) || isa<BranchInst>(val) ||
+             isa<SwitchInst>(val) || isa<IndirectBrInst>(val)) {
+    return;
+
+  } else if (auto *inst = dyn_cast<Instruction>(val)) {
+    for (auto &use : inst->operands()) {
+      visitInst(use);
+    }
+  }
+}
+
+// -DSNAPSHOT builds the dependence graphs from a snapshot.h copy of the
+// module instead of the IR, with the same node numbering and the same
+// rules. The concurrent build drops the module once the graphs are built.
+#ifdef SNAPSHOT
+#if defined(MULTI_ROOT) || defined(CHOP) || defined(SLICE_COMPARE)
+#error "-DSNAPSHOT only runs the full and thin slices"
+#endif
+const snapshot::Module *ir = nullptr;
+#endif
+
+template <typename Visit>
+void forEachBackwardDep(const snapshot::Module &ir, uint32_t val,
+                        Visit &&visit) {
+  if (ir.kind[val] != snapshot::Instruction) {
+    visit(val);
+    return;
+  }
+  auto visitInst = [&](uint32_t op) {
+    if (ir.kind[op] == snapshot::Instruction)
+      visit(op);
+  };
+  unsigned opcode = ir.opcode[val];
+  if (opcode == Instruction::PHI) {
+    for (unsigned i = 0; i < ir.numIncoming(val); ++i) {
+      visitInst(ir.incomingValue(val, i));
+      visit(ir.terminator(ir.incomingBlock(val, i)));
+    }
+    return;
 
-    } else if (auto *select = dyn_cast<SelectInst>(val)) {
-      Value *tval = select->getTrueValue();
-      Value *fval = select->getFalseValue();
-      if (auto *tvalInst = dyn_cast<Instruction>(tval)) {
-        add2Slice(tvalInst);
+  } else if (opcode == Instruction::Select) {
+    visitInst(ir.operand(val, 1));
+    visitInst(ir.operand(val, 2));
+
+  } else if (Instruction::isCast(opcode)) {
+    visitInst(ir.operand(val, 0));
+
+  } else {
+    for (uint32_t op : ir.operands(val)) {
+      visitInst(op);
+    }
+  }
+
+  for (uint32_t pred : ir.predecessors(ir.block[val])) {
+    visit(ir.terminator(pred));
+  }
+}
+
+// A call's arguments are its operands but the callee.
+template <typename Visit>
+void forEachThinDep(const snapshot::Module &ir, uint32_t val, Visit &&visit) {
+  if (ir.kind[val] != snapshot::Instruction)
+    return;
+  auto visitInst = [&](uint32_t op) {
+    if (ir.isLocal(op))
+      visit(op);
+  };
+  auto operands = ir.operands(val);
+  switch (ir.opcode[val]) {
+  case Instruction::PHI:
+    for (unsigned i = 0; i < ir.numIncoming(val); ++i) {
+      visitInst(ir.incomingValue(val, i));
+    }
+    break;
+  case Instruction::Select:
+    visitInst(operands[1]);
+    visitInst(operands[2]);
+    break;
+  case Instruction::Load:
+    for (uint32_t user : ir.users(operands[0])) {
+      if (ir.isInst(user, Instruction::Store) &&
+          ir.operand(user, 1) == operands[0])
+        visit(user);
+    }
+    break;
+  case Instruction::Store:
+    visitInst(operands[0]);
+    break;
+  case Instruction::Call:
+    for (uint32_t arg : operands.drop_back()) {
+      visitInst(arg);
+    }
+    break;
+  case Instruction::GetElementPtr:
+  case Instruction::Br:
+  case Instruction::Switch:
+  case Instruction::IndirectBr:
+    break;
+  default:
+    for (uint32_t op : operands) {
+      visitInst(op);
+    }
+  }
+}
+
+enum SliceKind { FullSlice, ThinSlice };
+
+#ifdef THIN_SLICE
+constexpr SliceKind sliceKind = ThinSlice;
+#else
+constexpr SliceKind sliceKind = FullSlice;
+#endif
+
+// Adjacency lists over dense node IDs: the targets of node id are
+// deps[start[id]] .. deps[start[id + 1] - 1].
+struct CSRList {
+  std::vector<unsigned> start, deps;
+
+  CSRList reversed() const {
+    CSRList rev;
+    unsigned n = start.empty() ? 0 : start.size() - 1;
+    rev.start.assign(n + 1, 0);
+    for (unsigned dep : deps) {
+      rev.start[dep + 1]++;
+    }
+    for (unsigned id = 0; id < n; ++id) {
+      rev.start[id + 1] += rev.start[id];
+    }
+    rev.deps.resize(deps.size());
+    std::vector<unsigned> fill(rev.start.begin(), rev.start.end() - 1);
+    for (unsigned id = 0; id < n; ++id) {
+      for (unsigned k = start[id]; k < start[id + 1]; ++k) {
+        rev.deps[fill[deps[k]]++] = id;
       }
-      if (auto *fvalInst = dyn_cast<Instruction>(fval)) {
-        add2Slice(fvalInst);
+    }
+    return rev;
+  }
+};
+
+// Dense IDs for the arguments and instructions of one function, with the
+// backward dependences and users of each node as CSR lists over those IDs.
+// The thin and reversed lists are only built for the query kinds that need
+// them.
+struct FuncGraph {
+  std::vector<Value *> nodes;
+  DenseMap<Value *, unsigned> ids;
+  CSRList bwd, fwd;
+  CSRList thinBwd, thinFwd;
+  CSRList bwdRev;
+  // Set when built from a snapshot; nodes and ids stay empty then.
+  const snapshot::Module *ir = nullptr;
+  uint32_t func = 0;
+
+  explicit FuncGraph(Function &func) {
+    for (auto &arg : func.args()) {
+      add(&arg);
+    }
+    for (auto &BB : func) {
+      for (auto &inst : BB) {
+        add(&inst);
       }
+    }
 
-    } else if (auto *cast = dyn_cast<CastInst>(val)) {
-      Value *src = cast->getOperand(0);
-      if (auto *srcInst = dyn_cast<Instruction>(src)) {
-        add2Slice(srcInst);
+    bwd.start.reserve(nodes.size() + 1);
+    fwd.start.reserve(nodes.size() + 1);
+    for (unsigned id = 0; id < nodes.size(); ++id) {
+      bwd.start.push_back(bwd.deps.size());
+      forEachBackwardDep(nodes[id], [&](Value *dep) { link(id, dep, bwd); });
+      fwd.start.push_back(fwd.deps.size());
+      for (auto *user : nodes[id]->users()) {
+        link(id, user, fwd);
       }
+    }
+    bwd.start.push_back(bwd.deps.size());
+    fwd.start.push_back(fwd.deps.size());
+  }
 
-      // } else if (auto *call = dyn_cast<CallInst>(inst)) {
-      //   auto *cf = call->getCalledFunction();
-      //   if (cf && !cf->isDeclaration()) {
-      //     for (int i = 0; i < call->arg_size(); ++i) {
-      //       if (i < cf->arg_size()) {
-      //         auto *arg = cf->getArg(i);
-      //         if (auto *argInst = dyn_cast<Instruction>(arg)) {
-      //           add2Slice(argInst);
-      //         }
-      //       }
-      //     }
-      //     if (!cf->getReturnType()->isVoidTy()) {
-      //       for (auto &cfBB : *cf) {
-      //         for (auto &cfinst : cfBB) {
-      //           if (auto *ret = llvm::dyn_cast<llvm::ReturnInst>(&cfinst)) {
-      //             add2Slice(ret);
-      //           }
-      //         }
-      //       }
-      //     }
-      //   }
-
-    } else if (auto *inst = dyn_cast<Instruction>(val)) {
-      for (auto &use : inst->operands()) {
-        if (auto *op = dyn_cast<Instruction>(use)) {
-          add2Slice(op);
-        }
+  // Node IDs are the snapshot's local indices, which number the arguments
+  // and then the instructions just like the constructor above.
+  FuncGraph(const snapshot::Module &ir, uint32_t func) : ir(&ir), func(func) {
+    size_t n = ir.numLocals(func);
+    bwd.start.reserve(n + 1);
+    fwd.start.reserve(n + 1);
+    for (unsigned id = 0; id < n; ++id) {
+      uint32_t val = ir.localValue(func, id);
+      bwd.start.push_back(bwd.deps.size());
+      forEachBackwardDep(ir, val, [&](uint32_t dep) { link(id, dep, bwd); });
+      fwd.start.push_back(fwd.deps.size());
+      for (uint32_t user : ir.users(val)) {
+        link(id, user, fwd);
       }
+    }
+    bwd.start.push_back(bwd.deps.size());
+    fwd.start.push_back(fwd.deps.size());
+  }
 
-    } else {
-      add2Slice(val);
+  size_t size() const { return bwd.start.size() - 1; }
+
+  void add(Value *val) {
+    ids[val] = nodes.size();
+    nodes.push_back(val);
+  }
+
+  void link(unsigned id, uint32_t dep, CSRList &list) {
+    if (ir->owns(func, dep)) {
+      unsigned depId = ir->localIndex(func, dep);
+      if (depId != id)
+        list.deps.push_back(depId);
     }
+  }
+
+  void link(unsigned id, Value *dep, CSRList &list) {
+    auto it = ids.find(dep);
+    if (it != ids.end() && it->second != id) {
+      list.deps.push_back(it->second);
+    }
+  }
 
-    if (auto *inst = dyn_cast<Instruction>(val)) {
-      for (BasicBlock *predBB : predecessors(inst->getParent())) {
-        auto *term = predBB->getTerminator();
-        add2Slice(term);
+  void buildThin() {
+    if (!thinBwd.start.empty())
+      return;
+    thinBwd.start.reserve(size() + 1);
+    for (unsigned id = 0; id < size(); ++id) {
+      thinBwd.start.push_back(thinBwd.deps.size());
+      if (ir) {
+        forEachThinDep(*ir, ir->localValue(func, id),
+                       [&](uint32_t dep) { link(id, dep, thinBwd); });
+      } else {
+        forEachThinDep(nodes[id], [&](Value *dep) { link(id, dep, thinBwd); });
       }
     }
-    // iter end
+    thinBwd.start.push_back(thinBwd.deps.size());
+    thinFwd = thinBwd.reversed();
   }
-}
 
-void forwardSlice(Value *root, std::unordered_set<Value *> &slice) {
-  std::queue<Value *> worklist;
+  void buildReversed() {
+    if (bwdRev.start.empty())
+      bwdRev = bwd.reversed();
+  }
 
-  auto add2Slice = [&](Value *i) {
-    if (slice.insert(i).second) {
-      worklist.push(i);
+  const CSRList &backward(SliceKind kind) const {
+    return kind == ThinSlice ? thinBwd : bwd;
+  }
+  const CSRList &forward(SliceKind kind) const {
+    return kind == ThinSlice ? thinFwd : fwd;
+  }
+};
+
+// Per-thread query state reused across slices, so a query makes no heap
+// allocations once it has seen the largest function. A node is visited when
+// its mark equals the query's epoch; the worklist array doubles as the slice.
+struct SliceScratch {
+  std::vector<uint32_t> mark;
+  std::vector<unsigned> worklist;
+  uint32_t epoch = 0;
+
+  void reserve(size_t n) {
+    if (mark.size() < n) {
+      mark.resize(n, 0);
+      worklist.resize(n);
     }
+  }
+
+  // Returns the first of count fresh epochs.
+  uint32_t newEpochs(uint32_t count) {
+    if (epoch > UINT32_MAX - count) {
+      std::fill(mark.begin(), mark.end(), 0);
+      epoch = 0;
+    }
+    epoch += count;
+    return epoch - count + 1;
+  }
+};
+
+// BFS from root over one CSR list, marking nodes with epoch. Nodes already
+// marked with prior are in the slice and are not counted again; passing
+// prior == epoch counts every node. A nonzero within restricts the traversal
+// to nodes marked within. Returns the number of nodes added.
+size_t denseReach(const CSRList &list, unsigned root, SliceScratch &scratch,
+                  uint32_t epoch, uint32_t prior, uint32_t within = 0) {
+  uint32_t *mark = scratch.mark.data();
+  unsigned *worklist = scratch.worklist.data();
+  const unsigned *start = list.start.data();
+  const unsigned *deps = list.deps.data();
+  size_t head = 0, tail = 0, added = 0;
+
+  auto add2Slice = [&](unsigned id) {
+    if (mark[id] == epoch)
+      return;
+    if (within && mark[id] != within)
+      return;
+    if (mark[id] != prior)
+      ++added;
+    mark[id] = epoch;
+    worklist[tail++] = id;
   };
 
-  slice.insert(root);
-  worklist.push(root);
+  add2Slice(root);
+  while (head < tail) {
+    unsigned id = worklist[head++];
+    for (unsigned k = start[id]; k < start[id + 1]; ++k) {
+      add2Slice(deps[k]);
+    }
+  }
+  instrument::worklistPops(tail);
+  return added;
+}
+
+// Size of the forward slice of root, unioned with its backward slice when
+// backward is set.
+size_t sliceDense(FuncGraph &graph, unsigned root, bool backward,
+                  SliceKind kind, SliceScratch &scratch) {
+  scratch.reserve(graph.size());
+  uint32_t epoch = scratch.newEpochs(2);
+  size_t size = 0;
+  if (backward) {
+    size += denseReach(graph.backward(kind), root, scratch, epoch, epoch);
+  }
+  size += denseReach(graph.forward(kind), root, scratch, epoch + 1, epoch);
+  if (backward)
+    instrument::setUnion(size);
+  return size;
+}
+
+// Size of the chop between source and sink: the nodes on some dependence path
+// from source to sink. The backward slice of sink is marked first, and the
+// forward walk from source never leaves it.
+size_t chopDense(FuncGraph &graph, unsigned source, unsigned sink,
+                 SliceKind kind, SliceScratch &scratch) {
+  scratch.reserve(graph.size());
+  uint32_t epoch = scratch.newEpochs(2);
+  denseReach(graph.backward(kind), sink, scratch, epoch, epoch);
+  const CSRList &rev = kind == ThinSlice ? graph.thinFwd : graph.bwdRev;
+  return denseReach(rev, source, scratch, epoch + 1, epoch + 1, epoch);
+}
+
+#ifndef SLICE_BATCH
+#define SLICE_BATCH 64
+#endif
+static_assert(SLICE_BATCH % 64 == 0, "SLICE_BATCH must be a multiple of 64");
+
+// One bit per root of the current batch. The fixed-size word loop is
+// vectorized, so SLICE_BATCH=512 fills a whole AVX-512 register.
+struct RootMask {
+  uint64_t w[SLICE_BATCH / 64] = {};
+
+  void set(unsigned bit) { w[bit / 64] |= uint64_t(1) << (bit % 64); }
+
+  bool orIn(const RootMask &rhs) {
+    uint64_t changed = 0;
+    for (int i = 0; i < SLICE_BATCH / 64; ++i) {
+      uint64_t merged = w[i] | rhs.w[i];
+      changed |= merged ^ w[i];
+      w[i] = merged;
+    }
+    return changed != 0;
+  }
+
+  size_t count() const {
+    size_t n = 0;
+    for (int i = 0; i < SLICE_BATCH / 64; ++i) {
+      n += __builtin_popcountll(w[i]);
+    }
+    return n;
+  }
+};
+
+// Bit-parallel BFS: ORs each node's mask into its dependences until no mask
+// changes, so every root of the batch is traversed in the same pass.
+void propagateMasks(const CSRList &list, std::vector<RootMask> &masks) {
+  std::queue<unsigned> worklist;
+  std::vector<char> queued(masks.size(), 0);
+  for (unsigned id = 0; id < masks.size(); ++id) {
+    if (masks[id].count()) {
+      queued[id] = 1;
+      worklist.push(id);
+    }
+  }
 
   while (!worklist.empty()) {
-    auto *val = worklist.front();
+    unsigned id = worklist.front();
     worklist.pop();
+    instrument::worklistPops();
+    queued[id] = 0;
+
+    for (unsigned k = list.start[id]; k < list.start[id + 1]; ++k) {
+      unsigned depId = list.deps[k];
+      if (masks[depId].orIn(masks[id]) && !queued[depId]) {
+        queued[depId] = 1;
+        worklist.push(depId);
+      }
+    }
+  }
+}
 
-    for (auto *user : val->users()) {
-      add2Slice(user);
+// Same roots and slices as sliceFunc, SLICE_BATCH roots per traversal.
+// Returns the summed size of all slices.
+size_t sliceFuncMulti(Function &func) {
+  instrument::PhaseTimer initTimer(instrument::Init);
+  FuncGraph graph(func);
+  initTimer.stop();
+  instrument::PhaseTimer timer(instrument::Solve);
+  std::vector<unsigned> roots;
+  std::vector<bool> backward;
+  for (auto &BB : func) {
+    for (auto &inst : BB) {
+      if (isa<GetElementPtrInst>(inst) || isa<AllocaInst>(inst)) {
+        roots.push_back(graph.ids[&inst]);
+        backward.push_back(isa<GetElementPtrInst>(inst));
+      }
     }
   }
+  for (auto &arg : func.args()) {
+    roots.push_back(graph.ids[&arg]);
+    backward.push_back(false);
+  }
+
+  size_t total = 0;
+  for (size_t base = 0; base < roots.size(); base += SLICE_BATCH) {
+    size_t batch = std::min<size_t>(SLICE_BATCH, roots.size() - base);
+    std::vector<RootMask> bwd(graph.size()), fwd(graph.size());
+    bool anyBackward = false;
+    for (size_t k = 0; k < batch; ++k) {
+      fwd[roots[base + k]].set(k);
+      if (backward[base + k]) {
+        bwd[roots[base + k]].set(k);
+        anyBackward = true;
+      }
+    }
+    if (anyBackward) {
+      propagateMasks(graph.bwd, bwd);
+    }
+    propagateMasks(graph.fwd, fwd);
+
+    for (unsigned id = 0; id < graph.size(); ++id) {
+      fwd[id].orIn(bwd[id]);
+      total += fwd[id].count();
+    }
+  }
+  return total;
 }
 
 void printSlice(Module &module, std::unordered_set<Value *> &slice) {
@@ -157,111 +650,148 @@ void printSlice(Module &module, std::unordered_set<Value *> &slice) {
   }
 }
 
-void sliceFunc(Function &func) {
+// Returns the summed size of all slices.
+size_t sliceFunc(Function &func, SliceKind kind, SliceScratch &scratch) {
+  instrument::PhaseTimer initTimer(instrument::Init);
+  FuncGraph graph(func);
+  if (kind == ThinSlice)
+    graph.buildThin();
+  initTimer.stop();
+  instrument::PhaseTimer timer(instrument::Solve);
+  size_t total = 0;
   for (auto &BB : func) {
     for (auto &inst : BB) {
       if (isa<GetElementPtrInst>(inst)) {
-        std::unordered_set<Value *> slice;
-        backwardSlice(&inst, slice);
-        forwardSlice(&inst, slice);
+        total += sliceDense(graph, graph.ids[&inst], true, kind, scratch);
       } else if (isa<AllocaInst>(inst)) {
-        std::unordered_set<Value *> slice;
-        forwardSlice(&inst, slice);
+        total += sliceDense(graph, graph.ids[&inst], false, kind, scratch);
       }
     }
   }
   for (auto &arg : func.args()) {
-    std::unordered_set<Value *> slice;
-    forwardSlice(&arg, slice);
+    total += sliceDense(graph, graph.ids[&arg], false, kind, scratch);
   }
+  return total;
 }
 
-void threadedSlice(std::mutex &Qmutex, std::priority_queue<TaskInfo> &taskQ,
-                   int tid) {
-  auto start = std::chrono::high_resolution_clock::now();
-  int max_time = 0;
-  int max_size = 0;
-  int task_count = 0;
-  int total_size = 0;
-  int total_size_sq = 0;
-  int total_time = 0;
-  int total_time_sq = 0;
+#ifdef SNAPSHOT
+size_t sliceFunc(uint32_t func, SliceKind kind, SliceScratch &scratch) {
+  instrument::PhaseTimer initTimer(instrument::Init);
+  FuncGraph graph(*ir, func);
+  if (kind == ThinSlice)
+    graph.buildThin();
+  initTimer.stop();
+  instrument::PhaseTimer timer(instrument::Solve);
+  size_t total = 0;
+  for (uint32_t inst : ir->insts(func)) {
+    if (ir->opcode[inst] == Instruction::GetElementPtr) {
+      total += sliceDense(graph, ir->localIndex(func, inst), true, kind,
+                          scratch);
+    } else if (ir->opcode[inst] == Instruction::Alloca) {
+      total += sliceDense(graph, ir->localIndex(func, inst), false, kind,
+                          scratch);
+    }
+  }
+  for (uint32_t arg : ir->args(func)) {
+    total += sliceDense(graph, ir->localIndex(func, arg), false, kind,
+                        scratch);
+  }
+  return total;
+}
+#endif
 
+// Chops every slicing root of func against each return of func. Returns the
+// summed size of all chops.
+size_t chopFunc(Function &func, SliceKind kind, SliceScratch &scratch) {
+  instrument::PhaseTimer initTimer(instrument::Init);
+  FuncGraph graph(func);
+  if (kind == ThinSlice)
+    graph.buildThin();
+  else
+    graph.buildReversed();
+  initTimer.stop();
+  instrument::PhaseTimer timer(instrument::Solve);
+  std::vector<unsigned> sources, sinks;
+  for (auto &arg : func.args()) {
+    sources.push_back(graph.ids[&arg]);
+  }
+  for (auto &BB : func) {
+    for (auto &inst : BB) {
+      if (isa<GetElementPtrInst>(inst) || isa<AllocaInst>(inst)) {
+        sources.push_back(graph.ids[&inst]);
+      } else if (isa<ReturnInst>(inst)) {
+        sinks.push_back(graph.ids[&inst]);
+      }
+    }
+  }
+
+  size_t total = 0;
+  for (unsigned source : sources) {
+    for (unsigned sink : sinks) {
+      total += chopDense(graph, source, sink, kind, scratch);
+    }
+  }
+  return total;
+}
+
+void threadedSlice(
+    std::mutex &Qmutex, std::priority_queue<TaskInfo> &taskQ,
+    [[maybe_unused]] std::vector<std::unique_ptr<FuncGraph>> &graphs,
+    int tid) {
+  instrument::ThreadScope scope("worker " + std::to_string(tid));
+  SliceScratch scratch;
   while (true) {
-    int index;
+#ifndef SNAPSHOT
     Function *func;
-    Value *val;
+#endif
+#if !defined(MULTI_ROOT) && !defined(CHOP)
+    int index;
+    unsigned root;
+    bool backward;
+#endif
     int size;
+    size_t blocks;
     {
       std::lock_guard<std::mutex> lock(Qmutex);
       if (taskQ.empty())
         break;
-      index = taskQ.top().index;
+#ifndef SNAPSHOT
       func = taskQ.top().func;
-      val = taskQ.top().val;
-      // size = taskQ.top().size;
+#endif
+#if !defined(MULTI_ROOT) && !defined(CHOP)
+      index = taskQ.top().index;
+      root = taskQ.top().root;
+      backward = taskQ.top().backward;
+#endif
+      blocks = taskQ.top().size;
       taskQ.pop();
     }
-#ifdef PRINT_STATS
-    auto sub_start = std::chrono::high_resolution_clock::now();
-#endif
 
-    std::unordered_set<Value *> slice;
-    if (isa<GetElementPtrInst>(val)) {
-      backwardSlice(val, slice);
-      forwardSlice(val, slice);
-    } else {
-      forwardSlice(val, slice);
-    }
-    size = slice.size();
-
-#ifdef PRINT_STATS
-    auto sub_end = std::chrono::high_resolution_clock::now();
-    auto sub_duration = std::chrono::duration_cast<std::chrono::microseconds>(
-        sub_end - sub_start);
-    int time = sub_duration.count();
-    if (time > max_time) {
-      max_time = time;
-      max_size = size;
-    }
-    task_count++;
-    total_size += size;
-    total_size_sq += size * size;
-    total_time += time;
-    total_time_sq += time * time;
+#if defined(MULTI_ROOT)
+    instrument::TaskTimer task(0, func, blocks);
+    size = sliceFuncMulti(*func);
+#elif defined(CHOP)
+    instrument::TaskTimer task(0, func, blocks);
+    size = chopFunc(*func, sliceKind, scratch);
+#else
+    auto &graph = *graphs[index];
+#ifdef SNAPSHOT
+    instrument::TaskTimer task(0, ir->name(index), blocks, ir->numInsts(index));
+#else
+    instrument::TaskTimer task(0, func, blocks,
+                               graph.size() - func->arg_size());
 #endif
-  }
-
-#ifdef PRINT_STATS
-  auto end = std::chrono::high_resolution_clock::now();
-  auto duration =
-      std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-
-  double mean_size = (task_count > 0) ? total_size / task_count : 0;
-  double var_size = (task_count > 0)
-                        ? (total_size_sq / task_count) - (mean_size * mean_size)
-                        : -(mean_size * mean_size);
-  double mean_time = (task_count > 0) ? total_time / task_count : 0;
-  double var_time = (task_count > 0)
-                        ? (total_time_sq / task_count) - (mean_time * mean_time)
-                        : -(mean_time * mean_time);
-
-  {
-    std::lock_guard<std::mutex> lock(outsmtx);
-    outs() << "\nThread " << tid << "\ttime:\t" << duration.count() << " us\n";
-    outs() << "Max task time :\t " << max_time << " us with\t " << max_size
-           << " instuctions in slice\n";
-    outs() << "Tasks processed:\t" << task_count << "\n";
-    outs() << "Task size mean:\t" << mean_size << ", var:\t" << var_size
-           << ", std dev:\t" << std::sqrt(var_size) << "\n";
-    outs() << "Task time mean:\t" << mean_time << ", var:\t" << var_time
-           << ", std dev:\t" << std::sqrt(var_time) << "\n";
-  }
+    instrument::PhaseTimer timer(instrument::Solve);
+    size = sliceDense(graph, root, backward, sliceKind, scratch);
 #endif
+    // Tasks are sized by the slice they produce.
+    task.setSize(size);
+  }
 }
 
 int main(int argc, char *argv[]) {
   InitLLVM X(argc, argv);
+  instrument::init(argc, argv);
   if (argc < 2) {
     outs() << "Expect IR filename\n";
     exit(1);
@@ -269,7 +799,11 @@ int main(int argc, char *argv[]) {
   LLVMContext context;
   SMDiagnostic smd;
   char *filename = argv[1];
-  std::unique_ptr<Module> module = parseIRFile(filename, smd, context);
+  std::unique_ptr<Module> module;
+  {
+    instrument::PhaseTimer timer(instrument::Parse);
+    module = parseIRFile(filename, smd, context);
+  }
   if (!module) {
     outs() << "Cannot parse IR file\n";
     smd.print(filename, outs());
@@ -279,7 +813,7 @@ int main(int argc, char *argv[]) {
 #ifdef CSV
   std::string csvname = std::string(argv[1]) + ".csv";
   std::ofstream csv(csvname);
-  csv << "name,size,inum,time(us)\n";
+  csv << "name," << FuncFeatures::csvHeader() << ",time(us)\n";
 #ifndef RUN_COUNT
 #define RUN_COUNT 1
 #endif
@@ -288,33 +822,75 @@ int main(int argc, char *argv[]) {
   outs() << "Slicing\n";
   outs() << module->getFunctionList().size() << " function(s)\n";
   auto start = std::chrono::high_resolution_clock::now();
+#ifdef SNAPSHOT
+  std::unique_ptr<snapshot::Module> lowered;
+  {
+    instrument::PhaseTimer timer(instrument::Init);
+    lowered = std::make_unique<snapshot::Module>(*module);
+  }
+  ir = lowered.get();
+  outs() << "Snapshot: " << ir->size() << " values, " << ir->bytes() / 1024
+         << " KiB\n";
+#endif
 
+// #define SLICE_COMPARE
 // #define CONCURRENT
-#ifndef CONCURRENT
+#if defined(SLICE_COMPARE)
+  outs() << "Comparing slice kinds\n";
+  SliceScratch scratch;
+  struct {
+    const char *name;
+    bool chop;
+    SliceKind kind;
+  } runs[] = {{"Full slice", false, FullSlice},
+              {"Thin slice", false, ThinSlice},
+              {"Full chop", true, FullSlice},
+              {"Thin chop", true, ThinSlice}};
+  for (auto &run : runs) {
+    size_t total = 0;
+    auto rstart = std::chrono::high_resolution_clock::now();
+    for (auto &func : *module) {
+      total += run.chop ? chopFunc(func, run.kind, scratch)
+                        : sliceFunc(func, run.kind, scratch);
+    }
+    auto rend = std::chrono::high_resolution_clock::now();
+    auto rtime =
+        std::chrono::duration_cast<std::chrono::microseconds>(rend - rstart)
+            .count();
+    outs() << run.name << ":\t" << total << " instructions in slices, "
+           << rtime << " us\n";
+  }
+
+#elif !defined(CONCURRENT)
   outs() << "Sequential mode\n";
-  for (auto &func : *module) {
+  SliceScratch scratch;
+  for (auto [i, func] : enumerate(*module)) {
 #ifdef CSV
     std::string fname = func.getName().str();
-    size_t fsize = func.size();
-    int instNum = 0;
-    for (BasicBlock &BB : func) {
-      instNum += BB.size();
-    }
-    int tftime = 0;
+    FuncFeatures features(func);
+    double tftime = 0;
     for (int r = 0; r < RUN_COUNT; ++r) {
 
       auto fstart = std::chrono::high_resolution_clock::now();
 #endif
-      sliceFunc(func);
+#if defined(MULTI_ROOT)
+      sliceFuncMulti(func);
+#elif defined(CHOP)
+      chopFunc(func, sliceKind, scratch);
+#elif defined(SNAPSHOT)
+      sliceFunc(i, sliceKind, scratch);
+#else
+      sliceFunc(func, sliceKind, scratch);
+#endif
 #ifdef CSV
       auto fend = std::chrono::high_resolution_clock::now();
       auto ftime =
-          std::chrono::duration_cast<std::chrono::microseconds>(fend - fstart)
+          std::chrono::duration_cast<std::chrono::nanoseconds>(fend - fstart)
               .count();
-      tftime += ftime;
+      tftime += ftime / 1000.0;
     }
     tftime /= RUN_COUNT;
-    csv << fname << "," << fsize << "," << instNum << "," << tftime << "\n";
+    csv << fname << "," << features.csvRow() << "," << tftime << "\n";
 #endif
   }
 #else
@@ -324,29 +900,65 @@ int main(int argc, char *argv[]) {
 #endif
   outs() << "Concurrent mode\n";
   std::priority_queue<TaskInfo> taskQ;
+  std::vector<std::unique_ptr<FuncGraph>> graphs(module->size());
 
+  instrument::PhaseTimer initTimer(instrument::Init);
   for (auto [i, func] : enumerate(*module)) {
     if (func.isDeclaration())
       continue;
+    double cost = sliceCost.predict(func);
+#if defined(MULTI_ROOT) || defined(CHOP)
+    // One task per function, which builds its own graph.
+    taskQ.push({&func, 0, false, func.size(), cost, (int)i});
+    continue;
+#endif
+    // Roots as (node, backward) pairs.
+    std::vector<std::pair<unsigned, bool>> roots;
+#ifdef SNAPSHOT
+    graphs[i] = std::make_unique<FuncGraph>(*ir, i);
+    for (uint32_t inst : ir->insts(i)) {
+      unsigned opcode = ir->opcode[inst];
+      if (opcode == Instruction::GetElementPtr ||
+          opcode == Instruction::Alloca)
+        roots.push_back({ir->localIndex(i, inst),
+                         opcode == Instruction::GetElementPtr});
+    }
+    for (uint32_t arg : ir->args(i)) {
+      roots.push_back({ir->localIndex(i, arg), false});
+    }
+#else
+    graphs[i] = std::make_unique<FuncGraph>(func);
     for (auto &BB : func) {
       for (auto &inst : BB) {
-        if (isa<GetElementPtrInst>(inst)) {
-          taskQ.push({&func, &inst, func.size(), (int)i});
-        } else if (isa<AllocaInst>(inst)) {
-          taskQ.push({&func, &inst, func.size(), (int)i});
-        }
+        if (isa<GetElementPtrInst>(inst) || isa<AllocaInst>(inst))
+          roots.push_back(
+              {graphs[i]->ids[&inst], isa<GetElementPtrInst>(inst)});
       }
     }
     for (auto &arg : func.args()) {
-      taskQ.push({&func, &arg, func.size(), (int)i});
+      roots.push_back({graphs[i]->ids[&arg], false});
+    }
+#endif
+    if (sliceKind == ThinSlice)
+      graphs[i]->buildThin();
+    // sliceCost predicts all slices of func together.
+    for (auto [root, backward] : roots) {
+      taskQ.push({&func, root, backward, func.size(), cost / roots.size(),
+                  (int)i});
     }
   }
+#ifdef SNAPSHOT
+  module.reset();
+#endif
+
+  initTimer.stop();
 
   std::mutex Qmutex;
   std::vector<std::thread> threads;
   threads.reserve(NTHREADS);
   for (int i = 0; i < NTHREADS; ++i) {
-    threads.emplace_back(threadedSlice, std::ref(Qmutex), std::ref(taskQ), i);
+    threads.emplace_back(threadedSlice, std::ref(Qmutex), std::ref(taskQ),
+                         std::ref(graphs), i);
   }
   for (auto &t : threads) {
     t.join();
@@ -357,4 +969,7 @@ int main(int argc, char *argv[]) {
   auto duration =
       std::chrono::duration_cast<std::chrono::microseconds>(end - start);
   outs() << "Analysis time: " << duration.count() << " us\n";
-}
\ No newline at end of file
+
+  instrument::report("slice", filename);
+  return 0;
+}